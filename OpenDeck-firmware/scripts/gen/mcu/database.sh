@@ -0,0 +1,21 @@
+#!/usr/bin/env bash
+
+declare -i read_cache_size
+
+read_cache_size=$($yaml_parser "$project_yaml_file" database.read-cache-size)
+
+if [[ $read_cache_size -ne 0 ]]
+then
+    # Read cache mirrors emulated EEPROM variables (16-bit each), so it
+    # only makes sense when emulated EEPROM is used as database storage.
+    if [[ $($yaml_parser "$project_yaml_file" flash.emueeprom) == "null" ]]
+    then
+        echo "Database read cache requires emulated EEPROM"
+        exit 1
+    fi
+
+    {
+        printf "%s\n" "set(PROJECT_MCU_DATABASE_READ_CACHE_SIZE $read_cache_size)"
+        printf "%s\n" "list(APPEND $cmake_mcu_defines_var PROJECT_MCU_DATABASE_READ_CACHE_SIZE=$read_cache_size)"
+    } >> "$out_cmakelists"
+fi
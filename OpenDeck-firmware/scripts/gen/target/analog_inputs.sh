@@ -270,6 +270,96 @@ then
 
     printf "%s\n" "list(APPEND $cmake_defines_var PROJECT_TARGET_MAX_NR_OF_ANALOG_INPUTS=$nr_of_analog_inputs)" >> "$out_cmakelists"
 
+    # Sampling schedule: inputs are sampled in frames, and values are passed to application once
+    # all the slots in frame are sampled. Schedule has as many frames as the highest weight specified
+    # in analog.schedule, and each input is sampled in the amount of frames equal to its weight (1 if
+    # not specified), spread evenly across the schedule.
+    declare -a analog_weights
+    declare -a schedule_inputs
+    declare -a schedule_frame_end
+    declare -i schedule_frames
+    schedule_frames=1
+
+    for ((i=0; i<nr_of_analog_inputs; i++))
+    do
+        analog_weights[i]=1
+    done
+
+    if [[ "$($yaml_parser "$yaml_file" analog.schedule)" != "null" ]]
+    then
+        nr_of_scheduled_inputs=$($yaml_parser "$yaml_file" analog.schedule --length)
+
+        for ((i=0; i<nr_of_scheduled_inputs; i++))
+        do
+            index=$($yaml_parser "$yaml_file" analog.schedule.["$i"].index)
+            weight=$($yaml_parser "$yaml_file" analog.schedule.["$i"].weight)
+
+            # inputs are specified with the same indexes as in application
+            if [[ "$($yaml_parser "$yaml_file" analog.indexing)" != "null" ]]
+            then
+                index=$($yaml_parser "$yaml_file" analog.indexing.["$index"])
+            fi
+
+            if [[ ! $index =~ ^[0-9]+$ ]] || [[ $index -ge $nr_of_analog_inputs ]]
+            then
+                echo "ERROR: Invalid analog input in sampling schedule slot ${i}"
+                exit 1
+            fi
+
+            if [[ ! $weight =~ ^[0-9]+$ ]] || [[ $weight -lt 1 ]] || [[ $weight -gt 64 ]]
+            then
+                echo "ERROR: Sampling schedule weight for analog input ${index} must be in range 1-64"
+                exit 1
+            fi
+
+            analog_weights[index]=$weight
+
+            if [[ $weight -gt $schedule_frames ]]
+            then
+                schedule_frames=$weight
+            fi
+        done
+    fi
+
+    for ((frame=0; frame<schedule_frames; frame++))
+    do
+        for ((i=0; i<nr_of_analog_inputs; i++))
+        do
+            # offset each input by its index so that the inputs with same weight aren't all sampled in the same frame
+            position=$((frame + (i % schedule_frames)))
+
+            if [[ $(((position + 1) * analog_weights[i] / schedule_frames)) -gt $((position * analog_weights[i] / schedule_frames)) ]]
+            then
+                schedule_inputs+=("$i")
+                schedule_frame_end+=("false")
+            fi
+        done
+
+        schedule_frame_end[-1]="true"
+    done
+
+    {
+        printf "%s\n" "#define PROJECT_TARGET_ADC_SCHEDULE_SLOTS ${#schedule_inputs[@]}"
+        printf "%s\n" "#define PROJECT_TARGET_ADC_SCHEDULE_FRAMES $schedule_frames"
+        printf "%s\n" "// Effective sample rate of each analog input, as a share of all ADC conversions:"
+    } >> "$out_header"
+
+    for ((i=0; i<nr_of_analog_inputs; i++))
+    do
+        printf "%s\n" "// input ${i}: ${analog_weights[i]}/${#schedule_inputs[@]}, sampled in ${analog_weights[i]} of ${schedule_frames} frames" >> "$out_header"
+    done
+
+    {
+        printf "%s\n" "namespace gen {"
+        printf "%s\n" "constexpr inline uint8_t ADC_SCHEDULE_INPUTS[PROJECT_TARGET_ADC_SCHEDULE_SLOTS] = {"
+        printf "%s,\n" "${schedule_inputs[@]}"
+        printf "%s\n" "};"
+        printf "%s\n" "constexpr inline bool ADC_SCHEDULE_FRAME_END[PROJECT_TARGET_ADC_SCHEDULE_SLOTS] = {"
+        printf "%s,\n" "${schedule_frame_end[@]}"
+        printf "%s\n" "};"
+        printf "%s\n" "}"
+    } >> "$out_header"
+
     if [[ "$($yaml_parser "$yaml_file" analog.indexing)" != "null" ]]
     then
         nr_of_analog_inputs=$($yaml_parser "$yaml_file" analog.indexing --length)
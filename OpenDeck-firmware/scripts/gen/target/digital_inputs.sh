@@ -119,7 +119,44 @@ then
         fi
     elif [[ $digital_in_type == shiftRegister ]]
     then
-        printf "%s\n" "list(APPEND $cmake_defines_var PROJECT_TARGET_DRIVER_DIGITAL_INPUT_SHIFT_REGISTER)" >> "$out_cmakelists"
+        number_of_in_sr=$($yaml_parser "$yaml_file" buttons.shiftRegisters)
+        sr_in_driver=$($yaml_parser "$yaml_file" buttons.driver)
+
+        if [[ $sr_in_driver == "pio" ]]
+        then
+            # Chain is clocked by PIO state machine and frames are moved to RAM by DMA.
+            if [[ $mcu != "rp2040" ]]
+            then
+                echo "PIO shift register driver is supported only on RP2040"
+                exit 1
+            fi
+
+            # Entire chain is read as a single 32-bit PIO frame
+            if [[ $number_of_in_sr -gt 4 ]]
+            then
+                echo "PIO shift register driver supports up to 4 shift registers"
+                exit 1
+            fi
+
+            declare -i sr_in_scan_rate
+            sr_in_scan_rate=$($yaml_parser "$yaml_file" buttons.scanRate)
+
+            if [[ $sr_in_scan_rate -eq 0 ]]
+            then
+                sr_in_scan_rate=4000
+            fi
+
+            {
+                printf "%s\n" "list(APPEND $cmake_defines_var PROJECT_TARGET_DRIVER_DIGITAL_INPUT_SHIFT_REGISTER_PIO)"
+                printf "%s\n" "list(APPEND $cmake_defines_var PROJECT_TARGET_SR_IN_SCAN_RATE=$sr_in_scan_rate)"
+            } >> "$out_cmakelists"
+        elif [[ $sr_in_driver == "null" ]]
+        then
+            printf "%s\n" "list(APPEND $cmake_defines_var PROJECT_TARGET_DRIVER_DIGITAL_INPUT_SHIFT_REGISTER)" >> "$out_cmakelists"
+        else
+            echo "Invalid shift register driver specified"
+            exit 1
+        fi
 
         port=$($yaml_parser "$yaml_file" buttons.pins.data.port)
         index=$($yaml_parser "$yaml_file" buttons.pins.data.index)
@@ -145,7 +182,6 @@ then
             printf "%s\n" "#define PIN_INDEX_SR_IN_LATCH CORE_MCU_IO_PIN_INDEX_DEF(${index})"
         } >> "$out_header"
 
-        number_of_in_sr=$($yaml_parser "$yaml_file" buttons.shiftRegisters)
         nr_of_digital_inputs=$(( 8 * "$number_of_in_sr"))
 
         printf "%s\n" "list(APPEND $cmake_defines_var PROJECT_TARGET_NR_OF_IN_SR=$number_of_in_sr)" >> "$out_cmakelists"
@@ -335,4 +335,61 @@ then
         # Active high
         printf "%s\n" "list(APPEND $cmake_defines_var PROJECT_TARGET_BOOTLOADER_BUTTON_ACTIVE_HIGH)" >> "$out_cmakelists"
     fi
-fi
\ No newline at end of file
+fi
+
+if [[ $($yaml_parser "$yaml_file" dualCore) == "true" ]]
+then
+    if [[ $mcu != "rp2040" ]]
+    then
+        echo "Dual-core execution is supported only on RP2040"
+        exit 1
+    fi
+
+    printf "%s\n" "list(APPEND $cmake_defines_var PROJECT_TARGET_DUAL_CORE)" >> "$out_cmakelists"
+fi
+
+if [[ $($yaml_parser "$yaml_file" lowPower) == "true" ]]
+then
+    if [[ $mcu != "nrf52840" ]]
+    then
+        echo "Low power mode is supported only on nRF52840"
+        exit 1
+    fi
+
+    printf "%s\n" "list(APPEND $cmake_defines_var PROJECT_TARGET_LOW_POWER)" >> "$out_cmakelists"
+fi
+
+sax_table_upload=$($yaml_parser "$yaml_file" sax.tableUpload)
+sax_fingering_index=$($yaml_parser "$yaml_file" sax.fingeringIndex)
+
+if [[ $sax_table_upload == "true" || $sax_fingering_index == "true" ]]
+then
+    # Both features are held in RAM: upload is staged (around 1.2kB) before it's written
+    # to database and fingering table is compiled into decision tree (around 3.2kB).
+    if [[ $mcu == atmega* || $mcu == at90usb* ]]
+    then
+        echo "Sax table upload and fingering index aren't supported on AVR"
+        exit 1
+    fi
+
+    sax_ram_budget=$($yaml_parser "$yaml_file" sax.ramBudget)
+
+    if [[ $sax_ram_budget == "null" ]]
+    then
+        echo "RAM budget for sax features (sax.ramBudget) left unspecified"
+        exit 1
+    fi
+
+    # Checked against actual usage when building the application
+    printf "%s\n" "list(APPEND $cmake_defines_var PROJECT_TARGET_SAX_RAM_BUDGET=$sax_ram_budget)" >> "$out_cmakelists"
+
+    if [[ $sax_table_upload == "true" ]]
+    then
+        printf "%s\n" "list(APPEND $cmake_defines_var PROJECT_TARGET_SAX_TABLE_UPLOAD)" >> "$out_cmakelists"
+    fi
+
+    if [[ $sax_fingering_index == "true" ]]
+    then
+        printf "%s\n" "list(APPEND $cmake_defines_var PROJECT_TARGET_SAX_FINGERING_INDEX)" >> "$out_cmakelists"
+    fi
+fi
@@ -30,7 +30,7 @@ namespace database
 
         static constexpr size_t MAX_PRESETS                = 10;
         // Custom system settings start at index 2 (CUSTOM_SYSTEM_SETTING_START).
-        // midisaxo uses custom indices up to 13 (transpose/deadzone/pb center).
+        // All of them are listed in sys::Config::systemSetting_t.
         static constexpr size_t MAX_CUSTOM_SYSTEM_SETTINGS = 20;
 
         enum class block_t : uint8_t
@@ -53,6 +53,9 @@ namespace database
             enum class system_t : uint8_t
             {
                 SYSTEM_SETTINGS,
+#ifdef PROJECT_TARGET_SAX_TABLE_UPLOAD
+                SAX_TABLE_STAGE,    // uploaded sax fingering table, written here first and then copied to the active preset
+#endif
                 AMOUNT
             };
 
@@ -62,6 +65,8 @@ namespace database
                 SAX_FINGERING_MASK_LO14,
                 SAX_FINGERING_MASK_HI12_ENABLE,
                 SAX_FINGERING_NOTE,
+                SAX_FINGERING_CARE_LO14,
+                SAX_FINGERING_CARE_HI12,
                 AMOUNT
             };
 
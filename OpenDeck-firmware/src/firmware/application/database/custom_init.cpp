@@ -17,6 +17,7 @@ limitations under the License.
 */
 
 #include "application/database/database.h"
+#include "application/system/config.h"
 #include "application/io/buttons/common.h"
 #include "application/io/analog/common.h"
 #include "application/io/leds/common.h"
@@ -33,17 +34,17 @@ void Admin::customInitGlobal()
     // set global channel to 1
     update(Config::Section::global_t::MIDI_SETTINGS, midi::setting_t::GLOBAL_CHANNEL, 1);
 
-    // Custom system setting index 11: sax transpose raw value 0..48 (= -24..+24 semis).
+    // Sax transpose raw value 0..48 (= -24..+24 semis).
     // Default to 0 semis (raw 24) on factory reset.
     // Note: use MSB as an internal "initialized" flag (masked out from UI).
-    update(Config::Section::system_t::SYSTEM_SETTINGS, 11, static_cast<uint16_t>(0x8000u | 24u));
+    update(Config::Section::system_t::SYSTEM_SETTINGS, sys::Config::systemSetting_t::SAX_TRANSPOSE, static_cast<uint16_t>(0x8000u | 24u));
 
-    // Custom system setting index 12: pitch bend deadzone around captured center.
+    // Pitch bend deadzone around captured center.
     // Higher value = less sensitive around center.
-    update(Config::Section::system_t::SYSTEM_SETTINGS, 12, 100);
+    update(Config::Section::system_t::SYSTEM_SETTINGS, sys::Config::systemSetting_t::SAX_PB_DEADZONE, 100);
 
-    // Custom system setting index 13: stored pitch bend center (player calibration).
-    update(Config::Section::system_t::SYSTEM_SETTINGS, 13, 8192);
+    // Stored pitch bend center (player calibration).
+    update(Config::Section::system_t::SYSTEM_SETTINGS, sys::Config::systemSetting_t::SAX_PB_CENTER, 8192);
 }
 
 void Admin::customInitButtons()
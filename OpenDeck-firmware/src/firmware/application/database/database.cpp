@@ -17,10 +17,10 @@ limitations under the License.
 */
 
 #include "application/util/conversion/conversion.h"
-#include "application/util/configurable/configurable.h"
 
 #include "core/util/util.h"
 
+#include <algorithm>
 #include <inttypes.h>
 
 using namespace lib::lessdb;
@@ -36,24 +36,12 @@ using namespace lib::lessdb;
 
 database::Admin::Admin(Hwa&    hwa,
                        Layout& layout)
-    : LessDb::LessDb(hwa)
+    : ReadCacheHolder(hwa)
+    , LessDb::LessDb(_readCache)
     , _layout(layout)
+    , _layoutMap(layout.map())
     , INITIALIZE_DATA(hwa.initializeDatabase())
-{
-    ConfigHandler.registerConfig(
-        sys::Config::block_t::GLOBAL,
-        // read
-        [this](uint8_t section, size_t index, uint16_t& value)
-        {
-            return sysConfigGet(static_cast<sys::Config::Section::global_t>(section), index, value);
-        },
-
-        // write
-        [this](uint8_t section, size_t index, uint16_t value)
-        {
-            return sysConfigSet(static_cast<sys::Config::Section::global_t>(section), index, value);
-        });
-}
+{}
 
 bool database::Admin::init(Handlers& handlers)
 {
@@ -79,6 +67,15 @@ bool database::Admin::init()
     systemBlockUsage      = LessDb::currentDatabaseSize();
     _userDataStartAddress = LessDb::nextParameterAddress();
 
+    // System block is read using compile-time section addresses (see readSystemBlock),
+    // so lessdb has to pack it in the same way.
+    const auto& lastSystemSection = _layout.systemSection(static_cast<Config::Section::system_t>(static_cast<uint8_t>(Config::Section::system_t::AMOUNT) - 1));
+
+    if ((lastSystemSection.offset + LayoutMap::sectionSize(lastSystemSection.parameters, lastSystemSection.type)) != systemBlockUsage)
+    {
+        return false;
+    }
+
     // now set the user layout
     if (!LessDb::setLayout(_layout.layout(Layout::type_t::USER), _userDataStartAddress))
     {
@@ -87,6 +84,11 @@ bool database::Admin::init()
 
     _lastPresetAddress = LessDb::nextParameterAddress();
 
+    // User layout given to lessdb is generated from the compile-time map, so sections can't differ
+    // in order, type or amount of parameters. Sizes are calculated independently, so compare them
+    // to verify that lessdb packs the sections in the same way.
+    _layoutMapValid = (_layoutMap.size == LessDb::currentDatabaseSize());
+
     // get theoretical maximum of presets
     _supportedPresets = (LessDb::dbSize() - systemBlockUsage) / (LessDb::currentDatabaseSize() + systemBlockUsage);
 
@@ -105,7 +107,7 @@ bool database::Admin::init()
     }
     else
     {
-        _activePreset = readSystemBlock(static_cast<size_t>(Config::systemSetting_t::ACTIVE_PRESET));
+        _activePreset = readSystemBlock(Config::Section::system_t::SYSTEM_SETTINGS, static_cast<size_t>(Config::systemSetting_t::ACTIVE_PRESET));
 
         if (getPresetPreserveState())
         {
@@ -129,6 +131,7 @@ bool database::Admin::init()
 
     if (retVal)
     {
+        updateReadCache();
         _initialized = true;
 
         if (_handlers != nullptr)
@@ -146,84 +149,385 @@ bool database::Admin::isInitialized()
 }
 
 /// Performs full factory reset of data in database.
+/// Storage is cleared first and the entire reset is performed before returning.
 bool database::Admin::factoryReset()
 {
-    if (_handlers != nullptr)
+    if (!beginFactoryReset(true))
     {
-        _handlers->factoryResetStart();
+        return false;
     }
 
-    if (!clear())
+    while (_factoryReset.active)
+    {
+        if (!updateFactoryReset())
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+/// Starts incremental factory reset.
+/// Default values are written in batches on each call of updateFactoryReset()
+/// so that the rest of the system can keep running between batches.
+/// Parameters already set to their default values aren't written again.
+/// returns: True if reset has been started, false otherwise.
+bool database::Admin::startFactoryReset()
+{
+    if (_factoryReset.active)
     {
         return false;
     }
 
-    if (INITIALIZE_DATA)
+    return beginFactoryReset(false);
+}
+
+/// Writes next batch of default values if factory reset is in progress.
+/// Defaults are written directly to storage, one storage cell at a time: parameters of bit and
+/// half-byte sections are packed into a single write instead of being updated one by one.
+/// returns: False if writing has failed, in which case reset is aborted, true otherwise.
+bool database::Admin::updateFactoryReset()
+{
+    if (!_factoryReset.active)
     {
-        auto layoutDescriptor = _layout.layout(Layout::type_t::SYSTEM);
+        return true;
+    }
 
-        // system layout first
-        if (!LessDb::setLayout(_layout.layout(Layout::type_t::SYSTEM), 0))
+    size_t written = 0;
+    size_t checked = 0;
+
+    // reads are cheap compared to writes, but bound them as well so that a single step stays short
+    while ((written < FACTORY_RESET_BATCH_SIZE) && (checked < (FACTORY_RESET_BATCH_SIZE * 8)))
+    {
+        if (_factoryReset.customInit)
         {
-            return false;
+            if (!updateCustomInit())
+            {
+                // rest of custom init is written in the next step
+                break;
+            }
+
+            if (_factoryReset.preset == 0)
+            {
+                _factoryReset.active = false;
+                setPresetInternal(0);
+
+                return endFactoryReset();
+            }
+
+            _factoryReset.preset--;
+            break;
         }
 
-        if (!initData(factoryResetType_t::FULL))
+        const auto& location = _layoutMap.sections[_factoryReset.block][_factoryReset.section];
+
+        if ((_factoryReset.cell * parametersPerCell(location.type)) < location.parameters)
         {
-            return false;
+            size_t parameters  = 0;
+            bool   cellWritten = false;
+
+            if (!resetCell(location, parameters, cellWritten))
+            {
+                return abortFactoryReset();
+            }
+
+            if (cellWritten)
+            {
+                written++;
+            }
+
+            _factoryReset.cell++;
+            _factoryReset.processed += parameters;
+            checked++;
+            continue;
+        }
+
+        _factoryReset.cell = 0;
+
+        if (++_factoryReset.section < LayoutMap::MAX_SECTIONS)
+        {
+            continue;
+        }
+
+        _factoryReset.section = 0;
+
+        if (++_factoryReset.block < static_cast<uint8_t>(Config::block_t::AMOUNT))
+        {
+            continue;
+        }
+
+        // all defaults for current preset are written, custom defaults are written in the next step
+        _factoryReset.block        = 0;
+        _factoryReset.customInit   = true;
+        _factoryReset.customWrites = 0;
+        break;
+    }
+
+    uint8_t percentage = (static_cast<uint64_t>(_factoryReset.processed) * 100) / _factoryReset.total;
+
+    if (percentage != _factoryReset.percentage)
+    {
+        _factoryReset.percentage = percentage;
+
+        if (_handlers != nullptr)
+        {
+            _handlers->factoryResetProgress(percentage);
+        }
+    }
+
+    return true;
+}
+
+/// Writes next batch of custom defaults to the preset being reset.
+/// Custom init is run from the start on each call, but only the next FACTORY_RESET_BATCH_SIZE
+/// writes are performed while the ones before and after them are skipped.
+/// returns: True once all custom defaults of the preset are written.
+bool database::Admin::updateCustomInit()
+{
+    // custom init goes through lessdb, so the preset being reset needs to be selected
+    const uint8_t ACTIVE_PRESET = _activePreset;
+
+    _factoryReset.customWriteCall = 0;
+    _factoryReset.customStep      = true;
+
+    setPresetInternal(_factoryReset.preset);
+    customInit();
+    setPresetInternal(ACTIVE_PRESET);
+
+    _factoryReset.customStep = false;
+    _factoryReset.customWrites += FACTORY_RESET_BATCH_SIZE;
+
+    if (_factoryReset.customWriteCall > _factoryReset.customWrites)
+    {
+        return false;
+    }
+
+    _factoryReset.customInit = false;
+    return true;
+}
+
+/// Checks whether the write from custom init belongs to the batch being written.
+/// All other writes are let through.
+bool database::Admin::isCustomWriteAllowed()
+{
+    if (!_factoryReset.customStep)
+    {
+        return true;
+    }
+
+    const size_t CALL = _factoryReset.customWriteCall++;
+
+    return (CALL >= _factoryReset.customWrites) && (CALL < (_factoryReset.customWrites + FACTORY_RESET_BATCH_SIZE));
+}
+
+/// Writes default value of the storage cell of the preset being reset, unless it's already set.
+/// param [in]: location        Section in which the cell is located.
+/// param [out]: parameters     Amount of parameters stored in the cell.
+/// param [out]: written        Set if the cell had to be written.
+/// returns: False if writing has failed, true otherwise.
+bool database::Admin::resetCell(const SectionAddress& location, size_t& parameters, bool& written)
+{
+    const size_t FIRST = _factoryReset.cell * parametersPerCell(location.type);
+
+    parameters = std::min(parametersPerCell(location.type), static_cast<size_t>(location.parameters) - FIRST);
+    written    = false;
+
+    uint32_t value   = 0;
+    uint32_t mask    = 0xFF;
+    uint32_t address = _userDataStartAddress + (_lastPresetAddress * _factoryReset.preset) + location.offset;
+
+    for (size_t i = 0; i < parameters; i++)
+    {
+        const uint32_t DEFAULT_VALUE = location.defaultValue + (location.autoIncrement ? (FIRST + i) : 0);
+
+        switch (location.type)
+        {
+        case sectionParameterType_t::BIT:
+        {
+            value |= (DEFAULT_VALUE & 0x01) << i;
+        }
+        break;
+
+        case sectionParameterType_t::HALF_BYTE:
+        {
+            value |= (DEFAULT_VALUE & 0x0F) << (i * 4);
+        }
+        break;
+
+        default:
+        {
+            value = DEFAULT_VALUE;
+        }
+        break;
+        }
+    }
+
+    switch (location.type)
+    {
+    case sectionParameterType_t::WORD:
+    {
+        address += _factoryReset.cell * 2;
+        mask = 0xFFFF;
+    }
+    break;
+
+    case sectionParameterType_t::DWORD:
+    {
+        address += _factoryReset.cell * 4;
+        mask = 0xFFFFFFFF;
+    }
+    break;
+
+    default:
+    {
+        address += _factoryReset.cell;
+    }
+    break;
+    }
+
+    uint32_t current = 0;
+
+    if (_readCache.read(address, current, location.type) && ((current & mask) == value))
+    {
+        return true;
+    }
+
+    if (!_readCache.write(address, value, location.type))
+    {
+        return false;
+    }
+
+    written = true;
+    return true;
+}
+
+bool database::Admin::isFactoryResetInProgress()
+{
+    return _factoryReset.active;
+}
+
+bool database::Admin::beginFactoryReset(bool clearStorage)
+{
+    if (_handlers != nullptr)
+    {
+        _handlers->factoryResetStart();
+    }
+
+    if (clearStorage)
+    {
+        if (!clear())
+        {
+            return abortFactoryReset();
+        }
+    }
+
+    if (!INITIALIZE_DATA)
+    {
+        if (!setPresetInternal(0))
+        {
+            return abortFactoryReset();
         }
 
+        return endFactoryReset();
+    }
+
+    // system layout first
+    if (!LessDb::setLayout(_layout.layout(Layout::type_t::SYSTEM), 0))
+    {
+        return abortFactoryReset();
+    }
+
+    if (!initData(factoryResetType_t::FULL))
+    {
+        return abortFactoryReset();
+    }
+
+    if (!_layoutMapValid)
+    {
+        // defaults can't be resolved without layout map - let lessdb initialize everything at once
         for (int i = _supportedPresets - 1; i >= 0; i--)
         {
             if (!setPresetInternal(i))
             {
-                return false;
+                return abortFactoryReset();
             }
 
             if (!initData(factoryResetType_t::FULL))
             {
-                return false;
+                return abortFactoryReset();
             }
 
-            // perform custom init as well
-            customInitGlobal();
-            customInitButtons();
-            customInitEncoders();
-            customInitAnalog();
-            customInitLEDs();
-            customInitDisplay();
-            customInitTouchscreen();
+            customInit();
         }
 
+        return endFactoryReset();
+    }
+
+    // presets are written directly by address, active preset stays selected until the reset is done
+    _factoryReset        = {};
+    _factoryReset.preset = _supportedPresets - 1;
+    _factoryReset.total  = _layoutMap.parameters * _supportedPresets;
+    _factoryReset.active = true;
+
+    return true;
+}
+
+/// Ends factory reset which couldn't be completed.
+/// End is still reported so that the handlers which were notified about the start don't wait for it.
+/// returns: Always false.
+bool database::Admin::abortFactoryReset()
+{
+    _factoryReset.active = false;
+
+    if (_handlers != nullptr)
+    {
+        _handlers->factoryResetDone();
+    }
+
+    return false;
+}
+
+bool database::Admin::endFactoryReset()
+{
+    if (INITIALIZE_DATA)
+    {
         if (!setPresetPreserveState(false))
         {
-            return false;
+            return abortFactoryReset();
         }
 
         if (!setUID())
         {
-            return false;
-        }
-    }
-    else
-    {
-        if (!setPresetInternal(0))
-        {
-            return false;
+            return abortFactoryReset();
         }
     }
 
+    updateReadCache();
+
     if (_handlers != nullptr)
     {
+        _handlers->factoryResetProgress(100);
         _handlers->factoryResetDone();
     }
 
     return true;
 }
 
+void database::Admin::customInit()
+{
+    customInitGlobal();
+    customInitButtons();
+    customInitEncoders();
+    customInitAnalog();
+    customInitLEDs();
+    customInitDisplay();
+    customInitTouchscreen();
+}
+
 /// Used to set new database layout (preset).
 /// param [in]: preset  New preset to set.
-/// returns: False if specified preset isn't supported, true otherwise.
+/// returns: False if specified preset isn't supported or factory reset is in progress, true otherwise.
 bool database::Admin::setPreset(uint8_t preset)
 {
     if (preset >= _supportedPresets)
@@ -231,9 +535,17 @@ bool database::Admin::setPreset(uint8_t preset)
         return false;
     }
 
+    // incremental factory reset keeps its position in the active preset
+    if (_factoryReset.active)
+    {
+        return false;
+    }
+
     _activePreset = preset;
+    updateReadCache();
 
-    auto retVal = updateSystemBlock(static_cast<size_t>(Config::systemSetting_t::ACTIVE_PRESET),
+    auto retVal = updateSystemBlock(Config::Section::system_t::SYSTEM_SETTINGS,
+                                    static_cast<size_t>(Config::systemSetting_t::ACTIVE_PRESET),
                                     preset);
 
     if (retVal)
@@ -264,6 +576,28 @@ bool database::Admin::setPresetInternal(uint8_t preset)
     return true;
 }
 
+/// Mirrors system settings and currently active preset into RAM.
+/// Rest of the system block isn't read during normal operation and isn't mirrored.
+/// Cache gets disabled if both don't fit into it, in which case all reads are served from storage.
+void database::Admin::updateReadCache()
+{
+    _readCache.mirror(SYSTEM_SETTINGS_SIZE,
+                      _userDataStartAddress + (_lastPresetAddress * _activePreset),
+                      _lastPresetAddress - _userDataStartAddress);
+}
+
+/// Checks whether system block and active preset are currently served from RAM.
+bool database::Admin::isReadCacheActive()
+{
+    return _readCache.isValid();
+}
+
+/// Checks whether user layout is read using compile-time layout map.
+bool database::Admin::isLayoutMapValid()
+{
+    return _layoutMapValid;
+}
+
 /// Retrieves currently active preset.
 uint8_t database::Admin::getPreset()
 {
@@ -282,7 +616,8 @@ uint8_t database::Admin::getSupportedPresets()
 /// Otherwise, first preset will be loaded instead.
 bool database::Admin::setPresetPreserveState(bool state)
 {
-    return updateSystemBlock(static_cast<size_t>(Config::systemSetting_t::PRESET_PRESERVE),
+    return updateSystemBlock(Config::Section::system_t::SYSTEM_SETTINGS,
+                             static_cast<size_t>(Config::systemSetting_t::PRESET_PRESERVE),
                              state);
 }
 
@@ -290,14 +625,14 @@ bool database::Admin::setPresetPreserveState(bool state)
 /// returns: True if preset preservation is enabled, false otherwise.
 bool database::Admin::getPresetPreserveState()
 {
-    return readSystemBlock(static_cast<size_t>(Config::systemSetting_t::PRESET_PRESERVE));
+    return readSystemBlock(Config::Section::system_t::SYSTEM_SETTINGS, static_cast<size_t>(Config::systemSetting_t::PRESET_PRESERVE));
 }
 
 /// Checks if database has been already initialized by checking DB_BLOCK_ID.
 /// returns: True if valid, false otherwise.
 bool database::Admin::isSignatureValid()
 {
-    uint16_t signature = readSystemBlock(static_cast<size_t>(Config::systemSetting_t::UID));
+    uint16_t signature = readSystemBlock(Config::Section::system_t::SYSTEM_SETTINGS, static_cast<size_t>(Config::systemSetting_t::UID));
 
     return _uid == signature;
 }
@@ -306,7 +641,7 @@ bool database::Admin::isSignatureValid()
 /// UID is written to first two database locations.
 bool database::Admin::setUID()
 {
-    return updateSystemBlock(static_cast<size_t>(Config::systemSetting_t::UID), _uid);
+    return updateSystemBlock(Config::Section::system_t::SYSTEM_SETTINGS, static_cast<size_t>(Config::systemSetting_t::UID), _uid);
 }
 
 void database::Admin::registerHandlers(Handlers& handlers)
@@ -403,28 +738,103 @@ std::optional<uint8_t> database::Admin::sysConfigSet(sys::Config::Section::globa
     return result;
 }
 
-uint16_t database::Admin::readSystemBlock(size_t index)
+/// Reads system block without switching lessdb to system layout, so that the read has no side effects
+/// and can be done from input core while the other core uses the database.
+/// System sections are stored as words, packed in the same way lessdb packs them.
+uint16_t database::Admin::readSystemBlock(Config::Section::system_t section, size_t index)
 {
-    uint16_t value = 0;
+    const auto& location = _layout.systemSection(section);
+    uint32_t    value    = 0;
 
-    SYSTEM_BLOCK_ENTER(
-        value = LessDb::read(0,
-                             static_cast<uint8_t>(Config::Section::system_t::SYSTEM_SETTINGS),
-                             index);)
+    if (index >= location.parameters)
+    {
+        return 0;
+    }
 
-    return value;
+    if (!_readCache.read(location.offset + (index * 2), value, sectionParameterType_t::WORD))
+    {
+        return 0;
+    }
+
+    return value & 0xFFFF;
 }
 
-bool database::Admin::updateSystemBlock(size_t index, uint16_t value)
+bool database::Admin::updateSystemBlock(Config::Section::system_t section, size_t index, uint16_t value)
 {
     bool retVal = false;
 
     SYSTEM_BLOCK_ENTER(
-        retVal = LessDb::update(0, static_cast<uint8_t>(Config::Section::system_t::SYSTEM_SETTINGS), index, value);)
+        retVal = LessDb::update(0, static_cast<uint8_t>(section), index, value);)
 
     return retVal;
 }
 
+/// Reads a parameter from the active preset using compile-time resolved section address.
+/// Parameters are packed in the same way lessdb packs them.
+bool database::Admin::readMapped(Config::block_t block, uint8_t section, size_t index, uint32_t& value)
+{
+    const auto& location = _layoutMap.sections[static_cast<size_t>(block)][section];
+
+    if (index >= location.parameters)
+    {
+        return false;
+    }
+
+    uint32_t address = _userDataStartAddress + (_lastPresetAddress * _activePreset) + location.offset;
+
+    switch (location.type)
+    {
+    case sectionParameterType_t::BIT:
+    {
+        if (!_readCache.read(address + (index >> 3), value, location.type))
+        {
+            return false;
+        }
+
+        value = (value >> (index & 0x07)) & 0x01;
+    }
+    break;
+
+    case sectionParameterType_t::HALF_BYTE:
+    {
+        if (!_readCache.read(address + (index >> 1), value, location.type))
+        {
+            return false;
+        }
+
+        value = (index & 0x01) ? ((value >> 4) & 0x0F) : (value & 0x0F);
+    }
+    break;
+
+    case sectionParameterType_t::BYTE:
+    {
+        if (!_readCache.read(address + index, value, location.type))
+        {
+            return false;
+        }
+
+        value &= 0xFF;
+    }
+    break;
+
+    case sectionParameterType_t::WORD:
+    {
+        if (!_readCache.read(address + (index * 2), value, location.type))
+        {
+            return false;
+        }
+
+        value &= 0xFFFF;
+    }
+    break;
+
+    default:
+        return _readCache.read(address + (index * 4), value, location.type);
+    }
+
+    return true;
+}
+
 __attribute__((weak)) void database::Admin::customInitGlobal()
 {
 }
@@ -20,6 +20,7 @@ limitations under the License.
 
 #include "config.h"
 #include "deps.h"
+#include "read_cache.h"
 #include "application/system/config.h"
 
 #include <type_traits>
@@ -27,7 +28,21 @@ limitations under the License.
 
 namespace database
 {
-    class Admin : public lib::lessdb::LessDb
+    namespace detail
+    {
+        /// Holds the read cache so that it's constructed before LessDb which uses it as storage.
+        class ReadCacheHolder
+        {
+            protected:
+            ReadCacheHolder(Hwa& hwa)
+                : _readCache(hwa)
+            {}
+
+            ReadCache _readCache;
+        };
+    }    // namespace detail
+
+    class Admin : private detail::ReadCacheHolder, public lib::lessdb::LessDb
     {
         public:
         Admin(Hwa&    hwa,
@@ -41,7 +56,15 @@ namespace database
         uint32_t read(T section, I index)
         {
             auto blockIndex = BLOCK(section);
-            auto value      = lib::lessdb::LessDb::read(static_cast<uint8_t>(blockIndex),
+
+            if (_layoutMapValid)
+            {
+                uint32_t value = 0;
+                readMapped(blockIndex, static_cast<uint8_t>(section), static_cast<size_t>(index), value);
+                return value;
+            }
+
+            auto value = lib::lessdb::LessDb::read(static_cast<uint8_t>(blockIndex),
                                                    static_cast<uint8_t>(section),
                                                    static_cast<size_t>(index));
 
@@ -51,13 +74,19 @@ namespace database
         template<typename I>
         uint32_t read(Config::Section::system_t section, I index)
         {
-            return readSystemBlock(static_cast<size_t>(index));
+            return readSystemBlock(section, static_cast<size_t>(index));
         }
 
         template<typename T, typename I>
         bool read(T section, I index, uint32_t& value)
         {
             auto blockIndex = BLOCK(section);
+
+            if (_layoutMapValid)
+            {
+                return readMapped(blockIndex, static_cast<uint8_t>(section), static_cast<size_t>(index), value);
+            }
+
             return lib::lessdb::LessDb::read(static_cast<uint8_t>(blockIndex),
                                              static_cast<uint8_t>(section),
                                              static_cast<size_t>(index),
@@ -67,7 +96,7 @@ namespace database
         template<typename I>
         bool read(Config::Section::system_t section, I index, uint32_t& value)
         {
-            value = readSystemBlock(static_cast<size_t>(index));
+            value = readSystemBlock(section, static_cast<size_t>(index));
             return true;
         }
 
@@ -77,6 +106,11 @@ namespace database
             auto blockIndex = BLOCK(section);
             auto newValue   = static_cast<uint32_t>(value);
 
+            if (!isCustomWriteAllowed())
+            {
+                return true;
+            }
+
             return lib::lessdb::LessDb::update(static_cast<uint8_t>(blockIndex),
                                                static_cast<uint8_t>(section),
                                                static_cast<size_t>(index),
@@ -86,17 +120,27 @@ namespace database
         template<typename I, typename V>
         bool update(Config::Section::system_t section, I index, V value)
         {
-            if (static_cast<uint8_t>(index) < static_cast<uint8_t>(Config::systemSetting_t::CUSTOM_SYSTEM_SETTING_START))
+            // settings before custom ones are managed by database itself
+            if ((section == Config::Section::system_t::SYSTEM_SETTINGS) &&
+                (static_cast<uint8_t>(index) < static_cast<uint8_t>(Config::systemSetting_t::CUSTOM_SYSTEM_SETTING_START)))
             {
                 return false;
             }
 
-            return updateSystemBlock(static_cast<size_t>(index), value);
+            if (!isCustomWriteAllowed())
+            {
+                return true;
+            }
+
+            return updateSystemBlock(section, static_cast<size_t>(index), value);
         }
 
         bool    init();
         bool    init(Handlers& handlers);
         bool    factoryReset();
+        bool    startFactoryReset();
+        bool    updateFactoryReset();
+        bool    isFactoryResetInProgress();
         uint8_t getSupportedPresets();
         bool    setPreset(uint8_t preset);
         uint8_t getPreset();
@@ -104,6 +148,13 @@ namespace database
         void    registerHandlers(Handlers& handlers);
         bool    setPresetPreserveState(bool state);
         bool    getPresetPreserveState();
+        bool    isReadCacheActive();
+        bool    isLayoutMapValid();
+
+        /// Handles configuration requests for system settings which aren't custom (active preset, preset preservation).
+        /// Called from the component which owns system settings section.
+        std::optional<uint8_t> sysConfigGet(sys::Config::Section::global_t section, size_t index, uint16_t& value);
+        std::optional<uint8_t> sysConfigSet(sys::Config::Section::global_t section, size_t index, uint16_t value);
 
         static constexpr Config::block_t BLOCK(Config::Section::global_t section)
         {
@@ -141,8 +192,30 @@ namespace database
         }
 
         private:
-        Layout&   _layout;
-        Handlers* _handlers = nullptr;
+        /// Amount of storage writes performed on single incremental factory reset step.
+        /// Emulated EEPROM stores each write as a 4-byte record, so this matches a single
+        /// 256-byte flash program page.
+        static constexpr size_t FACTORY_RESET_BATCH_SIZE = 64;
+
+        struct FactoryResetState
+        {
+            bool     active          = false;
+            uint8_t  preset          = 0;
+            uint8_t  block           = 0;
+            uint8_t  section         = 0;
+            size_t   cell            = 0;
+            uint32_t processed       = 0;
+            uint32_t total           = 0;
+            uint8_t  percentage      = 0;
+            bool     customInit      = false;    ///< Custom defaults of the preset are being written.
+            bool     customStep      = false;    ///< Custom init is running as a part of a single step.
+            size_t   customWrites    = 0;        ///< Amount of custom init writes already performed for the preset.
+            size_t   customWriteCall = 0;        ///< Index of the next custom init write in the current step.
+        };
+
+        Layout&          _layout;
+        const LayoutMap& _layoutMap;
+        Handlers*        _handlers = nullptr;
 
         const bool INITIALIZE_DATA;
 
@@ -159,6 +232,28 @@ namespace database
         uint16_t _uid              = 0;
         bool     _initialized      = false;
 
+        FactoryResetState _factoryReset = {};
+
+        /// Set once compile-time layout map is verified to match the layout lessdb has calculated.
+        /// When set, user layout is read directly from storage without lessdb address resolution.
+        bool _layoutMapValid = false;
+
+        /// Returns the amount of parameters packed in a single storage address.
+        static constexpr size_t parametersPerCell(sectionParameterType_t type)
+        {
+            switch (type)
+            {
+            case sectionParameterType_t::BIT:
+                return 8;
+
+            case sectionParameterType_t::HALF_BYTE:
+                return 2;
+
+            default:
+                return 1;
+            }
+        }
+
         void                   customInitGlobal();
         void                   customInitButtons();
         void                   customInitEncoders();
@@ -166,13 +261,20 @@ namespace database
         void                   customInitLEDs();
         void                   customInitDisplay();
         void                   customInitTouchscreen();
+        void                   customInit();
+        bool                   beginFactoryReset(bool clearStorage);
+        bool                   resetCell(const SectionAddress& location, size_t& parameters, bool& written);
+        bool                   endFactoryReset();
+        bool                   abortFactoryReset();
+        bool                   updateCustomInit();
+        bool                   isCustomWriteAllowed();
         bool                   isSignatureValid();
         bool                   setUID();
         bool                   setPresetInternal(uint8_t preset);
-        uint16_t               readSystemBlock(size_t index);
-        bool                   updateSystemBlock(size_t index, uint16_t value);
-        std::optional<uint8_t> sysConfigGet(sys::Config::Section::global_t section, size_t index, uint16_t& value);
-        std::optional<uint8_t> sysConfigSet(sys::Config::Section::global_t section, size_t index, uint16_t value);
+        void                   updateReadCache();
+        uint16_t               readSystemBlock(Config::Section::system_t section, size_t index);
+        bool                   updateSystemBlock(Config::Section::system_t section, size_t index, uint16_t value);
+        bool                   readMapped(Config::block_t block, uint8_t section, size_t index, uint32_t& value);
     };
 
     template<typename... sections>
@@ -189,23 +291,14 @@ namespace database
         typename std::enable_if<(std::is_same_v<T, sections> || ...), uint32_t>::type
         read(T section, I index)
         {
-            auto blockIndex = Admin::BLOCK(section);
-            auto value      = _admin.read(static_cast<uint8_t>(blockIndex),
-                                     static_cast<uint8_t>(section),
-                                     static_cast<size_t>(index));
-
-            return value;
+            return _admin.read(section, index);
         }
 
         template<typename T, typename I>
         typename std::enable_if<(std::is_same_v<T, sections> || ...), bool>::type
         read(T section, I index, uint32_t& value)
         {
-            auto blockIndex = Admin::BLOCK(section);
-            return _admin.read(static_cast<uint8_t>(blockIndex),
-                               static_cast<uint8_t>(section),
-                               static_cast<size_t>(index),
-                               value);
+            return _admin.read(section, index, value);
         }
 
         template<typename T, typename I, typename V>
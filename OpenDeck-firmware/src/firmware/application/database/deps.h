@@ -18,8 +18,12 @@ limitations under the License.
 
 #pragma once
 
+#include "config.h"
 #include "lib/lessdb/lessdb.h"
 
+#include <algorithm>
+#include <array>
+
 namespace database
 {
     class Hwa : public lib::lessdb::Hwa
@@ -28,6 +32,110 @@ namespace database
         virtual bool initializeDatabase() = 0;
     };
 
+    /// Compile-time description of a single database section.
+    struct SectionDescriptor
+    {
+        size_t                              parameters;
+        lib::lessdb::sectionParameterType_t type;
+        lib::lessdb::preserveSetting_t      preserve;
+        lib::lessdb::autoIncrementSetting_t autoIncrement;
+        uint32_t                            defaultValue;
+    };
+
+    /// Location and default value of a single database section, resolved at compile time.
+    struct SectionAddress
+    {
+        uint32_t                            offset        = 0;    ///< Relative to the start of the layout.
+        uint32_t                            parameters    = 0;
+        lib::lessdb::sectionParameterType_t type          = lib::lessdb::sectionParameterType_t::BYTE;
+        lib::lessdb::preserveSetting_t      preserve      = lib::lessdb::preserveSetting_t::DISABLE;
+        uint32_t                            defaultValue  = 0;
+        bool                                autoIncrement = false;
+    };
+
+    /// Flattened user layout: address of every section in every block together with total layout size.
+    /// Sections not present in the layout have zero parameters. User layout passed to lessdb is
+    /// generated from this map, so both always describe the same sections in the same order.
+    struct LayoutMap
+    {
+        static constexpr size_t MAX_SECTIONS = std::max({
+            static_cast<size_t>(Config::Section::global_t::AMOUNT),
+            static_cast<size_t>(Config::Section::button_t::AMOUNT),
+            static_cast<size_t>(Config::Section::encoder_t::AMOUNT),
+            static_cast<size_t>(Config::Section::analog_t::AMOUNT),
+            static_cast<size_t>(Config::Section::leds_t::AMOUNT),
+            static_cast<size_t>(Config::Section::i2c_t::AMOUNT),
+            static_cast<size_t>(Config::Section::touchscreen_t::AMOUNT),
+        });
+
+        std::array<std::array<SectionAddress, MAX_SECTIONS>, static_cast<size_t>(Config::block_t::AMOUNT)> sections     = {};
+        std::array<uint8_t, static_cast<size_t>(Config::block_t::AMOUNT)>                               sectionCount = {};
+        uint32_t                                                                                        size         = 0;
+        uint32_t                                                                                        parameters   = 0;
+
+        /// Calculates the amount of addresses used by section in the same way lessdb does it.
+        static constexpr uint32_t sectionSize(size_t parameters, lib::lessdb::sectionParameterType_t type)
+        {
+            switch (type)
+            {
+            case lib::lessdb::sectionParameterType_t::BIT:
+                return (parameters / 8) + ((parameters % 8) != 0);
+
+            case lib::lessdb::sectionParameterType_t::HALF_BYTE:
+                return (parameters / 2) + ((parameters % 2) != 0);
+
+            case lib::lessdb::sectionParameterType_t::BYTE:
+                return parameters;
+
+            case lib::lessdb::sectionParameterType_t::WORD:
+                return parameters * 2;
+
+            default:
+                return parameters * 4;
+            }
+        }
+
+        /// Builds the map from section descriptors of each block, in block order.
+        template<size_t... N>
+        static constexpr LayoutMap make(const std::array<SectionDescriptor, N>&... blocks)
+        {
+            static_assert(sizeof...(N) == static_cast<size_t>(Config::block_t::AMOUNT), "Invalid number of blocks");
+            static_assert(((N <= MAX_SECTIONS) && ...), "Too many sections in block");
+
+            LayoutMap map    = {};
+            size_t    block  = 0;
+            uint32_t  offset = 0;
+
+            auto add = [&](const auto& descriptors)
+            {
+                for (size_t section = 0; section < descriptors.size(); section++)
+                {
+                    map.sections[block][section].offset        = offset;
+                    map.sections[block][section].parameters    = descriptors[section].parameters;
+                    map.sections[block][section].type          = descriptors[section].type;
+                    map.sections[block][section].preserve      = descriptors[section].preserve;
+                    map.sections[block][section].defaultValue  = descriptors[section].defaultValue;
+                    map.sections[block][section].autoIncrement = descriptors[section].autoIncrement == lib::lessdb::autoIncrementSetting_t::ENABLE;
+
+                    offset += sectionSize(descriptors[section].parameters, descriptors[section].type);
+                    map.parameters += descriptors[section].parameters;
+                }
+
+                map.sectionCount[block] = static_cast<uint8_t>(descriptors.size());
+                block++;
+            };
+
+            (add(blocks), ...);
+
+            map.size = offset;
+            return map;
+        }
+    };
+
+    /// System settings are stored as words in the first section of system block, which starts at address 0.
+    constexpr inline uint32_t SYSTEM_SETTINGS_SIZE = LayoutMap::sectionSize(static_cast<size_t>(Config::systemSetting_t::AMOUNT),
+                                                                            lib::lessdb::sectionParameterType_t::WORD);
+
     // Database has circular dependency problem: to define layout, details are needed
     // from almost all application modules. At the same time, nearly all modules need database.
     // To circumvent this, Layout class is defined which needs to be injected when
@@ -44,7 +152,9 @@ namespace database
 
         virtual ~Layout() = default;
 
-        virtual std::vector<lib::lessdb::Block>& layout(type_t type) = 0;
+        virtual std::vector<lib::lessdb::Block>& layout(type_t type)                              = 0;
+        virtual const LayoutMap&                 map()                                            = 0;
+        virtual const SectionAddress&            systemSection(Config::Section::system_t section) = 0;
     };
 
     class Handlers
@@ -52,9 +162,10 @@ namespace database
         public:
         virtual ~Handlers() = default;
 
-        virtual void presetChange(uint8_t preset) = 0;
-        virtual void factoryResetStart()          = 0;
-        virtual void factoryResetDone()           = 0;
-        virtual void initialized()                = 0;
+        virtual void presetChange(uint8_t preset)             = 0;
+        virtual void factoryResetStart()                      = 0;
+        virtual void factoryResetProgress(uint8_t percentage) = 0;
+        virtual void factoryResetDone()                       = 0;
+        virtual void initialized()                            = 0;
     };
 }    // namespace database
\ No newline at end of file
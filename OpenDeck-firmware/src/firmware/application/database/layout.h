@@ -26,13 +26,22 @@ limitations under the License.
 #include "application/io/i2c/peripherals/display/common.h"
 #include "application/io/touchscreen/common.h"
 #include "application/protocol/midi/common.h"
+#include "application/system/common.h"
 
 namespace database
 {
     class AppLayout : public database::Layout
     {
         public:
-        AppLayout() = default;
+        AppLayout()
+        {
+            // blocks are added in the order of block index so that block order can't differ from the map
+            for (size_t block = 0; block < _userSections.size(); block++)
+            {
+                _userSections[block] = sections(block);
+                _userLayout.push_back({ _userSections[block] });
+            }
+        }
 
         std::vector<lib::lessdb::Block>& layout(type_t type) override
         {
@@ -46,8 +55,18 @@ namespace database
             }
         }
 
+        const LayoutMap& map() override
+        {
+            return USER_MAP;
+        }
+
+        const SectionAddress& systemSection(Config::Section::system_t section) override
+        {
+            return SYSTEM_MAP[static_cast<size_t>(section)];
+        }
+
         private:
-        std::vector<lib::lessdb::Section> _systemSections = {
+        static constexpr std::array<SectionDescriptor, static_cast<size_t>(Config::Section::system_t::AMOUNT)> SYSTEM_SECTIONS = {{
             // system section
             {
                 static_cast<uint8_t>(database::Config::systemSetting_t::AMOUNT),
@@ -56,9 +75,20 @@ namespace database
                 lib::lessdb::autoIncrementSetting_t::DISABLE,
                 0,
             },
-        };
 
-        std::vector<lib::lessdb::Section> _globalSections = {
+#ifdef PROJECT_TARGET_SAX_TABLE_UPLOAD
+            // sax table stage section: values of all fingering table sections for each entry
+            {
+                sys::SAX_FINGERING_ENTRIES * sys::SAX_TABLE_STAGE_VALUES,
+                lib::lessdb::sectionParameterType_t::WORD,
+                lib::lessdb::preserveSetting_t::DISABLE,
+                lib::lessdb::autoIncrementSetting_t::DISABLE,
+                0,
+            },
+#endif
+        }};
+
+        static constexpr std::array<SectionDescriptor, 6> GLOBAL_SECTIONS = {{
             // midi settings section
             {
                 static_cast<uint8_t>(protocol::midi::setting_t::AMOUNT),
@@ -95,9 +125,27 @@ namespace database
                 lib::lessdb::autoIncrementSetting_t::DISABLE,
                 0,
             },
-        };
 
-        std::vector<lib::lessdb::Section> _buttonSections = {
+            // section 4: care mask lo14 - keys whose state is checked, all by default
+            {
+                128,
+                lib::lessdb::sectionParameterType_t::WORD,
+                lib::lessdb::preserveSetting_t::DISABLE,
+                lib::lessdb::autoIncrementSetting_t::DISABLE,
+                0x3FFF,
+            },
+
+            // section 5: care mask hi12
+            {
+                128,
+                lib::lessdb::sectionParameterType_t::WORD,
+                lib::lessdb::preserveSetting_t::DISABLE,
+                lib::lessdb::autoIncrementSetting_t::DISABLE,
+                0x0FFF,
+            },
+        }};
+
+        static constexpr std::array<SectionDescriptor, 6> BUTTON_SECTIONS = {{
             // type section
             {
                 io::buttons::Collection::SIZE(),
@@ -151,9 +199,9 @@ namespace database
                 lib::lessdb::autoIncrementSetting_t::DISABLE,
                 0,
             },
-        };
+        }};
 
-        std::vector<lib::lessdb::Section> _encoderSections = {
+        static constexpr std::array<SectionDescriptor, 12> ENCODER_SECTIONS = {{
             // encoder enabled section
             {
                 io::encoders::Collection::SIZE(),
@@ -261,9 +309,9 @@ namespace database
                 lib::lessdb::autoIncrementSetting_t::ENABLE,
                 0,
             },
-        };
+        }};
 
-        std::vector<lib::lessdb::Section> _analogSections = {
+        static constexpr std::array<SectionDescriptor, 9> ANALOG_SECTIONS = {{
             // analog enabled section
             {
                 io::analog::Collection::SIZE(),
@@ -344,9 +392,9 @@ namespace database
                 lib::lessdb::autoIncrementSetting_t::DISABLE,
                 0,
             },
-        };
+        }};
 
-        std::vector<lib::lessdb::Section> _ledSections = {
+        static constexpr std::array<SectionDescriptor, 6> LED_SECTIONS = {{
             // global parameters section
             {
                 static_cast<size_t>(io::leds::setting_t::AMOUNT),
@@ -400,9 +448,9 @@ namespace database
                 lib::lessdb::autoIncrementSetting_t::DISABLE,
                 1,
             },
-        };
+        }};
 
-        std::vector<lib::lessdb::Section> _i2cSections = {
+        static constexpr std::array<SectionDescriptor, 1> I2C_SECTIONS = {{
             // display section
             {
                 static_cast<uint8_t>(io::i2c::display::setting_t::AMOUNT),
@@ -411,9 +459,9 @@ namespace database
                 lib::lessdb::autoIncrementSetting_t::DISABLE,
                 0,
             },
-        };
+        }};
 
-        std::vector<lib::lessdb::Section> _touchscreenSections = {
+        static constexpr std::array<SectionDescriptor, 9> TOUCHSCREEN_SECTIONS = {{
             // setting section
             {
                 static_cast<uint8_t>(io::touchscreen::setting_t::AMOUNT),
@@ -494,50 +542,136 @@ namespace database
                 lib::lessdb::autoIncrementSetting_t::DISABLE,
                 0,
             },
-        };
+        }};
 
-        std::vector<lib::lessdb::Block> _systemLayout = {
-            // system block
-            {
-                _systemSections,
-            },
-        };
+        /// User layout flattened at compile time so that section addresses don't need to be resolved on each read.
+        static constexpr LayoutMap USER_MAP = LayoutMap::make(GLOBAL_SECTIONS,
+                                                              BUTTON_SECTIONS,
+                                                              ENCODER_SECTIONS,
+                                                              ANALOG_SECTIONS,
+                                                              LED_SECTIONS,
+                                                              I2C_SECTIONS,
+                                                              TOUCHSCREEN_SECTIONS);
 
-        std::vector<lib::lessdb::Block> _userLayout = {
-            // global block
-            {
-                _globalSections,
-            },
+        static constexpr uint32_t systemSize()
+        {
+            uint32_t size = 0;
 
-            // buttons block
+            for (const auto& section : SYSTEM_SECTIONS)
             {
-                _buttonSections,
-            },
+                size += LayoutMap::sectionSize(section.parameters, section.type);
+            }
+
+            return size;
+        }
+
+        static constexpr uint32_t SYSTEM_SIZE = systemSize();
+
+        /// System block sections with their addresses, so that system block can be read
+        /// without switching lessdb to system layout. System block starts at address 0.
+        static constexpr std::array<SectionAddress, SYSTEM_SECTIONS.size()> systemMap()
+        {
+            std::array<SectionAddress, SYSTEM_SECTIONS.size()> map    = {};
+            uint32_t                                           offset = 0;
 
-            // encoder block
+            for (size_t section = 0; section < SYSTEM_SECTIONS.size(); section++)
             {
-                _encoderSections,
-            },
+                map[section].offset       = offset;
+                map[section].parameters   = SYSTEM_SECTIONS[section].parameters;
+                map[section].type         = SYSTEM_SECTIONS[section].type;
+                map[section].preserve     = SYSTEM_SECTIONS[section].preserve;
+                map[section].defaultValue = SYSTEM_SECTIONS[section].defaultValue;
+
+                offset += LayoutMap::sectionSize(SYSTEM_SECTIONS[section].parameters, SYSTEM_SECTIONS[section].type);
+            }
 
-            // analog block
+            return map;
+        }
+
+        static constexpr bool systemWords()
+        {
+            for (const auto& section : SYSTEM_SECTIONS)
             {
-                _analogSections,
-            },
+                if (section.type != lib::lessdb::sectionParameterType_t::WORD)
+                {
+                    return false;
+                }
+            }
+
+            return true;
+        }
+
+        static constexpr std::array<SectionAddress, SYSTEM_SECTIONS.size()> SYSTEM_MAP = systemMap();
 
-            // led block
+        static_assert(systemWords(), "System block is read directly as words: all system sections must use WORD parameters");
+
+        static_assert(LayoutMap::sectionSize(SYSTEM_SECTIONS[0].parameters, SYSTEM_SECTIONS[0].type) == SYSTEM_SETTINGS_SIZE,
+                      "System settings section doesn't match its expected size");
+
+#if defined(EMU_EEPROM_PAGE_SIZE)
+        // each emulated EEPROM variable occupies 4 bytes in flash page (address and value),
+        // with the first 4 bytes used for page status
+        static constexpr uint32_t NVM_SIZE_MAX = (EMU_EEPROM_PAGE_SIZE / 4) - 1;
+#elif defined(CORE_MCU_EEPROM_SIZE)
+        // last 4 bytes in eeprom are reserved for the type of firmware to boot once in bootloader
+        static constexpr uint32_t NVM_SIZE_MAX = CORE_MCU_EEPROM_SIZE - 4;
+#endif
+
+#if defined(EMU_EEPROM_PAGE_SIZE) || defined(CORE_MCU_EEPROM_SIZE)
+        // board::nvm::size() can't report more than this: system block and at least a single preset must fit
+        static_assert((SYSTEM_SIZE + USER_MAP.size) <= NVM_SIZE_MAX, "Database layout doesn't fit into non-volatile memory");
+#endif
+
+        template<size_t N>
+        static std::vector<lib::lessdb::Section> sections(const std::array<SectionDescriptor, N>& descriptors)
+        {
+            std::vector<lib::lessdb::Section> result;
+
+            for (const auto& descriptor : descriptors)
             {
-                _ledSections,
-            },
+                result.push_back({
+                    descriptor.parameters,
+                    descriptor.type,
+                    descriptor.preserve,
+                    descriptor.autoIncrement,
+                    descriptor.defaultValue,
+                });
+            }
+
+            return result;
+        }
+
+        /// Generates lessdb sections of the user block from the layout map.
+        static std::vector<lib::lessdb::Section> sections(size_t block)
+        {
+            std::vector<lib::lessdb::Section> result;
 
-            // display block
+            for (size_t section = 0; section < USER_MAP.sectionCount[block]; section++)
             {
-                _i2cSections,
-            },
+                const auto& location = USER_MAP.sections[block][section];
+
+                result.push_back({
+                    location.parameters,
+                    location.type,
+                    location.preserve,
+                    location.autoIncrement ? lib::lessdb::autoIncrementSetting_t::ENABLE : lib::lessdb::autoIncrementSetting_t::DISABLE,
+                    location.defaultValue,
+                });
+            }
+
+            return result;
+        }
 
-            // touchscreen block
+        std::vector<lib::lessdb::Section>                                                       _systemSections = sections(SYSTEM_SECTIONS);
+        std::array<std::vector<lib::lessdb::Section>, static_cast<size_t>(Config::block_t::AMOUNT)> _userSections   = {};
+
+        std::vector<lib::lessdb::Block> _systemLayout = {
+            // system block
             {
-                _touchscreenSections,
+                _systemSections,
             },
         };
+
+        std::vector<lib::lessdb::Block> _userLayout;
     };
 }    // namespace database
\ No newline at end of file
@@ -0,0 +1,198 @@
+/*
+
+Copyright Igor Petrovic
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*/
+
+#pragma once
+
+#include "deps.h"
+
+#include <array>
+
+#if defined(PROJECT_MCU_DATABASE_READ_CACHE_SIZE) && !defined(PROJECT_MCU_USE_EMU_EEPROM)
+#error Database read cache requires emulated EEPROM
+#endif
+
+namespace database
+{
+    /// Read-through RAM mirror placed between LessDb and database storage.
+    /// Two address windows are mirrored: system settings at the start of system block and currently active preset.
+    /// Once filled, all reads inside those windows are served from RAM, while writes
+    /// are always passed to storage first and mirrored only on success.
+    /// Cache is enabled only on targets using emulated EEPROM, where each address holds
+    /// a single 16-bit variable regardless of parameter type.
+    class ReadCache : public lib::lessdb::Hwa
+    {
+        public:
+        ReadCache(database::Hwa& hwa)
+            : _hwa(hwa)
+        {}
+
+        bool init() override
+        {
+            invalidate();
+            return _hwa.init();
+        }
+
+        uint32_t size() override
+        {
+            return _hwa.size();
+        }
+
+        bool clear() override
+        {
+            invalidate();
+            return _hwa.clear();
+        }
+
+        bool read(uint32_t address, uint32_t& value, lib::lessdb::sectionParameterType_t type) override
+        {
+            size_t slot = 0;
+
+            if (lookup(address, slot))
+            {
+                value = _data[slot];
+                return true;
+            }
+
+            return _hwa.read(address, value, type);
+        }
+
+        bool write(uint32_t address, uint32_t value, lib::lessdb::sectionParameterType_t type) override
+        {
+            if (!_hwa.write(address, value, type))
+            {
+                return false;
+            }
+
+            size_t slot = 0;
+
+            if (lookup(address, slot))
+            {
+                _data[slot] = value;
+            }
+
+            return true;
+        }
+
+        /// Sets mirrored address windows and fills them from storage.
+        /// System window is refilled only if its size has changed.
+        /// param [in]: systemSize  Amount of addresses mirrored from the start of system block (address 0).
+        /// param [in]: presetStart Address at which active preset starts.
+        /// param [in]: presetSize  Amount of addresses used by single preset.
+        /// returns: True if both windows fit in the cache and have been filled, false otherwise.
+        ///          On failure, cache is disabled and all reads are passed to storage.
+        bool mirror(uint32_t systemSize, uint32_t presetStart, uint32_t presetSize)
+        {
+            const bool systemValid = _valid && (systemSize == _systemSize);
+
+            _valid = false;
+
+            if ((static_cast<size_t>(systemSize) + presetSize) > CAPACITY)
+            {
+                return false;
+            }
+
+            if (!systemValid)
+            {
+                if (!fill(0, 0, systemSize))
+                {
+                    return false;
+                }
+            }
+
+            if (!fill(presetStart, systemSize, presetSize))
+            {
+                return false;
+            }
+
+            _systemSize  = systemSize;
+            _presetStart = presetStart;
+            _presetSize  = presetSize;
+            _valid       = true;
+
+            return true;
+        }
+
+        void invalidate()
+        {
+            _valid = false;
+        }
+
+        bool isValid() const
+        {
+            return _valid;
+        }
+
+        static constexpr size_t capacity()
+        {
+            return CAPACITY;
+        }
+
+        private:
+#ifdef PROJECT_MCU_DATABASE_READ_CACHE_SIZE
+        static constexpr size_t CAPACITY = PROJECT_MCU_DATABASE_READ_CACHE_SIZE;
+#else
+        static constexpr size_t CAPACITY = 0;
+#endif
+
+        database::Hwa&                 _hwa;
+        std::array<uint16_t, CAPACITY> _data        = {};
+        uint32_t                       _systemSize  = 0;
+        uint32_t                       _presetStart = 0;
+        uint32_t                       _presetSize  = 0;
+        bool                           _valid       = false;
+
+        bool lookup(uint32_t address, size_t& slot) const
+        {
+            if (!_valid)
+            {
+                return false;
+            }
+
+            if (address < _systemSize)
+            {
+                slot = address;
+                return true;
+            }
+
+            if ((address >= _presetStart) && ((address - _presetStart) < _presetSize))
+            {
+                slot = _systemSize + (address - _presetStart);
+                return true;
+            }
+
+            return false;
+        }
+
+        bool fill(uint32_t address, size_t slot, uint32_t size)
+        {
+            for (uint32_t i = 0; i < size; i++)
+            {
+                uint32_t value = 0;
+
+                if (!_hwa.read(address + i, value, lib::lessdb::sectionParameterType_t::WORD))
+                {
+                    return false;
+                }
+
+                _data[slot + i] = value;
+            }
+
+            return true;
+        }
+    };
+}    // namespace database
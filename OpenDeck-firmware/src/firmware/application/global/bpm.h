@@ -43,7 +43,7 @@ namespace global
 
             if (newBpm != _bpm)
             {
-                set(newBpm);
+                set(newBpm, _hundredths);
                 return true;
             }
 
@@ -58,7 +58,7 @@ namespace global
 
             if (newBpm != _bpm)
             {
-                set(newBpm);
+                set(newBpm, _hundredths);
                 return true;
             }
 
@@ -70,23 +70,56 @@ namespace global
             return _bpm;
         }
 
-        uint32_t bpmToUsec(uint32_t bpm)
+        /// Returns current tempo in hundredths of BPM.
+        uint32_t fixedValue()
         {
-            return 60000000 / PPQN / bpm;
+            return (static_cast<uint32_t>(_bpm) * FIXED_SCALE) + _hundredths;
         }
 
+        /// Sets fractional tempo.
+        /// param [in]: fixedBpm    Tempo in hundredths of BPM.
+        /// returns: True if tempo has changed, false otherwise.
+        bool setFixed(uint32_t fixedBpm)
+        {
+            if (fixedBpm < MIN_FIXED_BPM)
+            {
+                fixedBpm = MIN_FIXED_BPM;
+            }
+            else if (fixedBpm > MAX_FIXED_BPM)
+            {
+                fixedBpm = MAX_FIXED_BPM;
+            }
+
+            if (fixedBpm == fixedValue())
+            {
+                return false;
+            }
+
+            set(fixedBpm / FIXED_SCALE, fixedBpm % FIXED_SCALE);
+            return true;
+        }
+
+        /// Scale used for fractional tempo.
+        static constexpr uint32_t FIXED_SCALE = 100;
+
         private:
         Bpm() = default;
 
-        using BpmIncDec = util::IncDec<uint8_t, 10, 255>;
+        static constexpr uint32_t PPQN          = 24;
+        static constexpr uint8_t  MIN_BPM       = 10;
+        static constexpr uint8_t  MAX_BPM       = 255;
+        static constexpr uint32_t MIN_FIXED_BPM = static_cast<uint32_t>(MIN_BPM) * FIXED_SCALE;
+        static constexpr uint32_t MAX_FIXED_BPM = (static_cast<uint32_t>(MAX_BPM) * FIXED_SCALE) + (FIXED_SCALE - 1);
 
-        static constexpr uint32_t PPQN = 24;
+        using BpmIncDec = util::IncDec<uint8_t, MIN_BPM, MAX_BPM>;
 
-        uint8_t _bpm = 120;
+        uint8_t _bpm        = 120;
+        uint8_t _hundredths = 0;
 
-        void set(uint8_t bpm)
+        void set(uint8_t bpm, uint8_t hundredths = 0)
         {
-            _bpm = bpm;
+            _bpm        = bpm;
+            _hundredths = hundredths;
 
             messaging::Event event = {};
             event.systemMessage    = messaging::systemMessage_t::MIDI_BPM_CHANGE;
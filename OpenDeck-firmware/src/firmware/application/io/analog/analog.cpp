@@ -36,22 +36,6 @@ Analog::Analog(Hwa&      hwa,
     , _filter(filter)
     , _database(database)
 {
-    MidiDispatcher.listen(messaging::eventType_t::SYSTEM,
-                          [this](const messaging::Event& event)
-                          {
-                              switch (event.systemMessage)
-                              {
-                              case messaging::systemMessage_t::FORCE_IO_REFRESH:
-                              {
-                                  updateAll(true);
-                              }
-                              break;
-
-                              default:
-                                  break;
-                              }
-                          });
-
     ConfigHandler.registerConfig(
         sys::Config::block_t::ANALOG,
         // read
@@ -111,6 +95,11 @@ void Analog::updateSingle(size_t index, bool forceRefresh)
             return;
         }
 
+        if (_sampleHandler)
+        {
+            _sampleHandler(index, value);
+        }
+
         processReading(index, value);
     }
     else
@@ -238,6 +227,16 @@ uint16_t Analog::value(size_t index) const
     return _lastValue[index];
 }
 
+uint8_t Analog::adcBits()
+{
+    return _hwa.adcBits();
+}
+
+void Analog::registerSampleHandler(sampleHandler_t handler)
+{
+    _sampleHandler = handler;
+}
+
 bool Analog::checkPotentiometerValue(size_t index, Descriptor& descriptor)
 {
     switch (descriptor.type)
@@ -589,10 +588,9 @@ std::optional<uint8_t> Analog::sysConfigSet(sys::Config::Section::analog_t secti
         // consistent without requiring a reboot.
         if (static_cast<type_t>(value) == type_t::PITCH_BEND)
         {
-            static constexpr size_t   SAX_PB_CENTER_SETTING_INDEX = 13;
-            static constexpr uint16_t PB_CENTER_DEFAULT           = 8192;
+            static constexpr uint16_t PB_CENTER_DEFAULT = 8192;
 
-            uint32_t storedCenter = _database.readSystem(SAX_PB_CENTER_SETTING_INDEX);
+            uint32_t storedCenter = _database.readSystem(static_cast<size_t>(sys::Config::systemSetting_t::SAX_PB_CENTER));
 
             if (storedCenter > midi::MAX_VALUE_14BIT)
             {
@@ -23,6 +23,7 @@ limitations under the License.
 #include "application/system/config.h"
 #include "application/io/base.h"
 #include "application/protocol/midi/midi.h"
+#include "application/util/function/function.h"
 
 #include <optional>
 
@@ -31,6 +32,9 @@ namespace io::analog
     class Analog : public io::Base
     {
         public:
+        /// Called with each new raw ADC reading, before it is filtered.
+        using sampleHandler_t = util::Function<void(size_t index, uint16_t value)>;
+
         Analog(Hwa&      hwa,
                Filter&   filter,
                Database& database);
@@ -45,6 +49,8 @@ namespace io::analog
         void setPitchBendDeadzone(uint16_t deadzone);
 
         uint16_t value(size_t index) const;
+        uint8_t  adcBits();
+        void     registerSampleHandler(sampleHandler_t handler);
 
         private:
         struct Descriptor
@@ -73,13 +79,14 @@ namespace io::analog
             protocol::midi::messageType_t::INVALID,                 // RESERVED
         };
 
-        Hwa&      _hwa;
-        Filter&   _filter;
-        Database& _database;
-        uint8_t   _fsrPressed[Collection::SIZE() / 8 + 1] = {};
-        uint16_t  _lastValue[Collection::SIZE()]          = {};
-        uint16_t  _pitchBendCenter[Collection::SIZE()]    = {};
-        uint16_t  _pitchBendDeadzone                      = 100;
+        Hwa&            _hwa;
+        Filter&         _filter;
+        Database&       _database;
+        uint8_t         _fsrPressed[Collection::SIZE() / 8 + 1] = {};
+        uint16_t        _lastValue[Collection::SIZE()]          = {};
+        uint16_t        _pitchBendCenter[Collection::SIZE()]    = {};
+        uint16_t        _pitchBendDeadzone                      = 100;
+        sampleHandler_t _sampleHandler                          = nullptr;
 
         void                   fillDescriptor(size_t index, Descriptor& descriptor);
         void                   processReading(size_t index, uint16_t value);
@@ -43,5 +43,19 @@ namespace io
         virtual void   updateSingle(size_t index, bool forceRefresh = false) = 0;
         virtual void   updateAll(bool forceRefresh = false)                  = 0;
         virtual size_t maxComponentUpdateIndex()                             = 0;
+
+        /// Updates only the components whose inputs have changed since the last call.
+        /// returns: False if the component doesn't track changes, in which case
+        ///          all components should be updated with updateSingle() instead.
+        virtual bool updateChanged()
+        {
+            return false;
+        }
+
+        /// Processes the events which shouldn't wait until the component is updated again.
+        /// Called on each run, regardless of the component being updated.
+        virtual void processEvents()
+        {
+        }
     };
 }    // namespace io
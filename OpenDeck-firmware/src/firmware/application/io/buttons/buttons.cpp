@@ -52,6 +52,8 @@ Buttons::Buttons(Hwa&      hwa,
                               }
                               else
                               {
+                                  descriptor.event.forcedRefresh = true;
+
                                   if (descriptor.type == type_t::LATCHING)
                                   {
                                       sendMessage(index, latchingState(index), descriptor);
@@ -61,7 +63,8 @@ Buttons::Buttons(Hwa&      hwa,
                                       sendMessage(index, state(index), descriptor);
                                   }
                               }
-                          });
+                          },
+                          messaging::context_t::INPUT);
 
     MidiDispatcher.listen(messaging::eventType_t::TOUCHSCREEN_BUTTON,
                           [this](const messaging::Event& event)
@@ -73,19 +76,14 @@ Buttons::Buttons(Hwa&      hwa,
 
                               // event.value in this case contains state information only
                               processButton(index, event.value, descriptor);
-                          });
+                          },
+                          messaging::context_t::INPUT);
 
     MidiDispatcher.listen(messaging::eventType_t::SYSTEM,
                           [this](const messaging::Event& event)
                           {
                               switch (event.systemMessage)
                               {
-                              case messaging::systemMessage_t::FORCE_IO_REFRESH:
-                              {
-                                  updateAll(true);
-                              }
-                              break;
-
                               case messaging::systemMessage_t::SAX_TRANSPOSE_CHANGED:
                               {
                                   _saxTransposeRaw = core::util::CONSTRAIN(static_cast<uint16_t>(event.value),
@@ -97,7 +95,8 @@ Buttons::Buttons(Hwa&      hwa,
                               default:
                                   break;
                               }
-                          });
+                          },
+                          messaging::context_t::INPUT);
 
     ConfigHandler.registerConfig(
         sys::Config::block_t::BUTTONS,
@@ -274,38 +273,16 @@ void Buttons::updateSingle(size_t index, bool forceRefresh)
         return;
     }
 
-    Descriptor descriptor;
-
-    uint8_t  numberOfReadings = 0;
-    uint16_t states           = 0;
-
     if (!forceRefresh)
     {
-        if (!state(index, numberOfReadings, states))
-        {
-            return;
-        }
-
-        fillDescriptor(index, descriptor);
-
-        for (uint8_t reading = 0; reading < numberOfReadings; reading++)
-        {
-            // when processing, newest sample has index 0
-            // start from oldest reading which is in upper bits
-            uint8_t processIndex = numberOfReadings - 1 - reading;
-            bool    state        = (states >> processIndex) & 0x01;
-
-            if (!_filter.isFiltered(index, state))
-            {
-                continue;
-            }
-
-            processButton(index, state, descriptor);
-        }
+        updateReadings(index);
     }
     else
     {
+        Descriptor descriptor;
+
         fillDescriptor(index, descriptor);
+        descriptor.event.forcedRefresh = true;
 
         if (descriptor.type == type_t::LATCHING)
         {
@@ -331,6 +308,39 @@ size_t Buttons::maxComponentUpdateIndex()
     return Collection::SIZE(GROUP_DIGITAL_INPUTS);
 }
 
+/// Processes only the digital inputs which have changed since the last call, and the ones
+/// which still haven't been debounced, instead of going through all of them.
+bool Buttons::updateChanged()
+{
+    uint32_t changed[PENDING_WORDS] = {};
+
+    if (_hwa.changes(changed, PENDING_WORDS))
+    {
+        for (size_t i = 0; i < PENDING_WORDS; i++)
+        {
+            _pending[i] |= changed[i];
+        }
+    }
+
+    for (size_t word = 0; word < PENDING_WORDS; word++)
+    {
+        uint32_t bits = _pending[word];
+
+        while (bits)
+        {
+            auto bit = __builtin_ctz(bits);
+            bits &= bits - 1;
+
+            if (updateReadings((word * 32) + bit))
+            {
+                _pending[word] &= ~(1UL << bit);
+            }
+        }
+    }
+
+    return true;
+}
+
 /// Handles changes in button states.
 /// param [in]: index       Button index which has changed state.
 /// param [in]: descriptor  Descriptor containing the entire configuration for the button.
@@ -913,15 +923,53 @@ void Buttons::rebuildSaxFingeringKeys()
     }
 }
 
-bool Buttons::state(size_t index, uint8_t& numberOfReadings, uint16_t& states)
+/// Processes all new readings of the specified digital input.
+/// param [in]: index   Index of digital input.
+/// returns: False if the input hasn't been debounced yet and needs more readings, true otherwise.
+bool Buttons::updateReadings(size_t index)
 {
-    // if encoder under this index is enabled, just return false state each time
+    if (index >= maxComponentUpdateIndex())
+    {
+        return true;
+    }
+
+    // if encoder under this index is enabled, there is nothing to process
     if (_database.read(database::Config::Section::encoder_t::ENABLE, _hwa.buttonToEncoderIndex(index)))
+    {
+        return true;
+    }
+
+    uint8_t  numberOfReadings = 0;
+    uint16_t states           = 0;
+
+    if (!_hwa.state(index, numberOfReadings, states))
     {
         return false;
     }
 
-    return _hwa.state(index, numberOfReadings, states);
+    Descriptor descriptor;
+    bool       debounced = false;
+
+    fillDescriptor(index, descriptor);
+
+    for (uint8_t reading = 0; reading < numberOfReadings; reading++)
+    {
+        // when processing, newest sample has index 0
+        // start from oldest reading which is in upper bits
+        uint8_t processIndex = numberOfReadings - 1 - reading;
+        bool    state        = (states >> processIndex) & 0x01;
+
+        debounced = _filter.isFiltered(index, state);
+
+        if (!debounced)
+        {
+            continue;
+        }
+
+        processButton(index, state, descriptor);
+    }
+
+    return debounced;
 }
 
 std::optional<uint8_t> Buttons::sysConfigGet(sys::Config::Section::button_t section, size_t index, uint16_t& value)
@@ -39,6 +39,7 @@ namespace io::buttons
         void   updateSingle(size_t index, bool forceRefresh = false) override;
         void   updateAll(bool forceRefresh = false) override;
         size_t maxComponentUpdateIndex() override;
+        bool   updateChanged() override;
         void   reset(size_t index);
 
         bool isPressed(size_t index) const;
@@ -106,6 +107,10 @@ namespace io::buttons
         uint8_t   _lastLatchingState[Collection::SIZE() / 8 + 1] = {};
         uint8_t   _incDecValue[Collection::SIZE()]               = {};
 
+        // digital inputs which have changed, but haven't been debounced yet
+        static constexpr size_t PENDING_WORDS = Collection::SIZE(GROUP_DIGITAL_INPUTS) / 32 + 1;
+        uint32_t                _pending[PENDING_WORDS] = {};
+
         // Cached sax transpose value (raw 0..48 which represents -24..+24 semitones).
         // Synced from System via SYSTEM event (SAX_TRANSPOSE_CHANGED).
         uint16_t  _saxTransposeRaw = 24;
@@ -115,7 +120,7 @@ namespace io::buttons
         uint8_t _saxFingeringKeyCount = 0;
 
         bool                   state(size_t index);
-        bool                   state(size_t index, uint8_t& numberOfReadings, uint16_t& states);
+        bool                   updateReadings(size_t index);
         void                   fillDescriptor(size_t index, Descriptor& descriptor);
         void                   processButton(size_t index, bool reading, Descriptor& descriptor);
         void                   sendMessage(size_t index, bool state, Descriptor& descriptor);
@@ -35,6 +35,10 @@ namespace io::buttons
         // should return true if the value has been refreshed, false otherwise
         virtual bool   state(size_t index, uint8_t& numberOfReadings, uint16_t& states) = 0;
         virtual size_t buttonToEncoderIndex(size_t index)                               = 0;
+
+        // should mark the inputs which have changed since the last call (one bit per input)
+        // and return true if at least one of them has changed
+        virtual bool changes(uint32_t* changed, size_t words) = 0;
     };
 
     class Filter
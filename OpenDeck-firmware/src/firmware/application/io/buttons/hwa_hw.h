@@ -48,6 +48,11 @@ namespace io::buttons
             return board::io::digital_in::encoderFromInput(index);
         }
 
+        bool changes(uint32_t* changed, size_t words) override
+        {
+            return board::io::digital_in::changes(changed, nullptr, words);
+        }
+
         private:
         board::io::digital_in::Readings _dInRead;
     };
@@ -36,5 +36,10 @@ namespace io::buttons
         {
             return 0;
         }
+
+        bool changes(uint32_t* changed, size_t words) override
+        {
+            return false;
+        }
     };
 }    // namespace io::buttons
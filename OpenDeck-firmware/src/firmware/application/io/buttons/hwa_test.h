@@ -30,6 +30,7 @@ namespace io::buttons
         HwaTest() = default;
 
         MOCK_METHOD3(state, bool(size_t index, uint8_t& numberOfReadings, uint16_t& states));
+        MOCK_METHOD2(changes, bool(uint32_t* changed, size_t words));
 
         size_t buttonToEncoderIndex(size_t index) override
         {
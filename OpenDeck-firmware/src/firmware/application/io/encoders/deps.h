@@ -32,8 +32,9 @@ namespace io::encoders
         public:
         virtual ~Hwa() = default;
 
-        // should return true if the value has been refreshed, false otherwise
-        virtual bool state(size_t index, uint8_t& numberOfReadings, uint16_t& states) = 0;
+        // should return true if the encoder has moved since the last call, false otherwise
+        // pulses are signed (positive values are counter-clockwise), time is in microseconds
+        virtual bool pulses(size_t index, int8_t& pulses, uint32_t& time) = 0;
     };
 
     class Filter
@@ -46,7 +47,6 @@ namespace io::encoders
                                 position_t& filteredPosition,
                                 uint32_t    sampleTakenTime) = 0;
 
-        virtual void     reset(size_t index)            = 0;
-        virtual uint32_t lastMovementTime(size_t index) = 0;
+        virtual void reset(size_t index) = 0;
     };
 }    // namespace io::encoders
\ No newline at end of file
@@ -23,7 +23,6 @@ limitations under the License.
 #include "application/util/configurable/configurable.h"
 #include "application/global/bpm.h"
 
-#include "core/mcu.h"
 #include "core/util/util.h"
 
 using namespace io::encoders;
@@ -31,12 +30,10 @@ using namespace protocol;
 
 Encoders::Encoders(Hwa&      hwa,
                    Filter&   filter,
-                   Database& database,
-                   uint32_t  timeDiffTimeout)
+                   Database& database)
     : _hwa(hwa)
     , _filter(filter)
     , _database(database)
-    , TIME_DIFF_READOUT(timeDiffTimeout)
 {
     MidiDispatcher.listen(messaging::eventType_t::MIDI_IN,
                           [this](const messaging::Event& event)
@@ -86,7 +83,28 @@ Encoders::Encoders(Hwa&      hwa,
                               default:
                                   break;
                               }
-                          });
+                          },
+                          messaging::context_t::INPUT);
+
+    MidiDispatcher.listen(messaging::eventType_t::SYSTEM,
+                          [this](const messaging::Event& event)
+                          {
+                              switch (event.systemMessage)
+                              {
+                              case messaging::systemMessage_t::PRESET_CHANGED:
+                              {
+                                  for (size_t i = 0; i < Collection::SIZE(); i++)
+                                  {
+                                      cacheSettings(i);
+                                  }
+                              }
+                              break;
+
+                              default:
+                                  break;
+                              }
+                          },
+                          messaging::context_t::INPUT);
 
     ConfigHandler.registerConfig(
         sys::Config::block_t::ENCODERS,
@@ -120,36 +138,21 @@ void Encoders::updateSingle(size_t index, bool forceRefresh)
         return;
     }
 
-    if (!_database.read(database::Config::Section::encoder_t::ENABLE, index))
+    int8_t   pulses = 0;
+    uint32_t time   = 0;
+
+    // pulses are read even from disabled encoders so that they don't pile up
+    if (!_hwa.pulses(index, pulses, time))
     {
         return;
     }
 
-    uint8_t  numberOfReadings = 0;
-    uint16_t states           = 0;
-
-    if (!_hwa.state(index, numberOfReadings, states))
+    if (!_database.read(database::Config::Section::encoder_t::ENABLE, index))
     {
         return;
     }
 
-    uint32_t currentTime = core::mcu::timing::ms();
-
-    for (uint8_t reading = 0; reading < numberOfReadings; reading++)
-    {
-        // take into account that there is a 1ms difference between readouts
-        // when processing, newest sample has index 0
-        // start from oldest reading which is in upper bits
-        uint8_t  processIndex = numberOfReadings - 1 - reading;
-        uint32_t sampleTime   = currentTime - (TIME_DIFF_READOUT * processIndex);
-
-        // there are two readings per encoder
-        uint8_t pairState = states >> (processIndex * 2);
-        pairState &= 0x03;
-
-        // when processing, newest sample has index 0
-        processReading(index, pairState, sampleTime);
-    }
+    processPulses(index, pulses, time);
 }
 
 void Encoders::updateAll(bool forceRefresh)
@@ -165,57 +168,132 @@ size_t Encoders::maxComponentUpdateIndex()
     return Collection::SIZE();
 }
 
-void Encoders::processReading(size_t index, uint8_t pairValue, uint32_t sampleTime)
+/// Converts all pulses decoded since the last update to steps.
+/// Messages carrying absolute value are sent only once for all the steps, while
+/// relative messages are sent for each step.
+/// param [in]: index   Encoder which is being processed.
+/// param [in]: pulses  Pulses decoded since the last update.
+/// param [in]: time    Time in microseconds of the last pulse.
+void Encoders::processPulses(size_t index, int8_t pulses, uint32_t time)
 {
-    auto position = read(index, pairValue);
+    const int16_t PULSES_PER_STEP = _pulsesPerStep[index] ? _pulsesPerStep[index] : 1;
+
+    _encoderPulses[index] += pulses;
 
-    if (_filter.isFiltered(index, position, position, sampleTime))
+    const int16_t STEPS = _encoderPulses[index] / PULSES_PER_STEP;
+
+    if (!STEPS)
     {
-        if (position != position_t::STOPPED)
+        return;
+    }
+
+    _encoderPulses[index] -= STEPS * PULSES_PER_STEP;
+
+    const auto     DIRECTION = (STEPS > 0) ? position_t::CCW : position_t::CW;
+    const uint16_t COUNT     = abs(STEPS);
+
+    // steps made at once are assumed to be evenly spaced since the previous one
+    const uint32_t STEP_TIME = (time - _lastStepTime[index]) / COUNT;
+    _lastStepTime[index]     = time;
+
+    const bool INVERT = _database.read(database::Config::Section::encoder_t::INVERT, index);
+    Descriptor descriptor;
+    bool       send = false;
+
+    for (uint16_t step = 0; step < COUNT; step++)
+    {
+        auto position = DIRECTION;
+
+        if (!_filter.isFiltered(index, position, position, time))
         {
-            if (_database.read(database::Config::Section::encoder_t::INVERT, index))
+            continue;
+        }
+
+        if (INVERT)
+        {
+            if (position == position_t::CCW)
+            {
+                position = position_t::CW;
+            }
+            else
             {
-                if (position == position_t::CCW)
-                {
-                    position = position_t::CW;
-                }
-                else
-                {
-                    position = position_t::CCW;
-                }
+                position = position_t::CCW;
             }
+        }
 
-            uint8_t encAcceleration = _database.read(database::Config::Section::encoder_t::ACCELERATION, index);
+        accelerate(index, STEP_TIME);
+        fillDescriptor(index, position, descriptor);
 
-            if (encAcceleration)
+        switch (descriptor.type)
+        {
+        case type_t::PROGRAM_CHANGE:
+        case type_t::CONTROL_CHANGE:
+        case type_t::PITCH_BEND:
+        case type_t::NRPN_7BIT:
+        case type_t::NRPN_14BIT:
+        case type_t::CONTROL_CHANGE_14BIT:
+        case type_t::BPM_CHANGE:
+        case type_t::SINGLE_NOTE_VARIABLE_VAL:
+        {
+            // only the last value is sent
+            if (fillValue(index, position, descriptor))
             {
-                // when time difference between two movements is smaller than ENCODERS_SPEED_TIMEOUT,
-                // start accelerating
-                if ((sampleTime - _filter.lastMovementTime(index)) < ENCODERS_SPEED_TIMEOUT)
-                {
-                    _encoderSpeed[index] = core::util::CONSTRAIN(static_cast<uint8_t>(_encoderSpeed[index] + ENCODER_SPEED_CHANGE[encAcceleration]),
-                                                                 static_cast<uint8_t>(0),
-                                                                 ENCODER_ACC_STEP_INC[encAcceleration]);
-                }
-                else
-                {
-                    _encoderSpeed[index] = 0;
-                }
+                send = true;
             }
+        }
+        break;
 
-            Descriptor descriptor;
-            fillDescriptor(index, position, descriptor);
-
-            sendMessage(index, position, descriptor);
+        default:
+        {
+            if (fillValue(index, position, descriptor))
+            {
+                MidiDispatcher.notify(descriptor.eventType, descriptor.event);
+            }
+        }
+        break;
         }
     }
+
+    if (send)
+    {
+        MidiDispatcher.notify(descriptor.eventType, descriptor.event);
+    }
+}
+
+/// Updates the speed of encoder based on the time between two steps.
+/// param [in]: index       Encoder which is being processed.
+/// param [in]: stepTime    Time in microseconds since the previous step.
+void Encoders::accelerate(size_t index, uint32_t stepTime)
+{
+    const uint8_t ACCELERATION = _acceleration[index];
+
+    if (!ACCELERATION)
+    {
+        return;
+    }
+
+    // when time difference between two movements is smaller than ENCODERS_SPEED_TIMEOUT,
+    // start accelerating
+    if (stepTime < ENCODERS_SPEED_TIMEOUT)
+    {
+        _encoderSpeed[index] = core::util::CONSTRAIN(static_cast<uint8_t>(_encoderSpeed[index] + ENCODER_SPEED_CHANGE[ACCELERATION]),
+                                                     static_cast<uint8_t>(0),
+                                                     ENCODER_ACC_STEP_INC[ACCELERATION]);
+    }
+    else
+    {
+        _encoderSpeed[index] = 0;
+    }
 }
 
-void Encoders::sendMessage(size_t index, position_t position, Descriptor& descriptor)
+/// Applies single step to the encoder and fills the message value.
+/// returns: True if the message should be sent.
+bool Encoders::fillValue(size_t index, position_t position, Descriptor& descriptor)
 {
-    auto    eventType = messaging::eventType_t::ENCODER;
-    bool    send      = true;
-    uint8_t steps     = (_encoderSpeed[index] > 0) ? _encoderSpeed[index] : 1;
+    bool    send  = true;
+    uint8_t steps = (_encoderSpeed[index] > 0) ? _encoderSpeed[index] : 1;
+
+    descriptor.eventType = messaging::eventType_t::ENCODER;
 
     switch (descriptor.type)
     {
@@ -344,7 +422,7 @@ void Encoders::sendMessage(size_t index, position_t position, Descriptor& descri
 
     case type_t::PRESET_CHANGE:
     {
-        eventType                      = messaging::eventType_t::SYSTEM;
+        descriptor.eventType           = messaging::eventType_t::SYSTEM;
         descriptor.event.systemMessage = (position == position_t::CW)
                                              ? messaging::systemMessage_t::PRESET_CHANGE_INC_REQ
                                              : messaging::systemMessage_t::PRESET_CHANGE_DEC_REQ;
@@ -379,10 +457,7 @@ void Encoders::sendMessage(size_t index, position_t position, Descriptor& descri
     break;
     }
 
-    if (send)
-    {
-        MidiDispatcher.notify(eventType, descriptor.event);
-    }
+    return send;
 }
 
 /// Sets the MIDI value of specified encoder to default.
@@ -399,8 +474,10 @@ void Encoders::reset(size_t index)
 
     _filter.reset(index);
     _encoderSpeed[index]  = 0;
-    _encoderData[index]   = 0;
     _encoderPulses[index] = 0;
+    _lastStepTime[index]  = 0;
+
+    cacheSettings(index);
 }
 
 void Encoders::setValue(size_t index, uint16_t value)
@@ -408,44 +485,10 @@ void Encoders::setValue(size_t index, uint16_t value)
     _value[index] = value;
 }
 
-/// Checks state of requested encoder.
-/// param [in]: index           Encoder which is being checked.
-/// param [in]: pairState       A and B signal readings from encoder placed into bits 0 and 1.
-/// returns: Encoder direction. See position_t.
-position_t Encoders::read(size_t index, uint8_t pairState)
+void Encoders::cacheSettings(size_t index)
 {
-    auto retVal = position_t::STOPPED;
-    pairState &= 0x03;
-
-    // add new data
-
-    bool process = true;
-
-    // only process the data from encoder if there is a previous reading stored
-    if (!core::util::BIT_READ(_encoderData[index], 7))
-    {
-        process = false;
-    }
-
-    _encoderData[index] <<= 2;
-    _encoderData[index] |= pairState;
-    _encoderData[index] |= 0x80;
-
-    if (!process)
-    {
-        return retVal;
-    }
-
-    _encoderPulses[index] += ENCODER_LOOK_UP_TABLE[_encoderData[index] & 0x0F];
-
-    if (abs(_encoderPulses[index]) >= static_cast<int32_t>(_database.read(database::Config::Section::encoder_t::PULSES_PER_STEP, index)))
-    {
-        retVal = (_encoderPulses[index] > 0) ? position_t::CCW : position_t::CW;
-        // reset count
-        _encoderPulses[index] = 0;
-    }
-
-    return retVal;
+    _pulsesPerStep[index] = _database.read(database::Config::Section::encoder_t::PULSES_PER_STEP, index);
+    _acceleration[index]  = _database.read(database::Config::Section::encoder_t::ACCELERATION, index);
 }
 
 void Encoders::fillDescriptor(size_t index, position_t position, Descriptor& descriptor)
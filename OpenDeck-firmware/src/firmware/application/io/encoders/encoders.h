@@ -35,8 +35,7 @@ namespace io::encoders
         public:
         Encoders(Hwa&      hwa,
                  Filter&   filter,
-                 Database& database,
-                 uint32_t  timeDiffTimeout = 1);
+                 Database& database);
 
         bool   init() override;
         void   updateSingle(size_t index, bool forceRefresh = false) override;
@@ -47,35 +46,16 @@ namespace io::encoders
         private:
         struct Descriptor
         {
-            type_t           type  = type_t::CONTROL_CHANGE_7FH01H;
-            messaging::Event event = {};
+            type_t                 type      = type_t::CONTROL_CHANGE_7FH01H;
+            messaging::eventType_t eventType = messaging::eventType_t::ENCODER;
+            messaging::Event       event     = {};
         };
 
         using ValueIncDecMIDI7Bit  = util::IncDec<uint8_t, 0, protocol::midi::MAX_VALUE_7BIT>;
         using ValueIncDecMIDI14Bit = util::IncDec<uint16_t, 0, protocol::midi::MAX_VALUE_14BIT>;
 
-        /// Time threshold in milliseconds between two encoder steps used to detect fast movement.
-        static constexpr uint32_t ENCODERS_SPEED_TIMEOUT = 140;
-
-        /// Lookup table used to convert encoder reading to pulses.
-        static constexpr int8_t ENCODER_LOOK_UP_TABLE[16] = {
-            0,     // 0000
-            1,     // 0001
-            -1,    // 0010
-            0,     // 0011
-            -1,    // 0100
-            0,     // 0101
-            0,     // 0110
-            1,     // 0111
-            1,     // 1000
-            0,     // 1001
-            0,     // 1010
-            -1,    // 1011
-            0,     // 1100
-            -1,    // 1101
-            1,     // 1110
-            0      // 1111
-        };
+        /// Time threshold in microseconds between two encoder steps used to detect fast movement.
+        static constexpr uint32_t ENCODERS_SPEED_TIMEOUT = 140000;
 
         /// Used to achieve linear encoder acceleration on fast movement.
         /// Every time fast movement is detected, amount of steps is increased by this value.
@@ -136,26 +116,28 @@ namespace io::encoders
         Filter&   _filter;
         Database& _database;
 
-        /// Time difference betweeen multiple encoder readouts in milliseconds.
-        const uint32_t TIME_DIFF_READOUT;
-
         /// Holds current value for all encoders.
         int16_t _value[Collection::SIZE()] = { 0 };
 
         /// Array holding current speed (in steps) for all encoders.
         uint8_t _encoderSpeed[Collection::SIZE()] = {};
 
-        /// Array holding last two readings from encoder pins.
-        uint8_t _encoderData[Collection::SIZE()] = {};
+        /// Array holding pulses which haven't formed a whole step yet for all encoders.
+        int16_t _encoderPulses[Collection::SIZE()] = {};
+
+        /// Array holding the time in microseconds of the last step for all encoders.
+        uint32_t _lastStepTime[Collection::SIZE()] = {};
 
-        /// Array holding current amount of pulses for all encoders.
-        int8_t _encoderPulses[Collection::SIZE()] = {};
+        /// Settings used on each movement, cached so that the database isn't read for every step.
+        uint8_t _pulsesPerStep[Collection::SIZE()] = {};
+        uint8_t _acceleration[Collection::SIZE()]  = {};
 
         void                   fillDescriptor(size_t index, position_t position, Descriptor& descriptor);
-        position_t             read(size_t index, uint8_t pairState);
-        void                   processReading(size_t index, uint8_t pairValue, uint32_t sampleTime);
-        void                   sendMessage(size_t index, position_t position, Descriptor& descriptor);
+        void                   processPulses(size_t index, int8_t pulses, uint32_t time);
+        void                   accelerate(size_t index, uint32_t stepTime);
+        bool                   fillValue(size_t index, position_t position, Descriptor& descriptor);
         void                   setValue(size_t index, uint16_t value);
+        void                   cacheSettings(size_t index);
         std::optional<uint8_t> sysConfigGet(sys::Config::Section::encoder_t section, size_t index, uint16_t& value);
         std::optional<uint8_t> sysConfigSet(sys::Config::Section::encoder_t section, size_t index, uint16_t value);
     };
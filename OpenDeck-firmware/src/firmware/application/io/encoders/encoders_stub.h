@@ -27,8 +27,7 @@ namespace io::encoders
         public:
         Encoders(Hwa&      hwa,
                  Filter&   filter,
-                 Database& database,
-                 uint32_t  timeDiffTimeout = 1)
+                 Database& database)
         {}
 
         bool init() override
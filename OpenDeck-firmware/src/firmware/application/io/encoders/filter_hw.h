@@ -37,7 +37,7 @@ namespace io::encoders
             filteredPosition = position;
 
             // disable debouncing mode if encoder isn't moving for more than
-            // ENCODERS_DEBOUNCE_RESET_TIME milliseconds
+            // ENCODERS_DEBOUNCE_RESET_TIME microseconds
             if ((sampleTakenTime - _lastMovementTime[index]) > ENCODERS_DEBOUNCE_RESET_TIME)
             {
                 reset(index);
@@ -81,14 +81,9 @@ namespace io::encoders
             _debounceDirection[index] = position_t::STOPPED;
         }
 
-        uint32_t lastMovementTime(size_t index) override
-        {
-            return _lastMovementTime[index];
-        }
-
         private:
-        /// Time in milliseconds after which debounce mode is reset if encoder isn't moving.
-        static constexpr uint32_t ENCODERS_DEBOUNCE_RESET_TIME = 50;
+        /// Time in microseconds after which debounce mode is reset if encoder isn't moving.
+        static constexpr uint32_t ENCODERS_DEBOUNCE_RESET_TIME = 50000;
 
         /// Number of times movement in the same direction must be registered in order
         /// for debouncer to become active. Once the debouncer is active, all further changes
@@ -106,7 +101,7 @@ namespace io::encoders
         /// Used to detect constant rotation in single direction.
         /// Once n consecutive movements in same direction are detected,
         /// all further movements are assumed to have same direction until
-        /// encoder stops moving for ENCODERS_DEBOUNCE_RESET_TIME milliseconds *or*
+        /// encoder stops moving for ENCODERS_DEBOUNCE_RESET_TIME microseconds *or*
         /// n new consecutive movements are made in the opposite direction.
         /// n = ENCODERS_DEBOUNCE_COUNT (defined in Constants.h)
         uint8_t _debounceCounter[Collection::SIZE()] = {};
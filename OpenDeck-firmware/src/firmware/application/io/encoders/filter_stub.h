@@ -38,10 +38,5 @@ namespace io::encoders
         void reset(size_t index) override
         {
         }
-
-        uint32_t lastMovementTime(size_t index) override
-        {
-            return 0;
-        }
     };
 }    // namespace io::encoders
\ No newline at end of file
@@ -21,8 +21,6 @@ limitations under the License.
 #include "deps.h"
 #include "board/board.h"
 
-#include "core/util/util.h"
-
 namespace io::encoders
 {
     class HwaHw : public Hwa
@@ -30,42 +28,19 @@ namespace io::encoders
         public:
         HwaHw() = default;
 
-        bool state(size_t index, uint8_t& numberOfReadings, uint16_t& states) override
+        bool pulses(size_t index, int8_t& pulses, uint32_t& time) override
         {
-            if (!board::io::digital_in::state(board::io::digital_in::encoderComponentFromEncoder(index,
-                                                                                                 board::io::digital_in::encoderComponent_t::A),
-                                              _dInReadA))
-            {
-                return false;
-            }
+            board::io::digital_in::EncoderPulses encoderPulses;
 
-            if (!board::io::digital_in::state(board::io::digital_in::encoderComponentFromEncoder(index,
-                                                                                                 board::io::digital_in::encoderComponent_t::B),
-                                              _dInReadB))
+            if (!board::io::digital_in::encoderPulses(index, encoderPulses))
             {
                 return false;
             }
 
-            numberOfReadings = _dInReadA.count > _dInReadB.count ? _dInReadA.count : _dInReadB.count;
-
-            /*
-                Construct encoder pair readings:
-                * Encoder signal is made of A and B signals
-                * Take each bit of A signal and B signal and append it to states variable in order
-                * Latest encoder readings should be in LSB bits
-            */
-
-            for (uint8_t i = 0; i < numberOfReadings; i++)
-            {
-                core::util::BIT_WRITE(states, (i * 2) + 1, (_dInReadA.readings >> i & 0x01));
-                core::util::BIT_WRITE(states, i * 2, (_dInReadB.readings >> i & 0x01));
-            }
+            pulses = encoderPulses.pulses;
+            time   = encoderPulses.time;
 
             return true;
         }
-
-        private:
-        board::io::digital_in::Readings _dInReadA;
-        board::io::digital_in::Readings _dInReadB;
     };
 }    // namespace io::encoders
@@ -27,7 +27,7 @@ namespace io::encoders
         public:
         HwaStub() = default;
 
-        bool state(size_t index, uint8_t& numberOfReadings, uint16_t& states) override
+        bool pulses(size_t index, int8_t& pulses, uint32_t& time) override
         {
             return false;
         }
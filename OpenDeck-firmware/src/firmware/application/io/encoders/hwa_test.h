@@ -29,6 +29,6 @@ namespace io::encoders
         public:
         HwaTest() = default;
 
-        MOCK_METHOD3(state, bool(size_t index, uint8_t& numberOfReadings, uint16_t& states));
+        MOCK_METHOD3(pulses, bool(size_t index, int8_t& pulses, uint32_t& time));
     };
 }    // namespace io::encoders
@@ -57,6 +57,9 @@ Display::Display(Hwa&      hwa,
 
 bool Display::init()
 {
+    // refresh is started again below once the display is ready
+    TaskScheduler.cancel(_refreshTask);
+
     if (!_hwa.init())
     {
         return false;
@@ -103,8 +106,8 @@ bool Display::init()
         {
             if (_database.read(database::Config::Section::i2c_t::DISPLAY, setting_t::DEVICE_INFO_MSG) && !_startupInfoShown)
             {
+                // display is cleared from update() once the message has been shown long enough
                 displayWelcomeMessage();
-                u8x8_ClearDisplay(&_u8x8);
             }
         }
 
@@ -112,6 +115,12 @@ bool Display::init()
                                                                setting_t::MIDI_NOTES_ALTERNATE));
         _elements._preset.setPreset(_database.getPreset());
         _elements.setRetentionTime(_database.read(database::Config::Section::i2c_t::DISPLAY, setting_t::EVENT_TIME) * 1000);
+
+        // with welcome message, refresh is started once the message is cleared
+        if (!TaskScheduler.isRegistered(_welcomeTask))
+        {
+            startRefresh();
+        }
     }
     else
     {
@@ -246,18 +255,33 @@ bool Display::deInit()
     _rows        = 0;
     _initialized = false;
 
+    TaskScheduler.cancel(_refreshTask);
+    TaskScheduler.cancel(_welcomeTask);
+
     return true;
 }
 
-/// Checks if LCD requires updating continuously.
+/// Display is refreshed periodically from the scheduler (see startRefresh()). Registration of the
+/// refresh task fails if the scheduler is full: it's retried here until the task is running.
 void Display::update()
 {
-    if (!_initialized)
+    if (!_initialized || TaskScheduler.isRegistered(_refreshTask) || TaskScheduler.isRegistered(_welcomeTask))
     {
         return;
     }
 
-    _elements.update();
+    startRefresh();
+}
+
+/// Starts periodic refresh of all display elements.
+void Display::startRefresh()
+{
+    TaskScheduler.registerPeriodicTask(_refreshTask,
+                                       Elements::REFRESH_TIME,
+                                       [this]()
+                                       {
+                                           _elements.update();
+                                       });
 }
 
 /// Calculates position on which text needs to be set on display to be in center of display row.
@@ -338,7 +362,13 @@ void Display::displayWelcomeMessage()
         welcomeMs = 3000UL;
     }
 
-    core::mcu::timing::waitMs(welcomeMs);
+    TaskScheduler.registerTask(_welcomeTask,
+                               welcomeMs,
+                               [this]()
+                               {
+                                   u8x8_ClearDisplay(&_u8x8);
+                                   startRefresh();
+                               });
 }
 
 std::optional<uint8_t> Display::sysConfigGet(sys::Config::Section::i2c_t section, size_t index, uint16_t& value)
@@ -24,6 +24,7 @@ limitations under the License.
 #include "application/messaging/messaging.h"
 #include "application/system/config.h"
 #include "application/protocol/midi/common.h"
+#include "application/util/scheduler/scheduler.h"
 
 #include "core/util/util.h"
 #include <u8x8.h>
@@ -517,7 +518,6 @@ namespace io::i2c::display
             SaxType             _saxType;
             InMessageIndicator  _inMessageIndicator;
             OutMessageIndicator _outMessageIndicator;
-            uint32_t            _lastRefreshTime      = 0;
             uint32_t            _messageRetentionTime = 0;
             bool                _messageDisplayedIn   = false;
             bool                _messageDisplayedOut  = false;
@@ -534,22 +534,25 @@ namespace io::i2c::display
 
         friend class Elements;
 
-        Hwa&                _hwa;
-        Database&           _database;
-        database::Admin&    _admin;
-        u8x8_t              _u8x8;
-        Elements            _elements                     = Elements(*this);
-        uint8_t             _u8x8Buffer[U8X8_BUFFER_SIZE] = {};
-        size_t              _u8x8Counter                  = 0;
-        displayResolution_t _resolution                   = displayResolution_t::AMOUNT;
-        bool                _initialized                  = false;
-        bool                _startupInfoShown             = false;
-        uint8_t             _selectedI2Caddress           = 0;
-        size_t              _rows                         = 0;
+        Hwa&                      _hwa;
+        Database&                 _database;
+        database::Admin&          _admin;
+        u8x8_t                    _u8x8;
+        Elements                  _elements                     = Elements(*this);
+        uint8_t                   _u8x8Buffer[U8X8_BUFFER_SIZE] = {};
+        size_t                    _u8x8Counter                  = 0;
+        displayResolution_t       _resolution                   = displayResolution_t::AMOUNT;
+        bool                      _initialized                  = false;
+        bool                      _startupInfoShown             = false;
+        uint8_t                   _selectedI2Caddress           = 0;
+        size_t                    _rows                         = 0;
+        util::Scheduler::handle_t _refreshTask                  = util::Scheduler::INVALID_HANDLE;
+        util::Scheduler::handle_t _welcomeTask                  = util::Scheduler::INVALID_HANDLE;
 
         bool                   initU8X8(uint8_t i2cAddress, displayController_t controller, displayResolution_t resolution);
         bool                   deInit();
         void                   displayWelcomeMessage();
+        void                   startRefresh();
         uint8_t                getTextCenter(uint8_t textSize);
         std::optional<uint8_t> sysConfigGet(sys::Config::Section::i2c_t section, size_t index, uint16_t& value);
         std::optional<uint8_t> sysConfigSet(sys::Config::Section::i2c_t section, size_t index, uint16_t value);
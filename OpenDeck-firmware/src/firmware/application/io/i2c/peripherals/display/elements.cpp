@@ -28,12 +28,7 @@ using namespace protocol;
 
 void Display::Elements::update()
 {
-    if ((core::mcu::timing::ms() - _lastRefreshTime) < REFRESH_TIME)
-    {
-        return;    // we don't need to update lcd in real time
-    }
-
-    const auto nowMs = core::mcu::timing::ms();
+    // called every REFRESH_TIME from the scheduler - we don't need to update lcd in real time
 
 #ifdef PROJECT_TARGET_SUPPORT_USB
     const bool usbConnected = board::usb::isUsbConnected();
@@ -49,16 +44,14 @@ void Display::Elements::update()
 
     int8_t transposeSemisForTopBar = 0;
 
-    // Sax transpose status (custom system setting index 11):
-    // stored as 0..48 where 24 == 0 semitones.
+    // Sax transpose status: stored as 0..48 where 24 == 0 semitones.
     {
-        static constexpr size_t  SAX_TRANSPOSE_SETTING_INDEX = 11;
-        static constexpr int16_t ENCODED_CENTER              = 24;
-        static constexpr uint16_t VALUE_MASK                 = 0x7FFF;
+        static constexpr int16_t  ENCODED_CENTER = 24;
+        static constexpr uint16_t VALUE_MASK     = 0x7FFF;
 
         const uint16_t encoded = static_cast<uint16_t>(
             _display._admin.read(database::Config::Section::system_t::SYSTEM_SETTINGS,
-                                 SAX_TRANSPOSE_SETTING_INDEX) & VALUE_MASK);
+                                 sys::Config::systemSetting_t::SAX_TRANSPOSE) & VALUE_MASK);
         int16_t        semis   = static_cast<int16_t>(encoded) - ENCODED_CENTER;
 
         if (semis < -24)
@@ -149,8 +142,6 @@ void Display::Elements::update()
         snprintf(temp, sizeof(temp), "T%+03d", static_cast<int>(transposeSemisForTopBar));
         u8x8_DrawString(&_display._u8x8, TRANSPOSE_X, 0, temp);
     }
-
-    _lastRefreshTime = nowMs;
 }
 
 /// Sets new message retention time.
@@ -32,8 +32,9 @@ namespace io::leds
         public:
         virtual ~Hwa() = default;
 
-        virtual void   setState(size_t index, brightness_t brightness)             = 0;
-        virtual size_t rgbFromOutput(size_t index)                                 = 0;
-        virtual size_t rgbComponentFromRgb(size_t index, rgbComponent_t component) = 0;
+        virtual void   setState(size_t index, brightness_t brightness)                          = 0;
+        virtual void   setStates(const uint32_t* changed, const uint32_t* planes, size_t words) = 0;
+        virtual size_t rgbFromOutput(size_t index)                                              = 0;
+        virtual size_t rgbComponentFromRgb(size_t index, rgbComponent_t component)              = 0;
     };
 }    // namespace io::leds
\ No newline at end of file
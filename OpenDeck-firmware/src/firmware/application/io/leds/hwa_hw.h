@@ -33,6 +33,11 @@ namespace io::leds
             board::io::digital_out::writeLedState(index, static_cast<board::io::digital_out::ledBrightness_t>(brightness));
         }
 
+        void setStates(const uint32_t* changed, const uint32_t* planes, size_t words) override
+        {
+            board::io::digital_out::writeLedStates(changed, planes, words);
+        }
+
         size_t rgbFromOutput(size_t index) override
         {
             return board::io::digital_out::rgbFromOutput(index);
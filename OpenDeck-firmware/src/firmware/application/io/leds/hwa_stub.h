@@ -31,6 +31,10 @@ namespace io::leds
         {
         }
 
+        void setStates(const uint32_t* changed, const uint32_t* planes, size_t words) override
+        {
+        }
+
         size_t rgbFromOutput(size_t index) override
         {
             return 0;
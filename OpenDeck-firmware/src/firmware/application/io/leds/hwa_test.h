@@ -30,6 +30,7 @@ namespace io::leds
         HwaTest() = default;
 
         MOCK_METHOD2(setState, void(size_t index, brightness_t brightness));
+        MOCK_METHOD3(setStates, void(const uint32_t* changed, const uint32_t* planes, size_t words));
 
         size_t rgbComponentFromRgb(size_t index, rgbComponent_t component) override
         {
@@ -42,7 +42,7 @@ Leds::Leds(Hwa&      hwa,
 
     for (size_t i = 0; i < Collection::SIZE(); i++)
     {
-        _brightness[i] = brightness_t::OFF;
+        setBrightness(i, brightness_t::OFF);
     }
 
     MidiDispatcher.listen(messaging::eventType_t::MIDI_IN,
@@ -187,60 +187,89 @@ void Leds::updateAll(bool forceRefresh)
         return;
     }
 
-    switch (_ledBlinkType)
+    // with timer, blinking is updated from the scheduler instead
+    if ((_ledBlinkType == blinkType_t::MIDI_CLOCK) && forceRefresh)
     {
-    case blinkType_t::TIMER:
+        blink();
+    }
+}
+
+void Leds::blink()
+{
+    // change the blink state for specific blink rate
+    for (size_t i = 0; i < TOTAL_BLINK_SPEEDS; i++)
     {
-        if ((core::mcu::timing::ms() - _lastLEDblinkUpdateTime) < LED_BLINK_TIMER_TYPE_CHECK_TIME)
+        if (++_blinkCounter[i] < _blinkResetArrayPtr[i])
         {
-            return;
+            continue;
         }
 
-        _lastLEDblinkUpdateTime = core::mcu::timing::ms();
+        _blinkState[i]   = !_blinkState[i];
+        _blinkCounter[i] = 0;
+
+        writeBlinkState(i);
     }
-    break;
+}
 
-    case blinkType_t::MIDI_CLOCK:
+/// Assigns the current blink state of specified blink speed to all LEDs blinking with it.
+/// State of all digital outputs is written with a single call.
+void Leds::writeBlinkState(size_t speed)
+{
+    uint32_t changed[MASK_WORDS]                    = {};
+    uint32_t planes[BRIGHTNESS_PLANES * MASK_WORDS] = {};
+    bool     blinking                               = false;
+
+    for (size_t word = 0; word < MASK_WORDS; word++)
     {
-        if (!forceRefresh)
+        const uint32_t MASK = _blinkMask[speed][word];
+        uint32_t       lit  = 0;
+
+        _stateMask[word] = _blinkState[speed] ? (_stateMask[word] | MASK) : (_stateMask[word] & ~MASK);
+
+        for (size_t plane = 0; plane < BRIGHTNESS_PLANES; plane++)
         {
-            return;
+            lit |= _brightnessPlanes[plane][word];
+        }
+
+        // LEDs with brightness set to off look the same in both blink states
+        changed[word] = MASK & lit;
+        blinking |= changed[word] != 0;
+
+        if (_blinkState[speed])
+        {
+            for (size_t plane = 0; plane < BRIGHTNESS_PLANES; plane++)
+            {
+                planes[(plane * MASK_WORDS) + word] = _brightnessPlanes[plane][word] & changed[word];
+            }
         }
     }
-    break;
 
-    default:
+    if (!blinking)
+    {
         return;
     }
 
-    // change the blink state for specific blink rate
-    for (size_t i = 0; i < TOTAL_BLINK_SPEEDS; i++)
+    // specified hwa interface only writes to physical leds, notify the other ones individually
+    for (size_t word = Collection::SIZE(GROUP_DIGITAL_OUTPUTS) / 32; word < MASK_WORDS; word++)
     {
-        if (++_blinkCounter[i] < _blinkResetArrayPtr[i])
-        {
-            continue;
-        }
-
-        _blinkState[i]   = !_blinkState[i];
-        _blinkCounter[i] = 0;
+        uint32_t bits = changed[word];
 
-        // assign changed state to all leds which have this speed
-        for (size_t j = 0; j < Collection::SIZE(); j++)
+        while (bits)
         {
-            if (!bit(j, ledBit_t::BLINK_ON))
-            {
-                continue;
-            }
+            const size_t INDEX = (word * 32) + __builtin_ctz(bits);
+            bits &= bits - 1;
 
-            if (_blinkTimer[j] != i)
+            if (INDEX < Collection::SIZE(GROUP_DIGITAL_OUTPUTS))
             {
                 continue;
             }
 
-            updateBit(j, ledBit_t::STATE, _blinkState[i]);
-            setState(j, bit(j, ledBit_t::STATE) ? _brightness[j] : brightness_t::OFF);
+            setState(INDEX, _blinkState[speed] ? _brightness[INDEX] : brightness_t::OFF);
+            core::util::BIT_WRITE(changed[word], INDEX % 32, false);
         }
     }
+
+    _hwa.setStates(changed, planes, MASK_WORDS);
 }
 
 size_t Leds::maxComponentUpdateIndex()
@@ -592,7 +621,8 @@ void Leds::setBlinkSpeed(uint8_t index, blinkSpeed_t state, bool updateState)
             updateBit(ledArray[i], ledBit_t::STATE, bit(ledArray[i], ledBit_t::ACTIVE));
         }
 
-        _blinkTimer[index] = static_cast<uint8_t>(state);
+        _blinkTimer[ledArray[i]] = static_cast<uint8_t>(state);
+        setBlinkMask(ledArray[i], state);
 
         if (updateState)
         {
@@ -680,7 +710,7 @@ void Leds::setColor(uint8_t index, color_t color, brightness_t brightness)
                 updateBit(index, ledBit_t::RGB, false);
             }
 
-            _brightness[index] = brightness;
+            setBrightness(index, brightness);
             setState(index, brightness);
         }
         else
@@ -725,12 +755,20 @@ void Leds::setBlinkType(blinkType_t blinkType)
     case blinkType_t::TIMER:
     {
         _blinkResetArrayPtr = BLINK_RESET_TIMER;
+
+        TaskScheduler.registerPeriodicTask(_blinkTask,
+                                           LED_BLINK_TIMER_TYPE_CHECK_TIME,
+                                           [this]()
+                                           {
+                                               blink();
+                                           });
     }
     break;
 
     case blinkType_t::MIDI_CLOCK:
     {
         _blinkResetArrayPtr = BLINK_RESET_MIDI_CLOCK;
+        TaskScheduler.cancel(_blinkTask);
     }
     break;
 
@@ -752,13 +790,44 @@ void Leds::resetBlinking()
     }
 }
 
+/// Moves the LED to the blink mask of specified blink speed and removes it from all the other ones.
+void Leds::setBlinkMask(uint8_t index, blinkSpeed_t speed)
+{
+    // LEDs which don't blink aren't part of any mask
+    for (size_t i = 0; i < TOTAL_BLINK_SPEEDS; i++)
+    {
+        core::util::BIT_WRITE(_blinkMask[i][index / 32], index % 32, (speed != blinkSpeed_t::NO_BLINK) && (i == static_cast<size_t>(speed)));
+    }
+}
+
+void Leds::setBrightness(uint8_t index, brightness_t brightness)
+{
+    _brightness[index] = brightness;
+
+    for (size_t plane = 0; plane < BRIGHTNESS_PLANES; plane++)
+    {
+        core::util::BIT_WRITE(_brightnessPlanes[plane][index / 32], index % 32, (static_cast<uint8_t>(brightness) >> plane) & 0x01);
+    }
+}
+
 void Leds::updateBit(uint8_t index, ledBit_t bit, bool state)
 {
+    if (bit == ledBit_t::STATE)
+    {
+        core::util::BIT_WRITE(_stateMask[index / 32], index % 32, state);
+        return;
+    }
+
     core::util::BIT_WRITE(_ledState[index], static_cast<uint8_t>(bit), state);
 }
 
 bool Leds::bit(uint8_t index, ledBit_t bit)
 {
+    if (bit == ledBit_t::STATE)
+    {
+        return core::util::BIT_READ(_stateMask[index / 32], index % 32);
+    }
+
     return core::util::BIT_READ(_ledState[index], static_cast<size_t>(bit));
 }
 
@@ -790,8 +859,10 @@ color_t Leds::color(uint8_t index)
 
 void Leds::resetState(uint8_t index)
 {
-    _ledState[index]   = 0;
-    _brightness[index] = brightness_t::OFF;
+    _ledState[index] = 0;
+    updateBit(index, ledBit_t::STATE, false);
+    setBrightness(index, brightness_t::OFF);
+    setBlinkMask(index, blinkSpeed_t::NO_BLINK);
     setState(index, brightness_t::OFF);
 }
 
@@ -24,6 +24,7 @@ limitations under the License.
 #include "application/io/common/common.h"
 #include "application/system/config.h"
 #include "application/io/base.h"
+#include "application/util/scheduler/scheduler.h"
 
 #include <optional>
 
@@ -60,6 +61,12 @@ namespace io::leds
         static constexpr size_t  TOTAL_BRIGHTNESS_VALUES         = 4;
         static constexpr uint8_t LED_BLINK_TIMER_TYPE_CHECK_TIME = 50;
 
+        /// Amount of bit planes needed to store brightness_t value of each LED.
+        static constexpr size_t BRIGHTNESS_PLANES = 3;
+
+        /// Amount of 32-bit words needed to store a single bit for each LED.
+        static constexpr size_t MASK_WORDS = (Collection::SIZE() + 31) / 32;
+
         /// Array holding MIDI clock pulses after which LED state is toggled for all possible blink rates.
         static constexpr uint8_t BLINK_RESET_MIDI_CLOCK[TOTAL_BLINK_SPEEDS] = {
             48,
@@ -102,6 +109,16 @@ namespace io::leds
         /// Array holding time after which LEDs should blink.
         uint8_t _blinkTimer[Collection::SIZE()] = {};
 
+        /// Bitmasks of LEDs which blink with each blink speed.
+        uint32_t _blinkMask[TOTAL_BLINK_SPEEDS][MASK_WORDS] = {};
+
+        /// Brightness of all LEDs stored in bit planes: plane n holds bit n of brightness of each LED.
+        uint32_t _brightnessPlanes[BRIGHTNESS_PLANES][MASK_WORDS] = {};
+
+        /// ledBit_t::STATE of all LEDs. Kept as a bitmask instead of in _ledState so that
+        /// blinking updates it for all the LEDs of a blink speed at once.
+        uint32_t _stateMask[MASK_WORDS] = {};
+
         /// Holds currently active LED blink type.
         blinkType_t _ledBlinkType = blinkType_t::TIMER;
 
@@ -114,8 +131,8 @@ namespace io::leds
         /// Holds blink state for each blink speed so that leds are in sync.
         bool _blinkState[TOTAL_BLINK_SPEEDS] = {};
 
-        /// Holds last time in miliseconds when LED blinking has been updated.
-        uint32_t _lastLEDblinkUpdateTime = 0;
+        /// Handle of the periodic task which updates the blink state when blinking with timer.
+        util::Scheduler::handle_t _blinkTask = util::Scheduler::INVALID_HANDLE;
 
         void                   setAllOn();
         void                   setAllStaticOn();
@@ -123,6 +140,10 @@ namespace io::leds
         void                   setBlinkSpeed(uint8_t index, blinkSpeed_t state, bool updateState = true);
         void                   setBlinkType(blinkType_t blinkType);
         void                   resetBlinking();
+        void                   blink();
+        void                   writeBlinkState(size_t speed);
+        void                   setBlinkMask(uint8_t index, blinkSpeed_t speed);
+        void                   setBrightness(uint8_t index, brightness_t brightness);
         void                   updateBit(uint8_t index, ledBit_t bit, bool state);
         bool                   bit(uint8_t index, ledBit_t bit);
         void                   resetState(uint8_t index);
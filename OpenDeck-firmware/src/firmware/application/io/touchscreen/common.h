@@ -20,6 +20,8 @@ limitations under the License.
 
 #include "application/io/common/common.h"
 
+#include "core/util/ring_buffer.h"
+
 namespace io::touchscreen
 {
     class Collection : public io::common::BaseCollection<PROJECT_TARGET_SUPPORTED_NR_OF_TOUCHSCREEN_COMPONENTS>
@@ -88,21 +90,24 @@ namespace io::touchscreen
         uint16_t    yPos        = 0;
     };
 
+    /// Decoded events waiting to be processed.
+    using Events = core::util::RingBuffer<Data, 8>;
+
     class Model
     {
         public:
         virtual ~Model() = default;
 
-        virtual bool      init()                                 = 0;
-        virtual bool      deInit()                               = 0;
-        virtual bool      setScreen(size_t index)                = 0;
-        virtual tsEvent_t update(Data& tsData)                   = 0;
-        virtual void      setIconState(Icon& icon, bool state)   = 0;
-        virtual bool      setBrightness(brightness_t brightness) = 0;
+        virtual bool     init()                                 = 0;
+        virtual bool     deInit()                               = 0;
+        virtual bool     setScreen(size_t index)                = 0;
+        virtual void     update(Events& events)                 = 0;
+        virtual void     setIconState(Icon& icon, bool state)   = 0;
+        virtual bool     setBrightness(brightness_t brightness) = 0;
+        virtual uint32_t startupTime()                          = 0;
 
         protected:
-        static constexpr size_t BUFFER_SIZE = 50;
-        static uint8_t          _rxBuffer[BUFFER_SIZE];
-        static size_t           _bufferCount;
+        /// Maximum amount of bytes read from display at once.
+        static constexpr size_t RX_CHUNK_SIZE = 16;
     };
 }    // namespace io::touchscreen
\ No newline at end of file
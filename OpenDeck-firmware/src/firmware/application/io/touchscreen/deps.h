@@ -32,10 +32,11 @@ namespace io::touchscreen
         public:
         virtual ~Hwa() = default;
 
-        virtual bool init()               = 0;
-        virtual bool deInit()             = 0;
-        virtual bool write(uint8_t value) = 0;
-        virtual bool read(uint8_t& value) = 0;
+        virtual bool init()                                                    = 0;
+        virtual bool deInit()                                                  = 0;
+        virtual bool write(uint8_t value)                                      = 0;
+        virtual bool write(uint8_t* buffer, size_t size)                       = 0;
+        virtual bool read(uint8_t* buffer, size_t& size, const size_t maxSize) = 0;
 
         bool allocated(io::common::Allocatable::interface_t interface) override
         {
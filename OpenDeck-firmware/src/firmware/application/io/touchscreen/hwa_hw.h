@@ -46,9 +46,14 @@ namespace io::touchscreen
             return board::uart::write(PROJECT_TARGET_UART_CHANNEL_TOUCHSCREEN, value);
         }
 
-        bool read(uint8_t& value) override
+        bool write(uint8_t* buffer, size_t size) override
         {
-            return board::uart::read(PROJECT_TARGET_UART_CHANNEL_TOUCHSCREEN, value);
+            return board::uart::write(PROJECT_TARGET_UART_CHANNEL_TOUCHSCREEN, buffer, size);
+        }
+
+        bool read(uint8_t* buffer, size_t& size, const size_t maxSize) override
+        {
+            return board::uart::read(PROJECT_TARGET_UART_CHANNEL_TOUCHSCREEN, buffer, size, maxSize);
         }
 
         bool allocated(io::common::Allocatable::interface_t interface) override
@@ -42,11 +42,17 @@ namespace io::touchscreen
             return false;
         }
 
-        bool read(uint8_t& value) override
+        bool write(uint8_t* buffer, size_t size) override
         {
             return false;
         }
 
+        bool read(uint8_t* buffer, size_t& size, const size_t maxSize) override
+        {
+            size = 0;
+            return false;
+        }
+
         bool allocated(io::common::Allocatable::interface_t interface) override
         {
             return false;
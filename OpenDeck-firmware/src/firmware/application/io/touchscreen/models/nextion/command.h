@@ -0,0 +1,113 @@
+/*
+
+Copyright Igor Petrovic
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*/
+
+#pragma once
+
+#include <inttypes.h>
+#include <stddef.h>
+
+namespace io::touchscreen
+{
+    /// Builds Nextion commands in a reusable buffer, together with the terminator,
+    /// so that each command can be sent to display with a single write.
+    class NextionCommand
+    {
+        public:
+        static constexpr size_t BUFFER_SIZE = 50;
+
+        /// Starts a new command, discarding the previous one.
+        NextionCommand& start(const char* text)
+        {
+            _size     = 0;
+            _overflow = false;
+
+            return this->text(text);
+        }
+
+        NextionCommand& text(const char* text)
+        {
+            while (*text)
+            {
+                append(*text++);
+            }
+
+            return *this;
+        }
+
+        NextionCommand& number(uint32_t value)
+        {
+            // digits are produced from the lowest one: store them in reverse order first
+            char   digits[10];
+            size_t count = 0;
+
+            do
+            {
+                digits[count++] = '0' + (value % 10);
+                value /= 10;
+            } while (value);
+
+            while (count)
+            {
+                append(digits[--count]);
+            }
+
+            return *this;
+        }
+
+        /// Terminates the command.
+        /// returns: False if the command doesn't fit in the buffer and shouldn't be sent.
+        bool end()
+        {
+            for (size_t i = 0; i < END_BYTES; i++)
+            {
+                append(0xFF);
+            }
+
+            return !_overflow;
+        }
+
+        uint8_t* data()
+        {
+            return _buffer;
+        }
+
+        size_t size() const
+        {
+            return _size;
+        }
+
+        private:
+        static constexpr size_t END_BYTES = 3;
+
+        uint8_t _buffer[BUFFER_SIZE] = {};
+        size_t  _size                = 0;
+        bool    _overflow            = false;
+
+        void append(uint8_t value)
+        {
+            if (_size < BUFFER_SIZE)
+            {
+                _buffer[_size++] = value;
+            }
+            else
+            {
+                _overflow = true;
+            }
+        }
+    };
+}    // namespace io::touchscreen
@@ -24,10 +24,6 @@ limitations under the License.
 
 #include "core/mcu.h"
 
-#include <stdarg.h>
-#include <stdio.h>
-#include <string.h>
-
 using namespace io::touchscreen;
 
 Nextion::Nextion(Hwa& hwa)
@@ -38,15 +34,16 @@ Nextion::Nextion(Hwa& hwa)
 
 bool Nextion::init()
 {
-    Model::_bufferCount = 0;
+    _parser.reset();
 
     if (_hwa.init())
     {
-        // add slight delay to ensure display can receive commands after power on
-        core::mcu::timing::waitMs(1000);
+        // terminate anything display might have received so far
+        _command.start("");
+        sendCommand();
 
-        endCommand();
-        writeCommand("sendxy=1");
+        _command.start("sendxy=1");
+        sendCommand();
 
         return true;
     }
@@ -59,49 +56,34 @@ bool Nextion::deInit()
     return _hwa.deInit();
 }
 
+uint32_t Nextion::startupTime()
+{
+    return STARTUP_TIME;
+}
+
 bool Nextion::setScreen(size_t index)
 {
-    return writeCommand("page %u", index);
+    _command.start("page ").number(index);
+    return sendCommand();
 }
 
-tsEvent_t Nextion::update(Data& data)
+void Nextion::update(Events& events)
 {
-    uint8_t value   = 0;
-    bool    process = false;
-    auto    retVal  = tsEvent_t::NONE;
+    uint8_t buffer[RX_CHUNK_SIZE];
+    size_t  size = 0;
 
-    while (_hwa.read(value))
+    while (_hwa.read(buffer, size, sizeof(buffer)))
     {
-        Model::_rxBuffer[Model::_bufferCount++] = value;
-
-        if (value == 0xFF)
-        {
-            _endCounter++;
-        }
-        else
+        for (size_t i = 0; i < size; i++)
         {
-            if (_endCounter)
+            Data data = {};
+
+            if (_parser.parse(buffer[i], data) != tsEvent_t::NONE)
             {
-                _endCounter = 0;
+                events.insert(data);
             }
         }
-
-        if (_endCounter == 3)
-        {
-            // new message arrived
-            _endCounter = 0;
-            process     = true;
-            break;
-        }
-    }
-
-    if (process)
-    {
-        retVal              = response(data);
-        Model::_bufferCount = 0;
     }
-
-    return retVal;
 }
 
 void Nextion::setIconState(Icon& icon, bool state)
@@ -117,89 +99,35 @@ void Nextion::setIconState(Icon& icon, bool state)
         return;
     }
 
-    writeCommand("picq %u,%u,%u,%u,%u", icon.xPos, icon.yPos, icon.width, icon.height, state ? icon.onScreen : icon.offScreen);
+    _command.start("picq ")
+        .number(icon.xPos)
+        .text(",")
+        .number(icon.yPos)
+        .text(",")
+        .number(icon.width)
+        .text(",")
+        .number(icon.height)
+        .text(",")
+        .number(state ? icon.onScreen : icon.offScreen);
+
+    sendCommand();
 }
 
-bool Nextion::writeCommand(const char* line, ...)
+/// Terminates the command which has been built and sends it to display at once.
+bool Nextion::sendCommand()
 {
-    va_list args;
-    va_start(args, line);
-
-    int retVal = vsnprintf(_commandBuffer, Model::BUFFER_SIZE, line, args);
-
-    va_end(args);
-
-    if (retVal < 0)
+    if (!_command.end())
     {
         return false;
     }
 
-    for (size_t i = 0; i < strlen(_commandBuffer); i++)
-    {
-        if (!_hwa.write(_commandBuffer[i]))
-        {
-            return false;
-        }
-    }
-
-    return endCommand();
-}
-
-bool Nextion::endCommand()
-{
-    for (int i = 0; i < 3; i++)
-    {
-        if (!_hwa.write(0xFF))
-        {
-            return false;
-        }
-    }
-
-    return true;
+    return _hwa.write(_command.data(), _command.size());
 }
 
 bool Nextion::setBrightness(brightness_t brightness)
 {
-    return writeCommand("dims=%d", BRIGHTNESS_MAPPING[static_cast<uint8_t>(brightness)]);
-}
-
-tsEvent_t Nextion::response(Data& data)
-{
-    bool responseFound = false;
-    auto response      = responseId_t::BUTTON;    // assumption for now
-
-    for (size_t i = 0; i < static_cast<size_t>(responseId_t::AMOUNT); i++)
-    {
-        if (Model::_bufferCount == RESPONSES[i].size)
-        {
-            if (Model::_rxBuffer[0] == static_cast<uint8_t>(RESPONSES[i].responseId))
-            {
-                response      = static_cast<responseId_t>(i);
-                responseFound = true;
-                break;
-            }
-        }
-    }
-
-    if (responseFound)
-    {
-        switch (response)
-        {
-        case responseId_t::BUTTON:
-        {
-            data.buttonState = Model::_rxBuffer[1];
-            data.buttonIndex = Model::_rxBuffer[2];
-
-            return tsEvent_t::BUTTON;
-        }
-        break;
-
-        default:
-            return tsEvent_t::NONE;
-        }
-    }
-
-    return tsEvent_t::NONE;
+    _command.start("dims=").number(BRIGHTNESS_MAPPING[static_cast<uint8_t>(brightness)]);
+    return sendCommand();
 }
 
 #endif
\ No newline at end of file
@@ -18,10 +18,10 @@ limitations under the License.
 
 #pragma once
 
+#include "command.h"
+#include "parser.h"
 #include "application/io/touchscreen/deps.h"
 
-#include "core/util/ring_buffer.h"
-
 namespace io::touchscreen
 {
     class Nextion : public Model
@@ -29,33 +29,17 @@ namespace io::touchscreen
         public:
         Nextion(Hwa& hwa);
 
-        bool      init() override;
-        bool      deInit() override;
-        bool      setScreen(size_t index) override;
-        tsEvent_t update(Data& data) override;
-        void      setIconState(Icon& icon, bool state) override;
-        bool      setBrightness(brightness_t brightness) override;
+        bool     init() override;
+        bool     deInit() override;
+        bool     setScreen(size_t index) override;
+        void     update(Events& events) override;
+        void     setIconState(Icon& icon, bool state) override;
+        bool     setBrightness(brightness_t brightness) override;
+        uint32_t startupTime() override;
 
         private:
-        enum class responseId_t : uint8_t
-        {
-            BUTTON,
-            AMOUNT
-        };
-
-        struct ResponseDescriptor
-        {
-            uint8_t size       = 0;
-            uint8_t responseId = 0;
-        };
-
-        static constexpr ResponseDescriptor RESPONSES[static_cast<size_t>(responseId_t::AMOUNT)] = {
-            // button
-            {
-                .size       = 6,
-                .responseId = 0x65,
-            },
-        };
+        /// Time in milliseconds after power on after which display can receive commands.
+        static constexpr uint32_t STARTUP_TIME = 1000;
 
         // there are 7 levels of brighness - scale them to available range (0-100)
         static constexpr uint8_t BRIGHTNESS_MAPPING[7] = {
@@ -68,12 +52,10 @@ namespace io::touchscreen
             100
         };
 
-        Hwa&   _hwa;
-        char   _commandBuffer[Model::BUFFER_SIZE];
-        size_t _endCounter = 0;
+        Hwa&           _hwa;
+        NextionParser  _parser;
+        NextionCommand _command;
 
-        bool      writeCommand(const char* line, ...);
-        bool      endCommand();
-        tsEvent_t response(Data& data);
+        bool sendCommand();
     };
 }    // namespace io::touchscreen
@@ -0,0 +1,131 @@
+/*
+
+Copyright Igor Petrovic
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*/
+
+#pragma once
+
+#include "application/io/touchscreen/common.h"
+
+namespace io::touchscreen
+{
+    /// Splits the data received from Nextion display into frames terminated with three 0xFF bytes
+    /// and decodes them. Data can be passed in chunks of any size: parsing continues where it
+    /// stopped on the previous call. Frames which don't fit in the buffer are discarded.
+    class NextionParser
+    {
+        public:
+        static constexpr size_t BUFFER_SIZE = 50;
+
+        /// Passes single received byte to the parser.
+        /// param [in]:  value  Received byte.
+        /// param [out]: data   Decoded event data, valid only if the event is returned.
+        /// returns: Decoded event once the frame is complete, tsEvent_t::NONE otherwise.
+        tsEvent_t parse(uint8_t value, Data& data)
+        {
+            if (_count < BUFFER_SIZE)
+            {
+                _buffer[_count++] = value;
+            }
+            else
+            {
+                _overflow = true;
+            }
+
+            if (value == 0xFF)
+            {
+                _endCounter++;
+            }
+            else
+            {
+                _endCounter = 0;
+            }
+
+            if (_endCounter < END_BYTES)
+            {
+                return tsEvent_t::NONE;
+            }
+
+            // frame end: start the next one from scratch
+            auto event = _overflow ? tsEvent_t::NONE : decode(data);
+            reset();
+
+            return event;
+        }
+
+        void reset()
+        {
+            _count      = 0;
+            _endCounter = 0;
+            _overflow   = false;
+        }
+
+        private:
+        enum class responseId_t : uint8_t
+        {
+            BUTTON,
+            AMOUNT
+        };
+
+        struct ResponseDescriptor
+        {
+            uint8_t size       = 0;
+            uint8_t responseId = 0;
+        };
+
+        static constexpr size_t END_BYTES = 3;
+
+        static constexpr ResponseDescriptor RESPONSES[static_cast<size_t>(responseId_t::AMOUNT)] = {
+            // button
+            {
+                .size       = 6,
+                .responseId = 0x65,
+            },
+        };
+
+        uint8_t _buffer[BUFFER_SIZE] = {};
+        size_t  _count               = 0;
+        size_t  _endCounter          = 0;
+        bool    _overflow            = false;
+
+        tsEvent_t decode(Data& data)
+        {
+            for (size_t i = 0; i < static_cast<size_t>(responseId_t::AMOUNT); i++)
+            {
+                if ((_count != RESPONSES[i].size) || (_buffer[0] != RESPONSES[i].responseId))
+                {
+                    continue;
+                }
+
+                switch (static_cast<responseId_t>(i))
+                {
+                case responseId_t::BUTTON:
+                {
+                    data.buttonState = _buffer[1];
+                    data.buttonIndex = _buffer[2];
+
+                    return tsEvent_t::BUTTON;
+                }
+
+                default:
+                    return tsEvent_t::NONE;
+                }
+            }
+
+            return tsEvent_t::NONE;
+        }
+    };
+}    // namespace io::touchscreen
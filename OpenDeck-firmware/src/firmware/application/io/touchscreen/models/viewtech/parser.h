@@ -0,0 +1,153 @@
+/*
+
+Copyright Igor Petrovic
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*/
+
+#pragma once
+
+#include "application/io/touchscreen/common.h"
+
+namespace io::touchscreen
+{
+    /// Splits the data received from Viewtech display into frames and decodes them.
+    /// Frame consists of 0xA5 0x5A header, length byte and payload of that length.
+    /// Data can be passed in chunks of any size: parsing continues where it stopped on the
+    /// previous call. Payload which doesn't fit in the buffer is skipped, and invalid header
+    /// makes the parser look for the next one.
+    class ViewtechParser
+    {
+        public:
+        static constexpr size_t BUFFER_SIZE = 32;
+
+        /// Passes single received byte to the parser.
+        /// param [in]:  value  Received byte.
+        /// param [out]: data   Decoded event data, valid only if the event is returned.
+        /// returns: Decoded event once the frame is complete, tsEvent_t::NONE otherwise.
+        tsEvent_t parse(uint8_t value, Data& data)
+        {
+            switch (_state)
+            {
+            case state_t::HEADER_1:
+            {
+                if (value == HEADER_1)
+                {
+                    _state = state_t::HEADER_2;
+                }
+            }
+            break;
+
+            case state_t::HEADER_2:
+            {
+                if (value == HEADER_2)
+                {
+                    _state = state_t::LENGTH;
+                }
+                else if (value != HEADER_1)
+                {
+                    _state = state_t::HEADER_1;
+                }
+            }
+            break;
+
+            case state_t::LENGTH:
+            {
+                _length = value;
+                _count  = 0;
+                _state  = _length ? state_t::PAYLOAD : state_t::HEADER_1;
+            }
+            break;
+
+            case state_t::PAYLOAD:
+            {
+                if (_count < BUFFER_SIZE)
+                {
+                    _buffer[_count] = value;
+                }
+
+                if (++_count == _length)
+                {
+                    _state = state_t::HEADER_1;
+                    return decode(data);
+                }
+            }
+            break;
+
+            default:
+                break;
+            }
+
+            return tsEvent_t::NONE;
+        }
+
+        void reset()
+        {
+            _state = state_t::HEADER_1;
+        }
+
+        private:
+        enum class state_t : uint8_t
+        {
+            HEADER_1,
+            HEADER_2,
+            LENGTH,
+            PAYLOAD
+        };
+
+        enum class response_t : uint32_t
+        {
+            BUTTON_STATE_CHANGE = 0x05820002
+        };
+
+        static constexpr uint8_t HEADER_1 = 0xA5;
+        static constexpr uint8_t HEADER_2 = 0x5A;
+
+        state_t _state               = state_t::HEADER_1;
+        uint8_t _buffer[BUFFER_SIZE] = {};
+        size_t  _length              = 0;
+        size_t  _count               = 0;
+
+        tsEvent_t decode(Data& data)
+        {
+            // length is part of the response ID
+            if ((_length < 5) || (_length > BUFFER_SIZE))
+            {
+                return tsEvent_t::NONE;
+            }
+
+            uint32_t response = _length;
+            response <<= 8;
+            response |= _buffer[0];
+            response <<= 8;
+            response |= _buffer[1];
+            response <<= 8;
+            response |= _buffer[2];
+
+            switch (response)
+            {
+            case static_cast<uint32_t>(response_t::BUTTON_STATE_CHANGE):
+            {
+                data.buttonState = _buffer[3];
+                data.buttonIndex = _buffer[4];
+
+                return tsEvent_t::BUTTON;
+            }
+
+            default:
+                return tsEvent_t::NONE;
+            }
+        }
+    };
+}    // namespace io::touchscreen
@@ -35,13 +35,10 @@ Viewtech::Viewtech(Hwa& hwa)
 
 bool Viewtech::init()
 {
-    Model::_bufferCount = 0;
+    _parser.reset();
 
     if (_hwa.init())
     {
-        // add slight delay to ensure display can receive commands after power on
-        core::mcu::timing::waitMs(3000);
-
         return true;
     }
 
@@ -53,6 +50,11 @@ bool Viewtech::deInit()
     return _hwa.deInit();
 }
 
+uint32_t Viewtech::startupTime()
+{
+    return STARTUP_TIME;
+}
+
 bool Viewtech::setScreen(size_t index)
 {
     index &= 0xFF;
@@ -68,74 +70,23 @@ bool Viewtech::setScreen(size_t index)
     return true;
 }
 
-tsEvent_t Viewtech::update(Data& data)
+void Viewtech::update(Events& events)
 {
-    auto    event = tsEvent_t::NONE;
-    uint8_t value = 0;
+    uint8_t buffer[RX_CHUNK_SIZE];
+    size_t  size = 0;
 
-    while (_hwa.read(value))
+    while (_hwa.read(buffer, size, sizeof(buffer)))
     {
-        Model::_rxBuffer[Model::_bufferCount++] = value;
-    }
-
-    // assumption - only one response is received at the time
-    // if parsing fails, wipe the buffer
-    if (Model::_bufferCount)
-    {
-        // verify header first
-        if (Model::_rxBuffer[0] == 0xA5)
+        for (size_t i = 0; i < size; i++)
         {
-            if (Model::_bufferCount > 1)
+            Data data = {};
+
+            if (_parser.parse(buffer[i], data) != tsEvent_t::NONE)
             {
-                if (Model::_rxBuffer[1] == 0x5A)
-                {
-                    if (Model::_bufferCount > 2)
-                    {
-                        // byte at index 2 holds response length, without first two bytes and without byte at index 2
-                        if (Model::_bufferCount >= static_cast<size_t>(3 + Model::_rxBuffer[2]))
-                        {
-                            uint32_t response = Model::_rxBuffer[2];
-                            response <<= 8;
-                            response |= Model::_rxBuffer[3];
-                            response <<= 8;
-                            response |= Model::_rxBuffer[4];
-                            response <<= 8;
-                            response |= Model::_rxBuffer[5];
-
-                            switch (response)
-                            {
-                            case static_cast<uint32_t>(response_t::BUTTON_STATE_CHANGE):
-                            {
-                                data.buttonState = Model::_rxBuffer[6];
-                                data.buttonIndex = Model::_rxBuffer[7];
-
-                                event = tsEvent_t::BUTTON;
-                            }
-                            break;
-
-                            default:
-                                break;
-                            }
-
-                            Model::_bufferCount = 0;
-                        }
-                    }
-                }
-                else
-                {
-                    // header invalid - ignore the rest of the message
-                    Model::_bufferCount = 0;
-                }
+                events.insert(data);
             }
         }
-        else
-        {
-            // header invalid - ignore the rest of the message
-            Model::_bufferCount = 0;
-        }
     }
-
-    return event;
 }
 
 void Viewtech::setIconState(Icon& icon, bool state)
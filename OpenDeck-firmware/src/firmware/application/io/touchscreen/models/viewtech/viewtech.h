@@ -18,10 +18,9 @@ limitations under the License.
 
 #pragma once
 
+#include "parser.h"
 #include "application/io/touchscreen/deps.h"
 
-#include "core/util/ring_buffer.h"
-
 namespace io::touchscreen
 {
     class Viewtech : public Model
@@ -29,18 +28,17 @@ namespace io::touchscreen
         public:
         Viewtech(Hwa& hwa);
 
-        bool      init() override;
-        bool      deInit() override;
-        bool      setScreen(size_t index) override;
-        tsEvent_t update(Data& data) override;
-        void      setIconState(Icon& icon, bool state) override;
-        bool      setBrightness(brightness_t brightness) override;
+        bool     init() override;
+        bool     deInit() override;
+        bool     setScreen(size_t index) override;
+        void     update(Events& events) override;
+        void     setIconState(Icon& icon, bool state) override;
+        bool     setBrightness(brightness_t brightness) override;
+        uint32_t startupTime() override;
 
         private:
-        enum class response_t : uint32_t
-        {
-            BUTTON_STATE_CHANGE = 0x05820002
-        };
+        /// Time in milliseconds after power on after which display can receive commands.
+        static constexpr uint32_t STARTUP_TIME = 3000;
 
         // there are 7 levels of brighness - scale them to available range (0-64)
         static constexpr uint8_t BRIGHTNESS_MAPPING[7] = {
@@ -53,6 +51,7 @@ namespace io::touchscreen
             64
         };
 
-        Hwa& _hwa;
+        Hwa&           _hwa;
+        ViewtechParser _parser;
     };
 }    // namespace io::touchscreen
@@ -28,8 +28,6 @@ limitations under the License.
 using namespace io::touchscreen;
 
 std::array<Model*, static_cast<size_t>(model_t::AMOUNT)> Touchscreen::_models;
-uint8_t                                                  Model::_rxBuffer[Model::BUFFER_SIZE];
-size_t                                                   Model::_bufferCount;
 
 Touchscreen::Touchscreen(Hwa&      hwa,
                          Database& database)
@@ -91,11 +89,11 @@ bool Touchscreen::init()
         auto dbModel = static_cast<model_t>(_database.read(database::Config::Section::touchscreen_t::SETTING,
                                                            touchscreen::setting_t::MODEL));
 
-        if (_initialized)
+        if (_initialized || _initPending)
         {
             if (dbModel == _activeModel)
             {
-                // nothing to do, same model already _initialized
+                // nothing to do, same model already initialized or being initialized
                 return true;
             }
 
@@ -105,33 +103,57 @@ bool Touchscreen::init()
             }
         }
 
-        _activeModel  = dbModel;
-        auto instance = modelInstance(_activeModel);
+        _activeModel = dbModel;
 
-        if (instance != nullptr)
+        if (modelInstance(_activeModel) == nullptr)
         {
-            _initialized = instance->init();
+            return false;
         }
 
-        if (_initialized)
-        {
-            setScreen(_database.read(database::Config::Section::touchscreen_t::SETTING,
-                                     touchscreen::setting_t::INITIAL_SCREEN));
+        // Display can't receive commands right after power on. Instead of waiting here,
+        // model is initialized from processEvents() once its startup time passes.
+        _initPending   = true;
+        _initStartTime = core::mcu::timing::ms();
 
-            setBrightness(static_cast<brightness_t>(_database.read(database::Config::Section::touchscreen_t::SETTING,
-                                                                   touchscreen::setting_t::BRIGHTNESS)));
+        return true;
+    }
 
-            return true;
-        }
+    return false;
+}
 
-        return false;
+/// Initializes active model once the time it needs after power on has passed.
+void Touchscreen::initModel()
+{
+    auto instance = modelInstance(_activeModel);
+
+    if (instance == nullptr)
+    {
+        _initPending = false;
+        return;
     }
 
-    return false;
+    if ((core::mcu::timing::ms() - _initStartTime) < instance->startupTime())
+    {
+        return;
+    }
+
+    _initPending = false;
+    _initialized = instance->init();
+
+    if (_initialized)
+    {
+        setScreen(_database.read(database::Config::Section::touchscreen_t::SETTING,
+                                 touchscreen::setting_t::INITIAL_SCREEN));
+
+        setBrightness(static_cast<brightness_t>(_database.read(database::Config::Section::touchscreen_t::SETTING,
+                                                               touchscreen::setting_t::BRIGHTNESS)));
+    }
 }
 
 bool Touchscreen::deInit()
 {
+    _initPending = false;
+
     if (!_initialized)
     {
         return true;    // nothing to do
@@ -147,6 +169,13 @@ bool Touchscreen::deInit()
     if (ptr->deInit())
     {
         _initialized = false;
+        _events.reset();
+
+        for (auto& pending : _iconPending)
+        {
+            pending = 0;
+        }
+
         return true;
     }
 
@@ -161,6 +190,23 @@ void Touchscreen::updateSingle(size_t index, bool forceRefresh)
 
 void Touchscreen::updateAll(bool forceRefresh)
 {
+    processEvents();
+}
+
+size_t Touchscreen::maxComponentUpdateIndex()
+{
+    return 0;
+}
+
+/// Decodes all the data received from display and processes the resulting events.
+/// Called on each run so that touch events don't wait for their turn in component updates.
+void Touchscreen::processEvents()
+{
+    if (_initPending)
+    {
+        initModel();
+    }
+
     if (!isInitialized())
     {
         return;
@@ -173,25 +219,16 @@ void Touchscreen::updateAll(bool forceRefresh)
         return;
     }
 
-    Data      data  = {};
-    tsEvent_t event = ptr->update(data);
+    ptr->update(_events);
 
-    switch (event)
-    {
-    case tsEvent_t::BUTTON:
+    Data data = {};
+
+    while (_events.remove(data))
     {
         processButton(data.buttonIndex, data.buttonState);
     }
-    break;
 
-    default:
-        break;
-    }
-}
-
-size_t Touchscreen::maxComponentUpdateIndex()
-{
-    return 0;
+    updateIcons();
 }
 
 void Touchscreen::registerModel(model_t model, Model* instance)
@@ -227,6 +264,8 @@ size_t Touchscreen::activeScreen()
     return _activeScreenID;
 }
 
+/// Stores the new icon state. Icon is updated on display once all the events
+/// in current run are processed.
 void Touchscreen::setIconState(size_t index, bool state)
 {
     if (!isInitialized())
@@ -239,6 +278,31 @@ void Touchscreen::setIconState(size_t index, bool state)
         return;
     }
 
+    core::util::BIT_WRITE(_iconState[index / 32], index % 32, state);
+    core::util::BIT_WRITE(_iconPending[index / 32], index % 32, true);
+}
+
+/// Sends the last stored state of all changed icons to display.
+void Touchscreen::updateIcons()
+{
+    for (size_t word = 0; word < ICON_WORDS; word++)
+    {
+        uint32_t bits = _iconPending[word];
+
+        _iconPending[word] = 0;
+
+        while (bits)
+        {
+            auto bit = __builtin_ctz(bits);
+            bits &= bits - 1;
+
+            writeIconState((word * 32) + bit, (_iconState[word] >> bit) & 0x01);
+        }
+    }
+}
+
+void Touchscreen::writeIconState(size_t index, bool state)
+{
     auto ptr = modelInstance(_activeModel);
 
     if (ptr == nullptr)
@@ -39,6 +39,7 @@ namespace io::touchscreen
         void        updateSingle(size_t index, bool forceRefresh = false) override;
         void        updateAll(bool forceRefresh = false) override;
         size_t      maxComponentUpdateIndex() override;
+        void        processEvents() override;
         static void registerModel(model_t model, Model* instance);
 
         private:
@@ -46,15 +47,26 @@ namespace io::touchscreen
         Database&                                                       _database;
         size_t                                                          _activeScreenID = 0;
         bool                                                            _initialized    = false;
+        bool                                                            _initPending    = false;
+        uint32_t                                                        _initStartTime  = 0;
         model_t                                                         _activeModel    = model_t::AMOUNT;
+        Events                                                          _events;
+
+        // icon changes are sent to display once per run, with only the last state of each icon
+        static constexpr size_t ICON_WORDS               = Collection::SIZE() / 32 + 1;
+        uint32_t                _iconPending[ICON_WORDS] = {};
+        uint32_t                _iconState[ICON_WORDS]   = {};
         static std::array<Model*, static_cast<size_t>(model_t::AMOUNT)> _models;
 
         bool                   deInit();
+        void                   initModel();
         Model*                 modelInstance(model_t model);
         bool                   isInitialized() const;
         void                   setScreen(size_t index);
         size_t                 activeScreen();
         void                   setIconState(size_t index, bool state);
+        void                   updateIcons();
+        void                   writeIconState(size_t index, bool state);
         bool                   setBrightness(brightness_t brightness);
         void                   processButton(const size_t buttonIndex, const bool state);
         void                   buttonHandler(size_t index, bool state);
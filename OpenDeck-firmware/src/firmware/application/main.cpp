@@ -17,6 +17,12 @@ limitations under the License.
 */
 
 #include "application/system/builder.h"
+#include "application/util/logger/logger.h"
+#include "board/board.h"
+
+#ifdef OPENDECK_BINARY_LOGGER
+util::BinaryLogger<APP_LOGGER_SIZE> APP_LOGGER;
+#endif
 
 sys::Builder builderSystem;
 
@@ -24,6 +30,16 @@ int main()
 {
     builderSystem.instance().init();
 
+#ifdef PROJECT_TARGET_DUAL_CORE
+    board::multicore::launch([]()
+                             {
+                                 while (true)
+                                 {
+                                     builderSystem.instance().runInput();
+                                 }
+                             });
+#endif
+
     while (true)
     {
         builderSystem.instance().run();
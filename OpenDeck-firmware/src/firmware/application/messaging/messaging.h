@@ -24,6 +24,14 @@ limitations under the License.
 
 namespace messaging
 {
+    /// Context in which event listeners run. Everything runs in MAIN context unless
+    /// input processing runs on its own core.
+    enum class context_t : uint8_t
+    {
+        MAIN,
+        INPUT,
+    };
+
     enum class eventType_t : uint8_t
     {
         ANALOG,
@@ -59,6 +67,7 @@ namespace messaging
         FACTORY_RESET_START,
         FACTORY_RESET_END,
         MIDI_BPM_CHANGE,
+        FACTORY_RESET_PROGRESS,
     };
 
     struct Event
@@ -75,4 +84,4 @@ namespace messaging
     };
 }    // namespace messaging
 
-#define MidiDispatcher util::Dispatcher<messaging::eventType_t, messaging::Event>::instance()
\ No newline at end of file
+#define MidiDispatcher util::Dispatcher<messaging::eventType_t, messaging::Event, messaging::context_t>::instance()
\ No newline at end of file
@@ -0,0 +1,304 @@
+/*
+
+Copyright Igor Petrovic
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*/
+
+#include "clock.h"
+
+#include "core/mcu.h"
+
+using namespace protocol::midi;
+
+namespace
+{
+    constexpr uint64_t PPQN = 24;
+
+    /// Amount of microseconds in one minute multiplied by tempo scale (hundredths of BPM).
+    constexpr uint64_t FIXED_MINUTE_USEC = 60ULL * 1000000ULL * 100ULL;
+}    // namespace
+
+void Clock::tick()
+{
+    _ticks = _ticks + 1;
+
+    if (!_running)
+    {
+        return;
+    }
+
+    const uint32_t previous = _phase;
+    const uint32_t phase    = previous + _increment;
+
+    _phase = phase;
+
+    if (phase < previous)
+    {
+        if (_mode == mode_t::EXTERNAL)
+        {
+            // Don't run ahead of incoming clock by more than MAX_LEAD pulses:
+            // this prevents sending additional pulses once incoming clock stops.
+            // Pulse isn't lost - it's sent once the next incoming pulse confirms it.
+            if (_lead >= MAX_LEAD)
+            {
+                if (_owed < MAX_LEAD)
+                {
+                    _owed = _owed + 1;
+                }
+
+                return;
+            }
+
+            _lead = _lead + 1;
+        }
+
+        produce();
+    }
+}
+
+void Clock::sync()
+{
+    if (_mode != mode_t::EXTERNAL)
+    {
+        return;
+    }
+
+    CORE_MCU_ATOMIC_SECTION
+    {
+        const uint32_t now      = _ticks;
+        const uint32_t interval = now - _lastSyncTick;
+        const bool     valid    = (interval >= MIN_SYNC_INTERVAL_TICKS) && (interval <= MAX_SYNC_INTERVAL_TICKS);
+
+        _lastSyncTick = now;
+
+        if (!_locked)
+        {
+            if (_syncStarted && valid)
+            {
+                // second pulse - initial period is known now
+                _period    = interval << PERIOD_SHIFT;
+                _increment = periodToIncrement(_period);
+                _phase     = 0;
+                _lead      = 0;
+                _owed      = 0;
+                _running   = true;
+                _locked    = true;
+            }
+
+            // until the engine is locked, incoming pulses are passed as-is
+            _syncStarted = true;
+            produce();
+        }
+        else
+        {
+            if (valid)
+            {
+                const int32_t difference = static_cast<int32_t>(interval << PERIOD_SHIFT) - static_cast<int32_t>(_period);
+
+                _period    = _period + (difference >> PERIOD_FILTER_SHIFT);
+                _increment = periodToIncrement(_period);
+            }
+
+            // Phase interpreted as signed value is the distance from the closest pulse:
+            // positive value means the pulse has already been sent (engine is ahead),
+            // negative means the pulse is about to be sent (engine is behind).
+            // Only portion of the error is corrected so that the phase is never moved
+            // across the overflow point.
+            const int32_t error = static_cast<int32_t>(_phase);
+
+            _phase = _phase - static_cast<uint32_t>(error >> PHASE_CORRECTION_SHIFT);
+
+            if (_owed > 0)
+            {
+                // pulse held back while the engine was ahead is confirmed now
+                _owed = _owed - 1;
+                produce();
+            }
+            else if (_lead > -MAX_LEAD)
+            {
+                _lead = _lead - 1;
+            }
+            else
+            {
+                // engine is too far behind incoming clock - pass the pulse as-is
+                produce();
+            }
+        }
+    }
+}
+
+void Clock::update()
+{
+    if ((_mode != mode_t::EXTERNAL) || !_syncStarted)
+    {
+        return;
+    }
+
+    const uint32_t elapsed = ticks() - _lastSyncTick;
+    const uint32_t timeout = _locked ? ((_period >> PERIOD_SHIFT) * SYNC_TIMEOUT_PERIODS) : MAX_SYNC_INTERVAL_TICKS;
+
+    if (elapsed > timeout)
+    {
+        unlock();
+    }
+}
+
+bool Clock::pulse()
+{
+    if (_consumed == _produced)
+    {
+        return false;
+    }
+
+    _consumed = _consumed + 1;
+    return true;
+}
+
+void Clock::setMode(mode_t mode)
+{
+    if (mode == _mode)
+    {
+        return;
+    }
+
+    const uint32_t increment = bpmToIncrement(_fixedBpm);
+
+    CORE_MCU_ATOMIC_SECTION
+    {
+        _running     = false;
+        _locked      = false;
+        _syncStarted = false;
+        _phase       = 0;
+        _lead        = 0;
+        _owed        = 0;
+        _increment   = increment;
+        _mode        = mode;
+    }
+}
+
+void Clock::run(bool state)
+{
+    if (_mode == mode_t::EXTERNAL)
+    {
+        if (!state)
+        {
+            unlock();
+        }
+
+        return;
+    }
+
+    if (state == _running)
+    {
+        return;
+    }
+
+    CORE_MCU_ATOMIC_SECTION
+    {
+        _phase   = 0;
+        _running = state;
+    }
+}
+
+void Clock::setTempo(uint32_t fixedBpm)
+{
+    _fixedBpm = fixedBpm;
+
+    if (_mode != mode_t::INTERNAL)
+    {
+        return;
+    }
+
+    const uint32_t increment = bpmToIncrement(fixedBpm);
+
+    CORE_MCU_ATOMIC_SECTION
+    {
+        _increment = increment;
+    }
+}
+
+uint32_t Clock::tempo()
+{
+    if (_mode == mode_t::INTERNAL)
+    {
+        return _fixedBpm;
+    }
+
+    if (!_locked)
+    {
+        return 0;
+    }
+
+    return static_cast<uint32_t>((FIXED_MINUTE_USEC << PERIOD_SHIFT) / (PPQN * TICK_USEC * _period));
+}
+
+Clock::mode_t Clock::mode()
+{
+    return _mode;
+}
+
+bool Clock::running()
+{
+    return _running;
+}
+
+bool Clock::locked()
+{
+    return _locked;
+}
+
+uint32_t Clock::ticks()
+{
+    uint32_t ticks = 0;
+
+    CORE_MCU_ATOMIC_SECTION
+    {
+        ticks = _ticks;
+    }
+
+    return ticks;
+}
+
+void Clock::produce()
+{
+    if (static_cast<uint8_t>(_produced - _consumed) < MAX_PENDING)
+    {
+        _produced = _produced + 1;
+    }
+}
+
+void Clock::unlock()
+{
+    CORE_MCU_ATOMIC_SECTION
+    {
+        _running     = false;
+        _locked      = false;
+        _syncStarted = false;
+    }
+}
+
+uint32_t Clock::bpmToIncrement(uint32_t fixedBpm)
+{
+    // pulses per tick, scaled to 2^32
+    const uint64_t increment = ((static_cast<uint64_t>(fixedBpm) * PPQN * TICK_USEC) << 32) + (FIXED_MINUTE_USEC / 2);
+
+    return static_cast<uint32_t>(increment / FIXED_MINUTE_USEC);
+}
+
+uint32_t Clock::periodToIncrement(uint32_t period)
+{
+    // period is in ticks, with PERIOD_SHIFT fractional bits
+    return static_cast<uint32_t>((1ULL << (32 + PERIOD_SHIFT)) / period);
+}
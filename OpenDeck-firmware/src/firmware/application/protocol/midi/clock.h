@@ -0,0 +1,139 @@
+/*
+
+Copyright Igor Petrovic
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*/
+
+#pragma once
+
+#include <inttypes.h>
+#include <stddef.h>
+
+namespace protocol::midi
+{
+    /// MIDI clock generator driven from a fixed-period timer.
+    /// Tempo is converted into 32-bit phase increment added to phase accumulator on each
+    /// timer tick: clock pulse is generated each time the accumulator overflows. Since the
+    /// remainder is kept in the accumulator, pulses are never more than one tick away from
+    /// their ideal position and there is no cumulative drift, regardless of tempo.
+    /// Generated pulses are handed to main loop through lock-free counter pair:
+    /// timer interrupt only increments produced count, main loop only increments consumed count.
+    /// Since pulses are sent from main loop, sent pulse lags its ideal position by at most
+    /// TICK_USEC plus the duration of single main loop pass.
+    /// In external mode, phase and tempo follow incoming MIDI clock: tempo is smoothed with
+    /// first-order IIR filter and phase error is partially corrected on each incoming pulse.
+    /// Amount of generated pulses never differs from amount of incoming pulses by more than MAX_LEAD.
+    class Clock
+    {
+        public:
+        Clock() = default;
+
+        enum class mode_t : uint8_t
+        {
+            INTERNAL,
+            EXTERNAL,
+        };
+
+        /// Period of timer used to call tick().
+        /// Pulses can't be sent more precisely than main loop runs, so there is no
+        /// point in running the timer much faster than that.
+        static constexpr uint32_t TICK_USEC = 500;
+
+        /// Should be called from timer interrupt every TICK_USEC microseconds.
+        void tick();
+
+        /// Should be called from main loop on each incoming MIDI clock pulse.
+        /// Used only in external mode.
+        void sync();
+
+        /// Should be called periodically from main loop.
+        /// In external mode, stops the clock once incoming pulses stop arriving.
+        void update();
+
+        /// Checks for pending clock pulse.
+        /// returns: True if clock pulse should be sent, false otherwise.
+        ///          Pulse is consumed on each call returning true.
+        bool pulse();
+
+        /// Sets clock mode.
+        /// Clock is stopped on mode change.
+        void setMode(mode_t mode);
+
+        /// Starts or stops pulse generation in internal mode.
+        /// In external mode, clock is started on incoming pulses.
+        void run(bool state);
+
+        /// Sets internal tempo.
+        /// param [in]: fixedBpm    Tempo in hundredths of BPM.
+        void setTempo(uint32_t fixedBpm);
+
+        /// returns: Current tempo in hundredths of BPM.
+        ///          In external mode this is the smoothed tempo of incoming clock.
+        uint32_t tempo();
+
+        mode_t mode();
+        bool   running();
+        bool   locked();
+
+        private:
+        /// Maximum amount of pulses waiting to be sent.
+        /// If main loop isn't able to keep up, excess pulses are dropped.
+        static constexpr uint8_t MAX_PENDING = 16;
+
+        /// Fractional bits used for incoming clock period (in ticks).
+        static constexpr uint32_t PERIOD_SHIFT = 8;
+
+        /// Smoothing factor (as power of two) for incoming clock period.
+        static constexpr uint32_t PERIOD_FILTER_SHIFT = 5;
+
+        /// Portion (as power of two) of phase error corrected on each incoming pulse.
+        static constexpr uint32_t PHASE_CORRECTION_SHIFT = 4;
+
+        /// Amount of expected periods without incoming pulse after which external clock is considered stopped.
+        static constexpr uint32_t SYNC_TIMEOUT_PERIODS = 3;
+
+        /// Incoming pulses with larger interval are ignored for tempo estimation (equals 10 BPM).
+        static constexpr uint32_t MAX_SYNC_INTERVAL_TICKS = 250000 / TICK_USEC;
+
+        static constexpr uint32_t MIN_SYNC_INTERVAL_TICKS = 1;
+
+        /// Maximum amount of pulses by which engine can lead or lag behind incoming clock in external mode.
+        /// Pulses generated beyond this are owed and sent on next incoming pulse.
+        static constexpr int8_t MAX_LEAD = 1;
+
+        volatile uint32_t _phase     = 0;
+        volatile uint32_t _increment = 0;
+        volatile uint32_t _ticks     = 0;
+        volatile uint8_t  _produced  = 0;
+        volatile uint8_t  _consumed  = 0;
+        volatile int8_t   _lead      = 0;
+        volatile uint8_t  _owed      = 0;
+        volatile bool     _running   = false;
+
+        mode_t   _mode         = mode_t::INTERNAL;
+        uint32_t _fixedBpm     = 0;
+        uint32_t _lastSyncTick = 0;
+        uint32_t _period       = 0;
+        bool     _syncStarted  = false;
+        bool     _locked       = false;
+
+        uint32_t ticks();
+        void     produce();
+        void     unlock();
+
+        static uint32_t bpmToIncrement(uint32_t fixedBpm);
+        static uint32_t periodToIncrement(uint32_t period);
+    };
+}    // namespace protocol::midi
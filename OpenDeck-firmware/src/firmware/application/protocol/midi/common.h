@@ -67,6 +67,9 @@ namespace protocol::midi
         USE_GLOBAL_CHANNEL,
         GLOBAL_CHANNEL,
         SEND_MIDI_CLOCK_DIN,
+        SEND_MIDI_CLOCK_USB,
+        SEND_MIDI_CLOCK_BLE,
+        FOLLOW_MIDI_CLOCK,
         AMOUNT
     };
 }    // namespace protocol::midi
\ No newline at end of file
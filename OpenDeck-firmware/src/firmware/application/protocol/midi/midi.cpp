@@ -84,12 +84,23 @@ Midi::Midi(HwaUsb&    hwaUSB,
                               }
                               break;
 
+                              case messaging::systemMessage_t::FORCE_IO_REFRESH:
+                              {
+                                  // event.value is set when only the values different from the ones
+                                  // already sent should be refreshed - otherwise, resend everything
+                                  if (!event.value)
+                                  {
+                                      _sentValues.invalidate();
+                                  }
+                              }
+                              break;
+
                               case messaging::systemMessage_t::MIDI_BPM_CHANGE:
                               {
-                                  if (isSettingEnabled(setting_t::DIN_ENABLED) && isSettingEnabled(setting_t::SEND_MIDI_CLOCK_DIN) && _clockTimerAllocated)
+                                  // when following incoming clock, tempo is set by the clock itself
+                                  if (_clock.mode() == Clock::mode_t::INTERNAL)
                                   {
-                                      core::mcu::timers::setPeriod(_clockTimerIndex, Bpm.bpmToUsec(Bpm.value()));
-                                      core::mcu::timers::start(_clockTimerIndex);
+                                      _clock.setTempo(Bpm.fixedValue());
                                   }
                               }
                               break;
@@ -101,6 +112,7 @@ Midi::Midi(HwaUsb&    hwaUSB,
 
     ConfigHandler.registerConfig(
         sys::Config::block_t::GLOBAL,
+        { sys::Config::Section::global_t::MIDI_SETTINGS },
         // read
         [this](uint8_t section, size_t index, uint16_t& value)
         {
@@ -136,6 +148,11 @@ bool Midi::init()
         return false;
     }
 
+    if (!setupClock())
+    {
+        return false;
+    }
+
     return true;
 }
 
@@ -179,29 +196,12 @@ bool Midi::setupSerial()
     else
     {
         _serial.deInit();
+        _sentValues.invalidate(INTERFACE_SERIAL);
     }
 
     _serial.setNoteOffMode(isSettingEnabled(setting_t::STANDARD_NOTE_OFF) ? noteOffType_t::STANDARD_NOTE_OFF : noteOffType_t::NOTE_ON_ZERO_VEL);
     _hwaSerial.setLoopback(isDinLoopbackRequired());
 
-    if (!_clockTimerAllocated)
-    {
-        if (core::mcu::timers::allocate(_clockTimerIndex, [this]()
-                                        {
-                                            _serial.sendRealTime(messageType_t::SYS_REAL_TIME_CLOCK);
-                                        }))
-        {
-            _clockTimerAllocated = true;
-
-            core::mcu::timers::setPeriod(_clockTimerIndex, Bpm.bpmToUsec(Bpm.value()));
-
-            if (isSettingEnabled(setting_t::SEND_MIDI_CLOCK_DIN))
-            {
-                core::mcu::timers::start(_clockTimerIndex);
-            }
-        }
-    }
-
     return true;
 }
 
@@ -214,6 +214,7 @@ bool Midi::setupBle()
     else
     {
         _ble.deInit();
+        _sentValues.invalidate(INTERFACE_BLE);
     }
 
     _ble.setNoteOffMode(isSettingEnabled(setting_t::STANDARD_NOTE_OFF) ? noteOffType_t::STANDARD_NOTE_OFF : noteOffType_t::NOTE_ON_ZERO_VEL);
@@ -307,8 +308,125 @@ bool Midi::setupThru()
     return true;
 }
 
+bool Midi::setupClock()
+{
+    if (!_clockTimerAllocated)
+    {
+        // timer is used only to advance the clock engine - clock is sent from main loop
+        if (core::mcu::timers::allocate(_clockTimerIndex, [this]()
+                                        {
+                                            _clock.tick();
+                                        }))
+        {
+            _clockTimerAllocated = true;
+            core::mcu::timers::setPeriod(_clockTimerIndex, Clock::TICK_USEC);
+        }
+    }
+
+    updateClock();
+
+    return true;
+}
+
+void Midi::updateClock()
+{
+    if (!_clockTimerAllocated)
+    {
+        return;
+    }
+
+    const bool FOLLOW = isSettingEnabled(setting_t::FOLLOW_MIDI_CLOCK);
+    bool       output = false;
+
+    for (size_t i = 0; i < INTERFACE_AMOUNT; i++)
+    {
+        output |= isClockOutputEnabled(static_cast<interface_t>(i));
+    }
+
+    _clock.setMode(FOLLOW ? Clock::mode_t::EXTERNAL : Clock::mode_t::INTERNAL);
+
+    if (!FOLLOW)
+    {
+        _clock.setTempo(Bpm.fixedValue());
+        _clock.run(output);
+    }
+
+    if (FOLLOW || output)
+    {
+        core::mcu::timers::start(_clockTimerIndex);
+    }
+    else
+    {
+        core::mcu::timers::stop(_clockTimerIndex);
+    }
+}
+
+bool Midi::isClockOutputEnabled(interface_t interface)
+{
+    switch (interface)
+    {
+    case INTERFACE_USB:
+        return isSettingEnabled(setting_t::SEND_MIDI_CLOCK_USB);
+
+    case INTERFACE_SERIAL:
+        return isSettingEnabled(setting_t::DIN_ENABLED) && isSettingEnabled(setting_t::SEND_MIDI_CLOCK_DIN);
+
+    case INTERFACE_BLE:
+        return isSettingEnabled(setting_t::BLE_ENABLED) && isSettingEnabled(setting_t::SEND_MIDI_CLOCK_BLE);
+
+    default:
+        return false;
+    }
+}
+
+void Midi::sendClock()
+{
+    for (size_t i = 0; i < _midiInterface.size(); i++)
+    {
+        auto interfaceInstance = _midiInterface[i];
+
+        if (!interfaceInstance->initialized())
+        {
+            continue;
+        }
+
+        if (isClockOutputEnabled(static_cast<interface_t>(i)))
+        {
+            interfaceInstance->sendRealTime(messageType_t::SYS_REAL_TIME_CLOCK);
+        }
+    }
+
+    if (_clock.mode() == Clock::mode_t::EXTERNAL)
+    {
+        // Incoming clock pulses aren't dispatched when following incoming clock:
+        // pass the smoothed clock instead so that clock consumers (LEDs) stay steady.
+        messaging::Event event = {};
+        event.message          = messageType_t::SYS_REAL_TIME_CLOCK;
+
+        MidiDispatcher.notify(messaging::eventType_t::MIDI_IN, event);
+    }
+}
+
 void Midi::read()
 {
+    _clock.update();
+
+    while (_clock.pulse())
+    {
+        sendClock();
+    }
+
+    if (_clock.locked())
+    {
+        const uint32_t TEMPO   = _clock.tempo();
+        const uint32_t CURRENT = Bpm.fixedValue();
+
+        if (((TEMPO > CURRENT) ? (TEMPO - CURRENT) : (CURRENT - TEMPO)) >= FOLLOWED_BPM_HYSTERESIS)
+        {
+            Bpm.setFixed(TEMPO);
+        }
+    }
+
     for (size_t i = 0; i < _midiInterface.size(); i++)
     {
         auto interfaceInstance = _midiInterface[i];
@@ -354,6 +472,27 @@ void Midi::read()
             }
             break;
 
+            case messageType_t::SYS_REAL_TIME_CLOCK:
+            {
+                if (_clock.mode() == Clock::mode_t::EXTERNAL)
+                {
+                    // smoothed pulse is dispatched once generated by the clock engine
+                    _clock.sync();
+                    continue;
+                }
+            }
+            break;
+
+            case messageType_t::SYS_REAL_TIME_STOP:
+            {
+                if (_clock.mode() == Clock::mode_t::EXTERNAL)
+                {
+                    // don't wait for timeout to stop following
+                    _clock.run(false);
+                }
+            }
+            break;
+
             default:
                 break;
             }
@@ -389,6 +528,9 @@ void Midi::send(messaging::eventType_t source, const messaging::Event& event)
 
     const bool USE_OMNI = CHANNEL == OMNI_CHANNEL ? true : false;
 
+    uint16_t sentValue = 0;
+    auto     key       = sentValueKey(event, CHANNEL, sentValue);
+
     for (size_t i = 0; i < _midiInterface.size(); i++)
     {
         auto interfaceInstance = _midiInterface[i];
@@ -398,11 +540,26 @@ void Midi::send(messaging::eventType_t source, const messaging::Event& event)
             continue;
         }
 
-        LOG_INF("MIDI interface: #%d, channel: %d, event.index: %d, event.value: %d",
-                static_cast<int>(i),
-                CHANNEL,
-                event.index,
-                event.value);
+        if (key.has_value())
+        {
+            // on forced refresh, skip the messages which receiver has already seen
+            if (event.forcedRefresh && !_sentValues.changed(i, key.value(), sentValue))
+            {
+                continue;
+            }
+
+            _sentValues.update(i, key.value(), sentValue);
+        }
+
+        // sysex isn't logged: log itself is sent to host using sysex
+        if (event.message != messageType_t::SYS_EX)
+        {
+            LOG_INF("MIDI interface: #%d, channel: %d, event.index: %d, event.value: %d",
+                    static_cast<int>(i),
+                    CHANNEL,
+                    event.index,
+                    event.value);
+        }
 
         switch (event.message)
         {
@@ -653,6 +810,89 @@ void Midi::send(messaging::eventType_t source, const messaging::Event& event)
     }
 }
 
+/// Creates key under which the message is stored in cache of sent values.
+/// param [in]: event   Message to send.
+/// param [in]: channel Channel on which the message is sent.
+/// param [in]: value   Reference in which value stored in cache is written.
+/// returns: Key of the message or std::nullopt if message isn't tracked (non-channel messages).
+std::optional<uint32_t> Midi::sentValueKey(const messaging::Event& event, uint8_t channel, uint16_t& value)
+{
+    auto     messageClass = sentClass_t::NOTE;
+    uint16_t index        = event.index;
+    value                 = event.value;
+
+    switch (event.message)
+    {
+    case messageType_t::NOTE_OFF:
+    {
+        // note off is the same as note on with zero velocity to the receiver
+        value = 0;
+    }
+    break;
+
+    case messageType_t::NOTE_ON:
+        break;
+
+    case messageType_t::CONTROL_CHANGE:
+    {
+        messageClass = sentClass_t::CONTROL_CHANGE;
+    }
+    break;
+
+    case messageType_t::CONTROL_CHANGE_14BIT:
+    {
+        messageClass = sentClass_t::CONTROL_CHANGE_14BIT;
+    }
+    break;
+
+    case messageType_t::PROGRAM_CHANGE:
+    {
+        // only one program can be active per channel
+        messageClass = sentClass_t::PROGRAM_CHANGE;
+        index        = 0;
+        value        = event.index;
+    }
+    break;
+
+    case messageType_t::AFTER_TOUCH_CHANNEL:
+    {
+        messageClass = sentClass_t::AFTER_TOUCH_CHANNEL;
+        index        = 0;
+    }
+    break;
+
+    case messageType_t::AFTER_TOUCH_POLY:
+    {
+        messageClass = sentClass_t::AFTER_TOUCH_POLY;
+    }
+    break;
+
+    case messageType_t::PITCH_BEND:
+    {
+        messageClass = sentClass_t::PITCH_BEND;
+        index        = 0;
+    }
+    break;
+
+    case messageType_t::NRPN_7BIT:
+    {
+        messageClass = sentClass_t::NRPN_7BIT;
+    }
+    break;
+
+    case messageType_t::NRPN_14BIT:
+    {
+        messageClass = sentClass_t::NRPN_14BIT;
+    }
+    break;
+
+    default:
+        return std::nullopt;
+    }
+
+    return _sentValues.key(channel, static_cast<uint8_t>(messageClass), index);
+}
+
 // helper function used to apply note off to all available interfaces
 void Midi::setNoteOffMode(noteOffType_t type)
 {
@@ -759,6 +999,8 @@ std::optional<uint8_t> Midi::sysConfigGet(sys::Config::Section::global_t section
     break;
 
     case setting_t::SEND_MIDI_CLOCK_DIN:
+    case setting_t::SEND_MIDI_CLOCK_USB:
+    case setting_t::FOLLOW_MIDI_CLOCK:
     {
         if (!_clockTimerAllocated)
         {
@@ -773,6 +1015,21 @@ std::optional<uint8_t> Midi::sysConfigGet(sys::Config::Section::global_t section
     }
     break;
 
+    case setting_t::SEND_MIDI_CLOCK_BLE:
+    {
+        if (!_clockTimerAllocated || !_hwaBle.supported())
+        {
+            result = sys::Config::Status::ERROR_NOT_SUPPORTED;
+        }
+        else
+        {
+            result = _database.read(util::Conversion::SYS_2_DB_SECTION(section), index, readValue)
+                         ? sys::Config::Status::ACK
+                         : sys::Config::Status::ERROR_READ;
+        }
+    }
+    break;
+
     default:
     {
         result = _database.read(util::Conversion::SYS_2_DB_SECTION(section), index, readValue)
@@ -1120,6 +1377,8 @@ std::optional<uint8_t> Midi::sysConfigSet(sys::Config::Section::global_t section
     break;
 
     case setting_t::SEND_MIDI_CLOCK_DIN:
+    case setting_t::SEND_MIDI_CLOCK_USB:
+    case setting_t::FOLLOW_MIDI_CLOCK:
     {
         if (!_clockTimerAllocated)
         {
@@ -1127,7 +1386,19 @@ std::optional<uint8_t> Midi::sysConfigSet(sys::Config::Section::global_t section
         }
         else
         {
-            value ? core::mcu::timers::start(_clockTimerIndex) : core::mcu::timers::stop(_clockTimerIndex);
+            result = sys::Config::Status::ACK;
+        }
+    }
+    break;
+
+    case setting_t::SEND_MIDI_CLOCK_BLE:
+    {
+        if (!_clockTimerAllocated || !_hwaBle.supported())
+        {
+            result = sys::Config::Status::ERROR_NOT_SUPPORTED;
+        }
+        else
+        {
             result = sys::Config::Status::ACK;
         }
     }
@@ -1151,21 +1422,11 @@ std::optional<uint8_t> Midi::sysConfigSet(sys::Config::Section::global_t section
         case io::common::initAction_t::INIT:
         {
             _serial.init();
-
-            if (isSettingEnabled(setting_t::SEND_MIDI_CLOCK_DIN) && _clockTimerAllocated)
-            {
-                core::mcu::timers::start(_clockTimerIndex);
-            }
         }
         break;
 
         case io::common::initAction_t::DE_INIT:
         {
-            if (isSettingEnabled(setting_t::SEND_MIDI_CLOCK_DIN) && _clockTimerAllocated)
-            {
-                core::mcu::timers::stop(_clockTimerIndex);
-            }
-
             _serial.deInit();
         }
         break;
@@ -1191,6 +1452,9 @@ std::optional<uint8_t> Midi::sysConfigSet(sys::Config::Section::global_t section
         default:
             break;
         }
+
+        // clock outputs depend on both clock and interface settings
+        updateClock();
     }
 
     // no need to check this if init/deinit has been already called for DIN
@@ -19,6 +19,8 @@ limitations under the License.
 #pragma once
 
 #include "deps.h"
+#include "clock.h"
+#include "sent_values.h"
 #include "application/io/common/common.h"
 #include "application/protocol/base.h"
 #include "application/database/database.h"
@@ -55,6 +57,41 @@ namespace protocol::midi
             INTERFACE_AMOUNT
         };
 
+        /// Minimum difference (in hundredths of BPM) between followed and current tempo
+        /// needed to update global tempo while following incoming clock.
+        static constexpr uint32_t FOLLOWED_BPM_HYSTERESIS = 50;
+
+        /// Message types tracked in cache of sent values.
+        enum class sentClass_t : uint8_t
+        {
+            NOTE,
+            CONTROL_CHANGE,
+            CONTROL_CHANGE_14BIT,
+            PROGRAM_CHANGE,
+            AFTER_TOUCH_CHANNEL,
+            AFTER_TOUCH_POLY,
+            PITCH_BEND,
+            NRPN_7BIT,
+            NRPN_14BIT,
+        };
+
+        static constexpr size_t sentValuesSize(size_t components)
+        {
+            size_t size = 16;
+
+            while ((size < components) && (size < 256))
+            {
+                size <<= 1;
+            }
+
+            return size;
+        }
+
+        /// One cache slot per component, rounded to power of two.
+        static constexpr size_t SENT_VALUES_SIZE = sentValuesSize(PROJECT_TARGET_SUPPORTED_NR_OF_BUTTONS +
+                                                                  PROJECT_TARGET_SUPPORTED_NR_OF_ANALOG_INPUTS +
+                                                                  PROJECT_TARGET_SUPPORTED_NR_OF_TOUCHSCREEN_COMPONENTS);
+
         HwaUsb&                                        _hwaUsb;
         HwaSerial&                                     _hwaSerial;
         HwaBle&                                        _hwaBle;
@@ -63,18 +100,25 @@ namespace protocol::midi
         lib::midi::ble::Ble                            _ble    = lib::midi::ble::Ble(_hwaBle);
         Database&                                      _database;
         std::array<lib::midi::Base*, INTERFACE_AMOUNT> _midiInterface;
+        Clock                                          _clock;
+        SentValues<SENT_VALUES_SIZE, INTERFACE_AMOUNT> _sentValues;
         bool                                           _clockTimerAllocated = false;
         size_t                                         _clockTimerIndex     = 0;
 
-        bool                   isSettingEnabled(setting_t feature);
-        bool                   isDinLoopbackRequired();
-        std::optional<uint8_t> sysConfigGet(sys::Config::Section::global_t section, size_t index, uint16_t& value);
-        std::optional<uint8_t> sysConfigSet(sys::Config::Section::global_t section, size_t index, uint16_t value);
-        void                   send(messaging::eventType_t source, const messaging::Event& event);
-        void                   setNoteOffMode(noteOffType_t type);
-        bool                   setupUsb();
-        bool                   setupSerial();
-        bool                   setupBle();
-        bool                   setupThru();
+        bool                    isSettingEnabled(setting_t feature);
+        bool                    isDinLoopbackRequired();
+        std::optional<uint8_t>  sysConfigGet(sys::Config::Section::global_t section, size_t index, uint16_t& value);
+        std::optional<uint8_t>  sysConfigSet(sys::Config::Section::global_t section, size_t index, uint16_t value);
+        void                    send(messaging::eventType_t source, const messaging::Event& event);
+        void                    setNoteOffMode(noteOffType_t type);
+        bool                    setupUsb();
+        bool                    setupSerial();
+        bool                    setupBle();
+        bool                    setupThru();
+        bool                    setupClock();
+        void                    updateClock();
+        bool                    isClockOutputEnabled(interface_t interface);
+        void                    sendClock();
+        std::optional<uint32_t> sentValueKey(const messaging::Event& event, uint8_t channel, uint16_t& value);
     };
 }    // namespace protocol::midi
\ No newline at end of file
@@ -0,0 +1,111 @@
+/*
+
+Copyright Igor Petrovic
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*/
+
+#pragma once
+
+#include <inttypes.h>
+#include <stddef.h>
+#include <array>
+
+namespace protocol::midi
+{
+    /// Keeps last value sent for each channel message so that forced refresh
+    /// can skip the messages which wouldn't change anything on the receiving side.
+    /// Cache is direct-mapped: messages mapped to the same slot replace each other.
+    /// Values which aren't in cache are always reported as changed, so the cache
+    /// can only cause extra messages to be sent, never the missing ones.
+    template<size_t SIZE, size_t INTERFACES>
+    class SentValues
+    {
+        public:
+        SentValues()
+        {
+            invalidate();
+        }
+
+        static_assert(SIZE && !(SIZE & (SIZE - 1)), "Cache size must be a power of two");
+
+        /// Creates cache key for a message.
+        /// param [in]: channel         MIDI channel on which the message is sent.
+        /// param [in]: messageClass    Type of message. Must be smaller than 16.
+        /// param [in]: index           Message index (note, CC or NRPN number). Must fit in 14 bits.
+        static constexpr uint32_t key(uint8_t channel, uint8_t messageClass, uint16_t index)
+        {
+            return KEY_VALID |
+                   (static_cast<uint32_t>(channel) << 18) |
+                   (static_cast<uint32_t>(messageClass & 0x0F) << 14) |
+                   (index & 0x3FFF);
+        }
+
+        /// Checks whether the value differs from the one last sent on specified interface.
+        bool changed(size_t interface, uint32_t key, uint16_t value) const
+        {
+            const size_t SLOT = slot(key);
+
+            if (_keys[SLOT] != key)
+            {
+                return true;
+            }
+
+            return _values[SLOT][interface] != value;
+        }
+
+        void update(size_t interface, uint32_t key, uint16_t value)
+        {
+            const size_t SLOT = slot(key);
+
+            if (_keys[SLOT] != key)
+            {
+                _keys[SLOT] = key;
+                _values[SLOT].fill(UNKNOWN_VALUE);
+            }
+
+            _values[SLOT][interface] = value;
+        }
+
+        /// Forgets all values sent on specified interface.
+        void invalidate(size_t interface)
+        {
+            for (auto& values : _values)
+            {
+                values[interface] = UNKNOWN_VALUE;
+            }
+        }
+
+        /// Forgets all sent values.
+        void invalidate()
+        {
+            _keys.fill(0);
+        }
+
+        private:
+        static constexpr uint32_t KEY_VALID = 1UL << 31;
+
+        /// MIDI values are at most 14-bit so this can't be a valid value.
+        static constexpr uint16_t UNKNOWN_VALUE = 0xFFFF;
+
+        std::array<uint32_t, SIZE>                          _keys   = {};
+        std::array<std::array<uint16_t, INTERFACES>, SIZE> _values = {};
+
+        static size_t slot(uint32_t key)
+        {
+            // Fibonacci hashing - spreads consecutive indexes on different channels over the table
+            return ((key * 2654435761UL) >> 16) & (SIZE - 1);
+        }
+    };
+}    // namespace protocol::midi
@@ -0,0 +1,170 @@
+/*
+
+Copyright Igor Petrovic
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*/
+
+#include "articulation.h"
+
+using namespace sys;
+
+Articulation::Articulation(noteHandler_t handler)
+    : _handler(handler)
+{}
+
+void Articulation::configure(const Config& config)
+{
+    _config = config;
+
+    if (!_config.fullScaleRise)
+    {
+        _config.fullScaleRise = 1;
+    }
+}
+
+void Articulation::breath(uint16_t value)
+{
+    switch (_state)
+    {
+    case state_t::IDLE:
+    {
+        if (value >= _config.onThreshold)
+        {
+            // rise is measured from the last reading below the threshold
+            _attackStart   = _lastBreath < value ? _lastBreath : value;
+            _attackPeak    = value;
+            _attackSamples = 0;
+            _state         = state_t::ATTACK;
+        }
+    }
+    break;
+
+    case state_t::ATTACK:
+    {
+        if (value < _config.offThreshold)
+        {
+            // breath dropped before the note has started - ignore the attack
+            _state = state_t::IDLE;
+            break;
+        }
+
+        if (value > _attackPeak)
+        {
+            _attackPeak = value;
+        }
+
+        _attackSamples++;
+    }
+    break;
+
+    case state_t::SOUNDING:
+    {
+        if (value < _config.offThreshold)
+        {
+            stopNote();
+            _state = state_t::IDLE;
+        }
+    }
+    break;
+
+    default:
+        break;
+    }
+
+    if ((_state == state_t::ATTACK) && (_attackSamples >= _config.velocitySamples))
+    {
+        _velocity = velocity();
+        _state    = state_t::SOUNDING;
+        startNote();
+    }
+
+    _lastBreath = value;
+}
+
+void Articulation::note(int16_t note)
+{
+    if (note < 0)
+    {
+        // keep playing the last note while fingering passes through unknown combination
+        _fingeredNote = note;
+        return;
+    }
+
+    if (note == _fingeredNote)
+    {
+        return;
+    }
+
+    _fingeredNote = note;
+
+    if (_state == state_t::SOUNDING)
+    {
+        startNote();
+    }
+}
+
+void Articulation::reset()
+{
+    stopNote();
+
+    _state        = state_t::IDLE;
+    _lastBreath   = 0;
+    _fingeredNote = -1;
+}
+
+int16_t Articulation::playing() const
+{
+    return _playingNote;
+}
+
+/// Starts currently fingered note. Note which is already playing is stopped only
+/// after the new one has started so that the synth can play the change legato.
+void Articulation::startNote()
+{
+    if ((_fingeredNote < 0) || (_fingeredNote == _playingNote))
+    {
+        return;
+    }
+
+    auto previous = _playingNote;
+    _playingNote  = _fingeredNote;
+
+    _handler(static_cast<uint8_t>(_playingNote), _velocity);
+
+    if (previous >= 0)
+    {
+        _handler(static_cast<uint8_t>(previous), 0);
+    }
+}
+
+void Articulation::stopNote()
+{
+    if (_playingNote < 0)
+    {
+        return;
+    }
+
+    _handler(static_cast<uint8_t>(_playingNote), 0);
+    _playingNote = -1;
+}
+
+/// Maps the rise of breath during attack to note velocity.
+uint8_t Articulation::velocity() const
+{
+    uint32_t rise   = _attackPeak - _attackStart;
+    uint32_t result = 1 + ((rise * 126) / _config.fullScaleRise);
+
+    return result > 127 ? 127 : static_cast<uint8_t>(result);
+}
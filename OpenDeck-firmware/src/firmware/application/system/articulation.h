@@ -0,0 +1,96 @@
+/*
+
+Copyright Igor Petrovic
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*/
+
+#pragma once
+
+#include "application/util/function/function.h"
+
+#include <inttypes.h>
+#include <stddef.h>
+
+namespace sys
+{
+    /// Wind controller note articulation. Notes start when breath crosses the on threshold and
+    /// stop when it falls below the off threshold. Velocity is calculated from the rise of breath
+    /// during the first few readings after the threshold is crossed. Fingering changes while the
+    /// breath is held result in legato note changes: the new note starts before the old one stops.
+    class Articulation
+    {
+        public:
+        /// Called for each note which should start (velocity 1-127) or stop (velocity 0).
+        using noteHandler_t = util::Function<void(uint8_t note, uint8_t velocity)>;
+
+        struct Config
+        {
+            /// Breath value at which note starts.
+            uint16_t onThreshold = 0xFFFF;
+
+            /// Breath value below which note stops. Should be lower than onThreshold.
+            uint16_t offThreshold = 0;
+
+            /// Rise of breath during velocityTime which results in maximum velocity.
+            uint16_t fullScaleRise = 1;
+
+            /// Amount of breath readings after crossing the on threshold during which breath rise
+            /// is measured. Note starts once this amount of readings is processed. Readings come
+            /// from consecutive ADC frames, so the window is measured in ADC samples instead of
+            /// timer ticks which are too coarse for it.
+            uint16_t velocitySamples = 0;
+        };
+
+        Articulation(noteHandler_t handler);
+
+        void configure(const Config& config);
+
+        /// Processes new breath reading.
+        /// param [in]: value   Breath reading.
+        void breath(uint16_t value);
+
+        /// Sets the note resolved from current fingering, or -1 if fingering doesn't resolve to any note.
+        void note(int16_t note);
+
+        /// Stops the note which is currently playing, if any, and waits for the next breath attack.
+        void reset();
+
+        /// Returns the note which is currently playing or -1 if there is none.
+        int16_t playing() const;
+
+        private:
+        enum class state_t : uint8_t
+        {
+            IDLE,
+            ATTACK,
+            SOUNDING,
+        };
+
+        noteHandler_t _handler;
+        Config        _config        = {};
+        state_t       _state         = state_t::IDLE;
+        uint16_t      _lastBreath    = 0;
+        uint16_t      _attackStart   = 0;
+        uint16_t      _attackPeak    = 0;
+        uint16_t      _attackSamples = 0;
+        uint8_t       _velocity      = 0;
+        int16_t       _fingeredNote  = -1;
+        int16_t       _playingNote   = -1;
+
+        void    startNote();
+        void    stopNote();
+        uint8_t velocity() const;
+    };
+}    // namespace sys
@@ -39,4 +39,39 @@ namespace sys
     // Maximum amount of component indexes which will be checked per single run() call. All indexes aren't
     // processed in order to reduce the amount of time spent in a single run() call.
     constexpr inline size_t MAX_UPDATES_PER_RUN = 16;
+
+    // Default amount of components refreshed per millisecond during forced refresh, used when
+    // FORCED_REFRESH_RATE setting is 0. Each component sends at most one message: this roughly
+    // matches the bandwidth of DIN MIDI (3 bytes per message at 31250 baud).
+    constexpr inline uint16_t DEFAULT_FORCED_REFRESH_RATE = 1;
+
+    // Maximum value of FORCED_REFRESH_RATE setting.
+    constexpr inline uint16_t MAX_FORCED_REFRESH_RATE = 100;
+
+    // Maximum time in milliseconds for which refresh budget is accumulated. Prevents
+    // bursts after run() has been blocked for a longer period of time.
+    constexpr inline uint32_t MAX_FORCED_REFRESH_ELAPSED = 4;
+
+    // Maximum amount of values read or written with a single bulk request. Each value takes two bytes
+    // in the message so this keeps the largest bulk message below 80 bytes.
+    constexpr inline size_t BULK_MAX_VALUES = 32;
+
+    // Amount of entries in sax fingering table.
+    constexpr inline size_t SAX_FINGERING_ENTRIES = 128;
+
+    // Maximum amount of sax fingering table entries in single upload message. Each entry takes
+    // six bytes in the message so this keeps the upload message below 90 bytes.
+    constexpr inline size_t SAX_TABLE_UPLOAD_MAX_ENTRIES = 12;
+
+    // Maximum amount of sax fingering table entries with care mask in single upload message.
+    // Each entry takes ten bytes in the message so this keeps the upload message below 93 bytes.
+    constexpr inline size_t SAX_TABLE_UPLOAD_MAX_CARE_ENTRIES = 8;
+
+    // Amount of values staged for each sax fingering table entry before uploaded table is
+    // committed: one for each database section of the table (masks, note and care masks).
+    constexpr inline size_t SAX_TABLE_STAGE_VALUES = 5;
+
+    // Time in milliseconds without any event after which inputs are scanned at idle rate
+    // on low power targets.
+    constexpr inline uint32_t IDLE_SCAN_TIMEOUT = 5000;
 }    // namespace sys
\ No newline at end of file
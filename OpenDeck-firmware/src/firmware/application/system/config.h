@@ -64,6 +64,9 @@ namespace sys
                 SAX_FINGERING_CURRENT_MASK,
                 // Write-only: clear current pressed/latching state for SAX_FINGERING_KEY buttons
                 SAX_FINGERING_CLEAR,
+                // Keys checked by sax fingering table entry (index 0..127), others are ignored
+                SAX_FINGERING_CARE_LO14,
+                SAX_FINGERING_CARE_HI12,
                 AMOUNT
             };
 
@@ -155,9 +158,24 @@ namespace sys
             PRESET_PRESERVE                            = static_cast<uint8_t>(database::Config::systemSetting_t::PRESET_PRESERVE),
             DISABLE_FORCED_REFRESH_AFTER_PRESET_CHANGE = static_cast<uint8_t>(database::Config::systemSetting_t::CUSTOM_SYSTEM_SETTING_START),
             ENABLE_PRESET_CHANGE_WITH_PROGRAM_CHANGE_IN,
+            SAX_REGISTER_CHROMATIC_ENABLE,
+            SAX_REGISTER_CHROMATIC_BASE_NOTE,
+            SAX_BREATH_ENABLE,
+            SAX_BREATH_ANALOG_INDEX,
+            SAX_BREATH_CC,
+            SAX_INPUT_INVERT,
+            SAX_BREATH_MID_PERCENT,
+            SAX_TRANSPOSE,
+            SAX_PB_DEADZONE,
+            SAX_PB_CENTER,
+            FORCED_REFRESH_RATE,
+            SAX_TABLE_COMMIT,    // internal: preset + 1 while uploaded sax table is being written, 0 otherwise
             AMOUNT
         };
 
+        static_assert(static_cast<uint8_t>(systemSetting_t::AMOUNT) <= static_cast<uint8_t>(database::Config::systemSetting_t::CUSTOM_SYSTEM_SETTING_END),
+                      "Too many custom system settings");
+
         struct Status
         {
             // Since get/set config messages return uint8_t to allow for custom, user statuses,
@@ -181,6 +199,7 @@ namespace sys
                 ERROR_NOT_SUPPORTED,     // 0x0D
                 ERROR_READ,              // 0x0E
                 SERIAL_PERIPHERAL_ALLOCATED_ERROR = 80,
+                ERROR_BUSY                        = 81,
             };
         };
     };
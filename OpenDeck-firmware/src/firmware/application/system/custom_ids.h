@@ -34,9 +34,21 @@ constexpr inline uint8_t SYSEX_CR_BOOTLOADER_SUPPORT            = 0x51;
 constexpr inline uint8_t SYSEX_CR_FULL_BACKUP                   = 0x1B;
 constexpr inline uint8_t SYSEX_CR_RESTORE_START                 = 0x1C;
 constexpr inline uint8_t SYSEX_CR_RESTORE_END                   = 0x1D;
+constexpr inline uint8_t SYSEX_CR_BOOT_TIMES                    = 0x54;
+
+// Ranged configuration requests - these carry arguments and are therefore handled before
+// the message reaches sysexconf (see System::handleBulkRequest). Bulk set validates the whole
+// range before writing anything and is supported only for sections stored as-is.
+constexpr inline uint8_t SYSEX_CR_BULK_GET    = 0x20;
+constexpr inline uint8_t SYSEX_CR_BULK_SET    = 0x21;
+constexpr inline uint8_t SYSEX_CR_SECTION_CRC = 0x22;
 
 // Midisaxo custom requests
 constexpr inline uint8_t SYSEX_CR_SAX_PB_CENTER_CAPTURE          = 0x60;
+constexpr inline uint8_t SYSEX_CR_SAX_TABLE_UPLOAD               = 0x61;
 
 /// Custom ID used when sending info about components to host
-constexpr inline uint8_t SYSEX_CM_COMPONENT_ID = 0x49;
\ No newline at end of file
+constexpr inline uint8_t SYSEX_CM_COMPONENT_ID = 0x49;
+
+/// Custom ID used when sending binary log records to host
+constexpr inline uint8_t SYSEX_CM_LOG = 0x4C;
\ No newline at end of file
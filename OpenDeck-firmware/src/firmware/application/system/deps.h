@@ -42,6 +42,21 @@ namespace sys
         virtual void update()                                                                      = 0;
         virtual void reboot(fw_selector::fwType_t type)                                            = 0;
         virtual void registerOnUSBconnectionHandler(usbConnectionHandler_t&& usbConnectionHandler) = 0;
+
+#ifdef PROJECT_TARGET_DUAL_CORE
+        /// Returns true if called from the core on which inputs are processed.
+        virtual bool isInputCore() = 0;
+#endif
+
+#ifdef PROJECT_TARGET_LOW_POWER
+        /// Sleeps until the next interrupt.
+        virtual void sleep() = 0;
+
+        /// Returns true if inputs are scanned at idle rate.
+        virtual bool idleScan() = 0;
+
+        virtual void setIdleScan(bool state) = 0;
+#endif
     };
 
     class Components
@@ -0,0 +1,331 @@
+/*
+
+Copyright Igor Petrovic
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*/
+
+#include "fingering.h"
+
+using namespace sys;
+
+namespace
+{
+    bool contains(const uint32_t* set, size_t index)
+    {
+        return (set[index / 32] >> (index % 32)) & 0x01;
+    }
+}    // namespace
+
+void Fingering::clear()
+{
+    _totalEntries     = 0;
+    _totalNodes       = 0;
+    _totalLeafEntries = 0;
+    _root             = NO_MATCH;
+    _compiled         = false;
+}
+
+bool Fingering::add(const Entry& entry)
+{
+    if (_totalEntries >= MAX_ENTRIES)
+    {
+        return false;
+    }
+
+    _keys[_totalEntries]  = entry.keys & entry.care;
+    _care[_totalEntries]  = entry.care;
+    _notes[_totalEntries] = entry.note;
+    _totalEntries++;
+
+    // tree needs to be built again
+    _compiled = false;
+
+    return true;
+}
+
+bool Fingering::build()
+{
+    _totalNodes       = 0;
+    _totalLeafEntries = 0;
+    _compiled         = compile();
+
+    if (!_compiled)
+    {
+        _totalNodes       = 0;
+        _totalLeafEntries = 0;
+        _root             = NO_MATCH;
+    }
+
+    return _compiled;
+}
+
+int16_t Fingering::resolve(uint32_t mask) const
+{
+    if (!_compiled)
+    {
+        return resolveLinear(mask);
+    }
+
+    auto reference = _root;
+
+    while (!(reference & LEAF))
+    {
+        const auto& node = _nodes[reference];
+        reference        = node.next[(mask >> node.key) & 0x01];
+    }
+
+    if (reference == NO_MATCH)
+    {
+        return NO_NOTE;
+    }
+
+    for (size_t i = reference & ~LEAF; _leafEntries[i] != LEAF_END; i++)
+    {
+        if (matches(_leafEntries[i], mask))
+        {
+            return _notes[_leafEntries[i]];
+        }
+    }
+
+    return NO_NOTE;
+}
+
+int16_t Fingering::resolveLinear(uint32_t mask) const
+{
+    for (size_t i = 0; i < _totalEntries; i++)
+    {
+        if (matches(i, mask))
+        {
+            return _notes[i];
+        }
+    }
+
+    return NO_NOTE;
+}
+
+size_t Fingering::nodes() const
+{
+    return _totalNodes;
+}
+
+/// Creates the tree depth first: subtree of the pressed state of the node is created only
+/// once the whole subtree of its released state is done.
+/// returns: False if there is no more space for nodes or leaves.
+bool Fingering::compile()
+{
+    if (!subtree(0, 0, _root))
+    {
+        return false;
+    }
+
+    size_t depth = 0;
+
+    if (!(_root & LEAF))
+    {
+        _stack[depth++] = { 0, 0, _root, 0 };
+    }
+
+    while (depth)
+    {
+        auto& frame = _stack[depth - 1];
+
+        if (frame.state > 1)
+        {
+            depth--;
+            continue;
+        }
+
+        const uint8_t  STATE   = frame.state++;
+        const uint32_t BIT     = 1UL << _nodes[frame.node].key;
+        const uint32_t DECIDED = frame.decided | BIT;
+        const uint32_t PATH    = frame.path | (STATE ? BIT : 0);
+        uint16_t       child   = NO_MATCH;
+
+        if (!subtree(DECIDED, PATH, child))
+        {
+            return false;
+        }
+
+        _nodes[frame.node].next[STATE] = child;
+
+        if (!(child & LEAF))
+        {
+            // child checks a key which isn't in DECIDED, so this can only fail on inconsistent tree
+            if (depth >= MAX_KEYS)
+            {
+                return false;
+            }
+
+            _stack[depth++] = { DECIDED, PATH, child, 0 };
+        }
+    }
+
+    return true;
+}
+
+/// Creates the node or leaf which resolves the entries matching specified key states.
+/// Subtrees of the created node are created afterwards by compile().
+/// param [in]: decided     Mask of the keys checked so far.
+/// param [in]: path        States of the keys checked so far.
+/// param [out]: reference  Reference to the created node or leaf.
+/// returns: False if there is no more space for nodes or leaves.
+bool Fingering::subtree(uint32_t decided, uint32_t path, uint16_t& reference)
+{
+    // candidates are the entries which agree with all the keys checked so far
+    set_t  candidates = {};
+    size_t first      = MAX_ENTRIES;
+
+    for (size_t i = 0; i < _totalEntries; i++)
+    {
+        if (!((_keys[i] ^ path) & _care[i] & decided))
+        {
+            candidates[i / 32] |= 1UL << (i % 32);
+
+            if (first == MAX_ENTRIES)
+            {
+                first = i;
+            }
+        }
+    }
+
+    if (first == MAX_ENTRIES)
+    {
+        reference = NO_MATCH;
+        return true;
+    }
+
+    // highest priority entry is known to match once all of its keys are checked
+    if (!(_care[first] & ~decided))
+    {
+        return leaf(candidates, decided, reference);
+    }
+
+    const uint8_t KEY = splitKey(candidates, decided);
+
+    if (KEY == MAX_KEYS)
+    {
+        // remaining candidates can't be told apart by any single key
+        return leaf(candidates, decided, reference);
+    }
+
+    if (_totalNodes >= MAX_NODES)
+    {
+        return false;
+    }
+
+    reference                 = static_cast<uint16_t>(_totalNodes++);
+    _nodes[reference].key     = KEY;
+    _nodes[reference].next[0] = NO_MATCH;
+    _nodes[reference].next[1] = NO_MATCH;
+
+    return true;
+}
+
+/// Stores the candidates in priority order as leaf entry list. Candidates with lower
+/// priority than the one which is known to match are omitted.
+bool Fingering::leaf(const set_t candidates, uint32_t decided, uint16_t& reference)
+{
+    const size_t OFFSET = _totalLeafEntries;
+
+    for (size_t i = 0; i < _totalEntries; i++)
+    {
+        if (!contains(candidates, i))
+        {
+            continue;
+        }
+
+        // one slot is always left for the end marker
+        if ((_totalLeafEntries + 1) >= MAX_LEAF_ENTRIES)
+        {
+            return false;
+        }
+
+        _leafEntries[_totalLeafEntries++] = i;
+
+        if (!(_care[i] & ~decided))
+        {
+            break;
+        }
+    }
+
+    _leafEntries[_totalLeafEntries++] = LEAF_END;
+    reference                         = LEAF | OFFSET;
+
+    return true;
+}
+
+/// Returns the key which best splits the candidates into two smaller sets or MAX_KEYS if
+/// there is no key for which some candidates require pressed and others released state.
+uint8_t Fingering::splitKey(const set_t candidates, uint32_t decided) const
+{
+    uint8_t best     = MAX_KEYS;
+    size_t  bestSize = MAX_ENTRIES + 1;
+
+    for (uint8_t key = 0; key < MAX_KEYS; key++)
+    {
+        const uint32_t BIT = 1UL << key;
+
+        if (decided & BIT)
+        {
+            continue;
+        }
+
+        size_t released = 0;
+        size_t pressed  = 0;
+        size_t any      = 0;
+
+        for (size_t i = 0; i < _totalEntries; i++)
+        {
+            if (!contains(candidates, i))
+            {
+                continue;
+            }
+
+            if (!(_care[i] & BIT))
+            {
+                any++;
+            }
+            else if (_keys[i] & BIT)
+            {
+                pressed++;
+            }
+            else
+            {
+                released++;
+            }
+        }
+
+        if (!released || !pressed)
+        {
+            continue;
+        }
+
+        // larger of the two resulting sets
+        const size_t SIZE = (released > pressed ? released : pressed) + any;
+
+        if (SIZE < bestSize)
+        {
+            best     = key;
+            bestSize = SIZE;
+        }
+    }
+
+    return best;
+}
+
+bool Fingering::matches(size_t entry, uint32_t mask) const
+{
+    return !((mask ^ _keys[entry]) & _care[entry]);
+}
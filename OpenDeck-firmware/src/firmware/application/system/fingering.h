@@ -0,0 +1,123 @@
+/*
+
+Copyright Igor Petrovic
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*/
+
+#pragma once
+
+#include "common.h"
+
+#include <inttypes.h>
+#include <stddef.h>
+
+namespace sys
+{
+    /// Sax fingering table compiled into a binary decision tree.
+    /// Each entry specifies the state of the keys which are set in its care mask, other keys
+    /// are irrelevant for the entry. When more entries match the pressed keys, the one added
+    /// first wins. Each tree node checks the state of a single key and each leaf holds the
+    /// list of entries which still can match, so resolving the note takes only few key checks
+    /// regardless of the amount of entries in table.
+    class Fingering
+    {
+        public:
+        struct Entry
+        {
+            uint32_t keys = 0;
+            uint32_t care = 0;
+            uint8_t  note = 0;
+        };
+
+        static constexpr int16_t NO_NOTE = -1;
+
+        /// Removes all entries and the compiled tree.
+        void clear();
+
+        /// Appends the entry to the table. Entries must be added in priority order, highest first.
+        /// returns: False if the table is full.
+        bool add(const Entry& entry);
+
+        /// Compiles the added entries into decision tree.
+        /// returns: False if the tree doesn't fit into reserved memory. Notes are then resolved
+        ///          by checking all entries.
+        bool build();
+
+        /// Returns the note of the highest priority entry matching specified key mask or NO_NOTE
+        /// if there is no such entry.
+        int16_t resolve(uint32_t mask) const;
+
+        /// Resolves the note by checking each entry in priority order.
+        int16_t resolveLinear(uint32_t mask) const;
+
+        /// Returns the amount of nodes in compiled tree.
+        size_t nodes() const;
+
+        private:
+        static constexpr size_t   MAX_ENTRIES      = SAX_FINGERING_ENTRIES;
+        static constexpr size_t   MAX_NODES        = MAX_ENTRIES * 2;
+        static constexpr size_t   MAX_LEAF_ENTRIES = MAX_ENTRIES * 4;
+        static constexpr size_t   SET_WORDS        = (MAX_ENTRIES + 31) / 32;
+        static constexpr uint8_t  MAX_KEYS         = 32;
+        static constexpr uint16_t LEAF             = 0x8000;
+        static constexpr uint16_t NO_MATCH         = 0xFFFF;
+        static constexpr uint8_t  LEAF_END         = 0xFF;
+
+        static_assert(MAX_ENTRIES < LEAF_END, "Entry index must fit in leaf list");
+        static_assert(MAX_NODES < LEAF, "Node index must fit in node reference");
+
+        /// Set of entries which can still match while walking down the tree.
+        using set_t = uint32_t[SET_WORDS];
+
+        struct Node
+        {
+            /// Either index of the next node or LEAF with offset of the entry list in leaf entries.
+            uint16_t next[2] = {};
+            uint8_t  key     = 0;
+        };
+
+        /// Node whose subtrees are being compiled. Candidates of the node aren't stored: they are
+        /// the entries which agree with the states of the keys on the path to the node.
+        struct Frame
+        {
+            uint32_t decided = 0;    // keys checked on the path to the node
+            uint32_t path    = 0;    // states of the checked keys
+            uint16_t node    = 0;
+            uint8_t  state   = 0;    // key state whose subtree is compiled next
+        };
+
+        uint32_t _keys[MAX_ENTRIES]             = {};
+        uint32_t _care[MAX_ENTRIES]             = {};
+        uint8_t  _notes[MAX_ENTRIES]            = {};
+        size_t   _totalEntries                  = 0;
+        Node     _nodes[MAX_NODES]              = {};
+        size_t   _totalNodes                    = 0;
+        uint8_t  _leafEntries[MAX_LEAF_ENTRIES] = {};
+        size_t   _totalLeafEntries              = 0;
+        uint16_t _root                          = NO_MATCH;
+        bool     _compiled                      = false;
+
+        /// Each node checks one of the keys not checked by its parents, so tree can't be deeper
+        /// than the amount of keys. Tree is compiled using this stack instead of recursion to keep
+        /// the call stack usage low and bounded.
+        Frame _stack[MAX_KEYS] = {};
+
+        bool    compile();
+        bool    subtree(uint32_t decided, uint32_t path, uint16_t& reference);
+        bool    leaf(const set_t candidates, uint32_t decided, uint16_t& reference);
+        uint8_t splitKey(const set_t candidates, uint32_t decided) const;
+        bool    matches(size_t entry, uint32_t mask) const;
+    };
+}    // namespace sys
@@ -38,13 +38,13 @@ namespace sys
                                       {
                                       case messaging::systemMessage_t::FACTORY_RESET_START:
                                       {
-                                          board::usb::deInit();
                                           board::io::indicators::indicateFactoryReset();
                                       }
                                       break;
 
                                       case messaging::systemMessage_t::FACTORY_RESET_END:
                                       {
+                                          board::usb::deInit();
                                           board::reboot();
                                       }
                                       break;
@@ -101,8 +101,33 @@ namespace sys
             _usbConnectionHandler = std::move(usbConnectionHandler);
         }
 
+#ifdef PROJECT_TARGET_DUAL_CORE
+        bool isInputCore() override
+        {
+            return board::multicore::core() == INPUT_CORE;
+        }
+#endif
+
+#ifdef PROJECT_TARGET_LOW_POWER
+        void sleep() override
+        {
+            board::power::waitForEvent();
+        }
+
+        bool idleScan() override
+        {
+            return board::power::scanRate() == board::power::scanRate_t::IDLE;
+        }
+
+        void setIdleScan(bool state) override
+        {
+            board::power::setScanRate(state ? board::power::scanRate_t::IDLE : board::power::scanRate_t::FULL);
+        }
+#endif
+
         private:
         static constexpr uint32_t USB_CONN_CHECK_TIME   = 2000;
+        static constexpr uint8_t  INPUT_CORE            = 1;
         usbConnectionHandler_t    _usbConnectionHandler = nullptr;
     };
 }    // namespace sys
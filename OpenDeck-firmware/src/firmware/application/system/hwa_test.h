@@ -20,6 +20,8 @@ limitations under the License.
 
 #include "deps.h"
 
+#include <vector>
+
 namespace sys
 {
     class HwaTest : public Hwa
@@ -43,5 +45,37 @@ namespace sys
         void registerOnUSBconnectionHandler(sys::usbConnectionHandler_t&& usbConnectionHandler) override
         {
         }
+
+#ifdef PROJECT_TARGET_LOW_POWER
+        enum class idleHook_t : uint8_t
+        {
+            SLEEP,
+            IDLE_SCAN_ON,
+            IDLE_SCAN_OFF,
+        };
+
+        void sleep() override
+        {
+            _idleHooks.push_back(idleHook_t::SLEEP);
+        }
+
+        bool idleScan() override
+        {
+            return _idleScan;
+        }
+
+        void setIdleScan(bool state) override
+        {
+            _idleScan = state;
+            _idleHooks.push_back(state ? idleHook_t::IDLE_SCAN_ON : idleHook_t::IDLE_SCAN_OFF);
+        }
+
+        /// Board hooks in the order in which they were called: SLEEP maps to board::power::waitForEvent
+        /// (WFE or sd_app_evt_wait), IDLE_SCAN_ON/IDLE_SCAN_OFF to board::power::setScanRate.
+        std::vector<idleHook_t> _idleHooks;
+
+        /// Set by tests to simulate board switching back to full rate on input change.
+        bool _idleScan = false;
+#endif
     };
 }    // namespace sys
@@ -0,0 +1,63 @@
+/*
+
+Copyright Igor Petrovic
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*/
+
+#include "idle.h"
+
+using namespace sys;
+
+Idle::Idle(size_t runsPerRound, uint32_t scanTimeout)
+    : RUNS_PER_ROUND(runsPerRound)
+    , SCAN_TIMEOUT(scanTimeout)
+{}
+
+void Idle::activity()
+{
+    _active = true;
+}
+
+Idle::State Idle::update(uint32_t time, bool idleScan)
+{
+    State state;
+
+    if (_idleScan && !idleScan)
+    {
+        _active = true;
+    }
+
+    if (_active)
+    {
+        _active       = false;
+        _idleScan     = false;
+        _quietRuns    = 0;
+        _lastActivity = time;
+
+        return state;
+    }
+
+    state.idleScan = (time - _lastActivity) >= SCAN_TIMEOUT;
+    _idleScan      = state.idleScan;
+
+    // new data which woke the loop up could be processed by any component
+    if (++_quietRuns >= RUNS_PER_ROUND)
+    {
+        _quietRuns  = 0;
+        state.sleep = true;
+    }
+
+    return state;
+}
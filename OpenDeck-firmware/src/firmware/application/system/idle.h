@@ -0,0 +1,65 @@
+/*
+
+Copyright Igor Petrovic
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*/
+
+#pragma once
+
+#include <inttypes.h>
+#include <stddef.h>
+
+namespace sys
+{
+    /// Decides when the main loop may sleep and when inputs may be scanned at idle rate.
+    /// Loop may sleep only once a complete round of component updates passes without any
+    /// event, so that the work in progress doesn't wait for the next interrupt. Inputs are
+    /// scanned at idle rate once there are no events for the specified time.
+    class Idle
+    {
+        public:
+        struct State
+        {
+            /// Set if loop may sleep until the next interrupt.
+            bool sleep = false;
+
+            /// Set if inputs may be scanned at idle rate.
+            bool idleScan = false;
+        };
+
+        /// param [in]: runsPerRound    Amount of runs in which all components are updated once.
+        /// param [in]: scanTimeout     Time in milliseconds without events after which inputs
+        ///                             may be scanned at idle rate.
+        Idle(size_t runsPerRound, uint32_t scanTimeout);
+
+        /// Marks that an event has been generated in current run.
+        void activity();
+
+        /// Called after each run.
+        /// param [in]: time        Current time in milliseconds.
+        /// param [in]: idleScan    Whether inputs are currently scanned at idle rate. Board switches
+        ///                         back to full rate by itself on input change, which counts as activity.
+        /// returns: What the loop should do until the next run.
+        State update(uint32_t time, bool idleScan);
+
+        private:
+        const size_t   RUNS_PER_ROUND;
+        const uint32_t SCAN_TIMEOUT;
+        bool           _active       = true;
+        bool           _idleScan     = false;
+        size_t         _quietRuns    = 0;
+        uint32_t       _lastActivity = 0;
+    };
+}    // namespace sys
@@ -0,0 +1,163 @@
+/*
+
+Copyright Igor Petrovic
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*/
+
+#include "input_core.h"
+
+#include <string.h>
+
+using namespace sys;
+
+InputCore::InputCore(coreHandler_t isInputCore)
+    : _isInputCore(isInputCore)
+{}
+
+void InputCore::attach()
+{
+    MidiDispatcher.route(
+        [this]()
+        {
+            return _isInputCore() ? messaging::context_t::INPUT : messaging::context_t::MAIN;
+        },
+
+        [this](messaging::context_t context, messaging::eventType_t source, const messaging::Event& event)
+        {
+            if (context == messaging::context_t::MAIN)
+            {
+                post(source, event);
+                return;
+            }
+
+            hold();
+            MidiDispatcher.deliver(context, source, event);
+            release();
+        });
+}
+
+void InputCore::beginTick()
+{
+    while (true)
+    {
+        // announce the tick first and check for hold request afterwards: main core does the
+        // opposite, so at least one of the cores sees the flag set by the other one
+        __atomic_store_n(&_inTick, true, __ATOMIC_SEQ_CST);
+
+        if (!__atomic_load_n(&_holdRequest, __ATOMIC_SEQ_CST))
+        {
+            return;
+        }
+
+        __atomic_store_n(&_inTick, false, __ATOMIC_SEQ_CST);
+
+        while (__atomic_load_n(&_holdRequest, __ATOMIC_ACQUIRE))
+        {
+        }
+    }
+}
+
+void InputCore::endTick()
+{
+    __atomic_store_n(&_inTick, false, __ATOMIC_RELEASE);
+}
+
+size_t InputCore::drain()
+{
+    size_t count = 0;
+
+    // don't wait for the events queued while draining
+    for (size_t pending = _queue.size(); pending; pending--)
+    {
+        auto queued = _queue.front();
+
+        if (queued == nullptr)
+        {
+            break;
+        }
+
+        if (queued->event.sysEx != nullptr)
+        {
+            queued->event.sysEx = queued->sysEx;
+        }
+
+        MidiDispatcher.deliver(messaging::context_t::MAIN, queued->source, queued->event);
+        _queue.pop();
+        count++;
+    }
+
+    return count;
+}
+
+void InputCore::hold()
+{
+    if (_isInputCore())
+    {
+        return;
+    }
+
+    if (_holdDepth++)
+    {
+        return;
+    }
+
+    __atomic_store_n(&_holdRequest, true, __ATOMIC_SEQ_CST);
+
+    while (__atomic_load_n(&_inTick, __ATOMIC_SEQ_CST))
+    {
+    }
+}
+
+void InputCore::release()
+{
+    if (_isInputCore() || !_holdDepth)
+    {
+        return;
+    }
+
+    if (--_holdDepth)
+    {
+        return;
+    }
+
+    __atomic_store_n(&_holdRequest, false, __ATOMIC_RELEASE);
+}
+
+size_t InputCore::dropped() const
+{
+    return __atomic_load_n(&_dropped, __ATOMIC_RELAXED);
+}
+
+void InputCore::post(messaging::eventType_t source, const messaging::Event& event)
+{
+    auto queued = _queue.back();
+
+    if ((queued == nullptr) || (event.sysExLength > MAX_SYSEX_SIZE))
+    {
+        // input core must never wait for main core
+        __atomic_store_n(&_dropped, _dropped + 1, __ATOMIC_RELAXED);
+        return;
+    }
+
+    queued->source = source;
+    queued->event  = event;
+
+    if (event.sysEx != nullptr)
+    {
+        memcpy(queued->sysEx, event.sysEx, event.sysExLength);
+    }
+
+    _queue.push();
+}
@@ -0,0 +1,91 @@
+/*
+
+Copyright Igor Petrovic
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*/
+
+#pragma once
+
+#include "application/messaging/messaging.h"
+#include "application/io/buttons/common.h"
+#include "application/util/function/function.h"
+#include "board/spsc.h"
+
+#include <inttypes.h>
+#include <stddef.h>
+
+namespace sys
+{
+    /// Splits event processing between main core and input core, on which inputs are
+    /// processed in a loop of ticks. Listeners registered with messaging::context_t::INPUT
+    /// run on input core, all others on main core.
+    /// Events generated on input core for the listeners on main core are queued and passed
+    /// to them with drain(). Events generated on main core for the listeners on input core are
+    /// passed to them directly from main core while input core is held between two ticks.
+    /// Main core should also hold input core while changing any state which input core uses.
+    class InputCore
+    {
+        public:
+        /// Returns true if called from input core.
+        using coreHandler_t = util::Function<bool()>;
+
+        InputCore(coreHandler_t isInputCore);
+
+        /// Starts routing the events between cores.
+        void attach();
+
+        /// Input core: called before each tick. Waits while input core is held.
+        void beginTick();
+
+        /// Input core: called after each tick.
+        void endTick();
+
+        /// Main core: passes events queued on input core to the listeners on main core.
+        /// returns: Amount of passed events.
+        size_t drain();
+
+        /// Main core: waits until input core completes current tick and keeps it from
+        /// starting the next one until release() is called. Calls can be nested.
+        /// Has no effect when called from input core.
+        void hold();
+
+        /// Main core: allows input core to continue once all hold() calls are released.
+        void release();
+
+        /// Returns the amount of events dropped because the queue was full.
+        size_t dropped() const;
+
+        private:
+        /// Sysex payload is copied into the queue since the event only points to it.
+        static constexpr size_t MAX_SYSEX_SIZE = io::buttons::SYSEX_MACRO_MAX_LENGTH + 2;
+        static constexpr size_t QUEUE_SIZE     = 32;
+
+        struct Queued
+        {
+            messaging::eventType_t source                = messaging::eventType_t::SYSTEM;
+            messaging::Event       event                 = {};
+            uint8_t                sysEx[MAX_SYSEX_SIZE] = {};
+        };
+
+        coreHandler_t                             _isInputCore;
+        board::util::SpscRing<Queued, QUEUE_SIZE> _queue;
+        size_t                                    _dropped     = 0;
+        size_t                                    _holdDepth   = 0;
+        bool                                      _holdRequest = false;
+        bool                                      _inTick      = false;
+
+        void post(messaging::eventType_t source, const messaging::Event& event);
+    };
+}    // namespace sys
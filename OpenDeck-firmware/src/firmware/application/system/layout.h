@@ -567,6 +567,11 @@ namespace sys
                 .requestId     = SYSEX_CR_RESTORE_END,
                 .connOpenCheck = true,
             },
+
+            {
+                .requestId     = SYSEX_CR_BOOT_TIMES,
+                .connOpenCheck = true,
+            },
         };
 
         public:
@@ -25,6 +25,7 @@ limitations under the License.
 #include "application/io/analog/common.h"
 #include "application/io/buttons/buttons.h"
 #include "application/protocol/midi/common.h"
+#include "application/util/logger/logger.h"
 #include "bootloader/fw_selector/fw_selector.h"
 
 #include "core/mcu.h"
@@ -43,18 +44,68 @@ System::System(Hwa&        hwa,
     , _sysExConf(
           _sysExDataHandler,
           SYS_EX_MID)
+    , _articulation([this](uint8_t note, uint8_t velocity)
+                    {
+                        sendSaxNote(note, velocity);
+                    })
+#ifdef PROJECT_TARGET_DUAL_CORE
+    , _inputCore([this]()
+                 {
+                     return _hwa.isInputCore();
+                 })
+#endif
+#ifdef PROJECT_TARGET_LOW_POWER
+    , _idle(static_cast<size_t>(ioComponent_t::AMOUNT), IDLE_SCAN_TIMEOUT)
+#endif
 {
     _analog = static_cast<::io::analog::Analog*>(_components.io().at(static_cast<size_t>(ioComponent_t::ANALOG)));
     _buttons = static_cast<::io::buttons::Buttons*>(_components.io().at(static_cast<size_t>(ioComponent_t::BUTTONS)));
 
+    if (_analog != nullptr)
+    {
+        // articulation runs on every new breath reading instead of waiting for the sax update
+        _analog->registerSampleHandler([this](size_t index, uint16_t value)
+                                       {
+                                           if (_saxBreathGated && (index == _saxBreathIndex))
+                                           {
+                                               _articulation.breath(value);
+                                           }
+                                       });
+    }
+
+#ifdef PROJECT_TARGET_LOW_POWER
+    // any event generated from inputs or received from host keeps the loop awake
+    for (auto source : {
+             messaging::eventType_t::ANALOG,
+             messaging::eventType_t::ANALOG_BUTTON,
+             messaging::eventType_t::BUTTON,
+             messaging::eventType_t::ENCODER,
+             messaging::eventType_t::TOUCHSCREEN_BUTTON,
+             messaging::eventType_t::TOUCHSCREEN_SCREEN,
+             messaging::eventType_t::MIDI_IN,
+             messaging::eventType_t::PROGRAM,
+         })
+    {
+        MidiDispatcher.listen(source,
+                              [this](const messaging::Event&)
+                              {
+                                  _idle.activity();
+                              });
+    }
+#endif
+
     MidiDispatcher.listen(messaging::eventType_t::MIDI_IN,
                           [this](const messaging::Event& event)
                           {
+                              // configuration and preset changes affect input components
+                              InputHold hold(*this);
+
                               switch (event.message)
                               {
                               case midi::messageType_t::PROGRAM_CHANGE:
                               {
-                                  if (_components.database().read(database::Config::Section::system_t::SYSTEM_SETTINGS,
+                                  if (!_components.database().isFactoryResetInProgress() &&
+                                      _components.database().read(database::Config::Section::system_t::SYSTEM_SETTINGS,
                                                                   Config::systemSetting_t::ENABLE_PRESET_CHANGE_WITH_PROGRAM_CHANGE_IN))
                                   {
                                       _components.database().setPreset(event.index);
@@ -64,7 +115,10 @@ System::System(Hwa&        hwa,
 
                               case midi::messageType_t::SYS_EX:
                               {
-                                  _sysExConf.handleMessage(event.sysEx, event.sysExLength);
+                                  if (!handleBulkRequest(event.sysEx, event.sysExLength))
+                                  {
+                                      _sysExConf.handleMessage(event.sysEx, event.sysExLength);
+                                  }
 
                                   if (_backupRestoreState == backupRestoreState_t::BACKUP)
                                   {
@@ -81,6 +135,8 @@ System::System(Hwa&        hwa,
     MidiDispatcher.listen(messaging::eventType_t::SYSTEM,
                           [this](const messaging::Event& event)
                           {
+                              InputHold hold(*this);
+
                               switch (event.systemMessage)
                               {
                               case messaging::systemMessage_t::PRESET_CHANGED:
@@ -92,8 +148,7 @@ System::System(Hwa&        hwa,
                               case messaging::systemMessage_t::SAX_TRANSPOSE_INC_REQ:
                               case messaging::systemMessage_t::SAX_TRANSPOSE_DEC_REQ:
                               {
-                                  // Custom system setting index 11: sax transpose raw value 0..48 (= -24..+24 semis).
-                                  static constexpr size_t  SAX_TRANSPOSE_SETTING_INDEX = 11;
+                                  // Sax transpose raw value 0..48 (= -24..+24 semis).
                                   static constexpr uint16_t SAX_TRANSPOSE_INIT_FLAG    = 0x8000;
                                   static constexpr uint16_t SAX_TRANSPOSE_VALUE_MASK   = 0x7FFF;
                                   static constexpr uint16_t RAW_MIN                    = 0;
@@ -106,7 +161,7 @@ System::System(Hwa&        hwa,
                                   }
 
                                   const uint16_t stored = _components.database().read(database::Config::Section::system_t::SYSTEM_SETTINGS,
-                                                                                     SAX_TRANSPOSE_SETTING_INDEX);
+                                                                                     Config::systemSetting_t::SAX_TRANSPOSE);
                                   uint16_t current       = static_cast<uint16_t>(stored & SAX_TRANSPOSE_VALUE_MASK);
                                   current                = core::util::CONSTRAIN(current, RAW_MIN, RAW_MAX);
 
@@ -126,7 +181,7 @@ System::System(Hwa&        hwa,
                                   if (updated != current)
                                   {
                                       _components.database().update(database::Config::Section::system_t::SYSTEM_SETTINGS,
-                                                                    SAX_TRANSPOSE_SETTING_INDEX,
+                                                                    Config::systemSetting_t::SAX_TRANSPOSE,
                                                                     static_cast<uint16_t>(SAX_TRANSPOSE_INIT_FLAG | updated));
                                   }
 
@@ -140,8 +195,7 @@ System::System(Hwa&        hwa,
 
                               case messaging::systemMessage_t::SAX_TRANSPOSE_SET_REQ:
                               {
-                                  // Custom system setting index 11: sax transpose raw value 0..48 (= -24..+24 semis).
-                                  static constexpr size_t  SAX_TRANSPOSE_SETTING_INDEX = 11;
+                                  // Sax transpose raw value 0..48 (= -24..+24 semis).
                                   static constexpr uint16_t SAX_TRANSPOSE_INIT_FLAG    = 0x8000;
                                   static constexpr uint16_t SAX_TRANSPOSE_VALUE_MASK   = 0x7FFF;
                                   static constexpr uint16_t RAW_MIN                    = 0;
@@ -149,14 +203,14 @@ System::System(Hwa&        hwa,
 
                                   const uint16_t requested = core::util::CONSTRAIN(static_cast<uint16_t>(event.value), RAW_MIN, RAW_MAX);
                                   const uint16_t stored = _components.database().read(database::Config::Section::system_t::SYSTEM_SETTINGS,
-                                                                                    SAX_TRANSPOSE_SETTING_INDEX);
+                                                                                    Config::systemSetting_t::SAX_TRANSPOSE);
                                   uint16_t current       = static_cast<uint16_t>(stored & SAX_TRANSPOSE_VALUE_MASK);
                                   current                = core::util::CONSTRAIN(current, RAW_MIN, RAW_MAX);
 
                                   if (requested != current)
                                   {
                                       _components.database().update(database::Config::Section::system_t::SYSTEM_SETTINGS,
-                                                                    SAX_TRANSPOSE_SETTING_INDEX,
+                                                                    Config::systemSetting_t::SAX_TRANSPOSE,
                                                                     static_cast<uint16_t>(SAX_TRANSPOSE_INIT_FLAG | requested));
                                   }
 
@@ -174,7 +228,6 @@ System::System(Hwa&        hwa,
                                       break;
                                   }
 
-                                  static constexpr size_t  SAX_PB_CENTER_SETTING_INDEX = 13;
                                   static constexpr uint16_t PB_CENTER_DEFAULT          = 8192;
 
                                   // Use the first PITCH_BEND analog input as the calibration source.
@@ -204,7 +257,7 @@ System::System(Hwa&        hwa,
                                   const uint16_t storedCenter = (rawCenter <= midi::MAX_VALUE_14BIT) ? rawCenter : PB_CENTER_DEFAULT;
 
                                   _components.database().update(database::Config::Section::system_t::SYSTEM_SETTINGS,
-                                                                SAX_PB_CENTER_SETTING_INDEX,
+                                                                Config::systemSetting_t::SAX_PB_CENTER,
                                                                 storedCenter);
 
                                   // Apply to all PITCH_BEND analog inputs.
@@ -221,19 +274,28 @@ System::System(Hwa&        hwa,
 
                               case messaging::systemMessage_t::PRESET_CHANGE_INC_REQ:
                               {
-                                  _components.database().setPreset(_components.database().getPreset() + 1);
+                                  if (!_components.database().isFactoryResetInProgress())
+                                  {
+                                      _components.database().setPreset(_components.database().getPreset() + 1);
+                                  }
                               }
                               break;
 
                               case messaging::systemMessage_t::PRESET_CHANGE_DEC_REQ:
                               {
-                                  _components.database().setPreset(_components.database().getPreset() - 1);
+                                  if (!_components.database().isFactoryResetInProgress())
+                                  {
+                                      _components.database().setPreset(_components.database().getPreset() - 1);
+                                  }
                               }
                               break;
 
                               case messaging::systemMessage_t::PRESET_CHANGE_DIRECT_REQ:
                               {
-                                  _components.database().setPreset(event.index);
+                                  if (!_components.database().isFactoryResetInProgress())
+                                  {
+                                      _components.database().setPreset(event.index);
+                                  }
                               }
                               break;
 
@@ -244,6 +306,17 @@ System::System(Hwa&        hwa,
 
     ConfigHandler.registerConfig(
         sys::Config::block_t::GLOBAL,
+        {
+            sys::Config::Section::global_t::SYSTEM_SETTINGS,
+            sys::Config::Section::global_t::SAX_FINGERING_MASK_LO14,
+            sys::Config::Section::global_t::SAX_FINGERING_MASK_HI12_ENABLE,
+            sys::Config::Section::global_t::SAX_FINGERING_NOTE,
+            sys::Config::Section::global_t::SAX_FINGERING_CAPTURE,
+            sys::Config::Section::global_t::SAX_FINGERING_CURRENT_MASK,
+            sys::Config::Section::global_t::SAX_FINGERING_CLEAR,
+            sys::Config::Section::global_t::SAX_FINGERING_CARE_LO14,
+            sys::Config::Section::global_t::SAX_FINGERING_CARE_HI12,
+        },
         // read
         [this](uint8_t section, size_t index, uint16_t& value)
         {
@@ -259,7 +332,12 @@ System::System(Hwa&        hwa,
 
 bool System::init()
 {
-    _scheduler.init();
+    TaskScheduler.clear();
+    _firstRunDone = false;
+
+#ifdef PROJECT_TARGET_DUAL_CORE
+    _inputCore.attach();
+#endif
 
     _cInfo.registerHandler([this](size_t group, size_t index)
                            {
@@ -283,12 +361,13 @@ bool System::init()
 
     _hwa.registerOnUSBconnectionHandler([this]()
                                         {
-                                            _scheduler.registerTask({ SCHEDULED_TASK_FORCED_REFRESH,
-                                                                      USB_CHANGE_FORCED_REFRESH_DELAY,
-                                                                      [this]()
-                                                                      {
-                                                                          forceComponentRefresh();
-                                                                      } });
+                                            TaskScheduler.registerTask(_usbRefreshTask,
+                                                                       USB_CHANGE_FORCED_REFRESH_DELAY,
+                                                                       [this]()
+                                                                       {
+                                                                           // host doesn't know anything that has been sent before connection
+                                                                           forceComponentRefresh(false);
+                                                                       });
                                         });
 
     if (!_hwa.init())
@@ -296,11 +375,15 @@ bool System::init()
         return false;
     }
 
+    bootStageDone(bootStage_t::HW);
+
     if (!_components.database().init(_databaseHandlers))
     {
         return false;
     }
 
+    bootStageDone(bootStage_t::DATABASE);
+
     for (size_t i = 0; i < _components.io().size(); i++)
     {
         auto component = _components.io().at(i);
@@ -313,9 +396,12 @@ bool System::init()
 
     ensureSaxAnalogConfigured();
 
-    // Sync sax transpose (custom system setting index 11) to interested components.
+#ifdef PROJECT_TARGET_SAX_TABLE_UPLOAD
+    recoverSaxTableCommit();
+#endif
+
+    // Sync sax transpose to interested components.
     {
-        static constexpr size_t  SAX_TRANSPOSE_SETTING_INDEX = 11;
         static constexpr uint16_t SAX_TRANSPOSE_INIT_FLAG    = 0x8000;
         static constexpr uint16_t SAX_TRANSPOSE_VALUE_MASK   = 0x7FFF;
         static constexpr uint16_t RAW_MIN                    = 0;
@@ -324,7 +410,7 @@ bool System::init()
         // One-time migration/defaulting: mark setting as initialized (MSB).
         // If legacy DB left this at 0 without initialization, set to 0 semis (raw 24).
         const uint16_t stored = _components.database().read(database::Config::Section::system_t::SYSTEM_SETTINGS,
-                                                           SAX_TRANSPOSE_SETTING_INDEX);
+                                                           Config::systemSetting_t::SAX_TRANSPOSE);
 
         if ((stored & SAX_TRANSPOSE_INIT_FLAG) == 0)
         {
@@ -332,12 +418,12 @@ bool System::init()
             const uint16_t initValue   = (legacyValue == 0) ? static_cast<uint16_t>(24) : legacyValue;
 
             _components.database().update(database::Config::Section::system_t::SYSTEM_SETTINGS,
-                                          SAX_TRANSPOSE_SETTING_INDEX,
+                                          Config::systemSetting_t::SAX_TRANSPOSE,
                                           static_cast<uint16_t>(SAX_TRANSPOSE_INIT_FLAG | core::util::CONSTRAIN(initValue, RAW_MIN, RAW_MAX)));
         }
 
         const uint16_t storedAfter = _components.database().read(database::Config::Section::system_t::SYSTEM_SETTINGS,
-                                                                SAX_TRANSPOSE_SETTING_INDEX);
+                                                                Config::systemSetting_t::SAX_TRANSPOSE);
         uint16_t       current     = static_cast<uint16_t>(storedAfter & SAX_TRANSPOSE_VALUE_MASK);
         current                    = core::util::CONSTRAIN(current, RAW_MIN, RAW_MAX);
 
@@ -351,11 +437,10 @@ bool System::init()
     {
         if (_analog != nullptr)
         {
-            static constexpr size_t  SAX_PB_CENTER_SETTING_INDEX = 13;
             static constexpr uint16_t PB_CENTER_DEFAULT          = 8192;
 
             uint16_t storedCenter = _components.database().read(database::Config::Section::system_t::SYSTEM_SETTINGS,
-                                                               SAX_PB_CENTER_SETTING_INDEX);
+                                                               Config::systemSetting_t::SAX_PB_CENTER);
             if (storedCenter > midi::MAX_VALUE_14BIT)
             {
                 storedCenter = PB_CENTER_DEFAULT;
@@ -376,13 +461,14 @@ bool System::init()
     {
         if (_analog != nullptr)
         {
-            static constexpr size_t  SAX_PB_DEADZONE_SETTING_INDEX = 12;
             const uint16_t storedDeadzone = _components.database().read(database::Config::Section::system_t::SYSTEM_SETTINGS,
-                                                                        SAX_PB_DEADZONE_SETTING_INDEX);
+                                                                        Config::systemSetting_t::SAX_PB_DEADZONE);
             _analog->setPitchBendDeadzone(storedDeadzone);
         }
     }
 
+    bootStageDone(bootStage_t::IO);
+
     _sysExConf.setLayout(_layout.layout());
     _sysExConf.setupCustomRequests(_layout.customRequests());
 
@@ -396,6 +482,8 @@ bool System::init()
         }
     }
 
+    bootStageDone(bootStage_t::PROTOCOLS);
+
     // on startup, indicate current program for all channels
     for (int i = 1; i <= 16; i++)
     {
@@ -419,14 +507,178 @@ bool System::init()
 ioComponent_t System::run()
 {
     _hwa.update();
-    auto retVal = checkComponents();
+
+#ifdef PROJECT_TARGET_DUAL_CORE
+    _inputCore.drain();
+#endif
+
+    auto retVal = ioComponent_t::AMOUNT;
+
+    if (_components.database().isFactoryResetInProgress())
+    {
+        // Single batch of defaults is written per run so that protocols and configuration
+        // requests keep being serviced. Components aren't updated until the reset is done
+        // since their configuration is being rewritten.
+        _components.database().updateFactoryReset();
+
+#ifdef PROJECT_TARGET_LOW_POWER
+        _idle.activity();
+#endif
+    }
+    else
+    {
+        retVal = checkComponents();
+
+        for (size_t i = 0; i < _components.io().size(); i++)
+        {
+            auto component = _components.io().at(i);
+
+            if ((component != nullptr) && !runsOnInputCore(static_cast<ioComponent_t>(i)))
+            {
+                component->processEvents();
+            }
+        }
+
+#ifndef PROJECT_TARGET_DUAL_CORE
+        updateSax();
+#endif
+    }
+
     checkProtocols();
-    updateSax();
-    _scheduler.update();
+
+    TaskScheduler.update();
+    updateForcedRefresh();
+    sendLog();
+    updateIdle();
+
+    if (!_firstRunDone)
+    {
+        _firstRunDone = true;
+        bootStageDone(bootStage_t::FIRST_RUN);
+    }
 
     return retVal;
 }
 
+#ifdef PROJECT_TARGET_DUAL_CORE
+/// Single tick of input core: updates all input components and sax.
+/// Inputs are read from the frames published by the board, so ticks follow the scan rate
+/// without waiting for the next millisecond.
+void System::runInput()
+{
+    static constexpr ioComponent_t INPUT_COMPONENTS[] = {
+        ioComponent_t::BUTTONS,
+        ioComponent_t::ENCODERS,
+        ioComponent_t::ANALOG,
+    };
+
+    _inputCore.beginTick();
+
+    if (!_components.database().isFactoryResetInProgress())
+    {
+        for (auto index : INPUT_COMPONENTS)
+        {
+            auto component = _components.io().at(static_cast<size_t>(index));
+
+            if (component == nullptr)
+            {
+                continue;
+            }
+
+            if (!component->updateChanged())
+            {
+                component->updateAll();
+            }
+
+            component->processEvents();
+        }
+
+        updateSax();
+    }
+
+    _inputCore.endTick();
+}
+#endif
+
+System::InputHold::InputHold(System& system)
+    : _system(system)
+{
+#ifdef PROJECT_TARGET_DUAL_CORE
+    _system._inputCore.hold();
+#endif
+}
+
+System::InputHold::~InputHold()
+{
+#ifdef PROJECT_TARGET_DUAL_CORE
+    _system._inputCore.release();
+#endif
+}
+
+/// Lets the MCU sleep once nothing is left to process and slows down input scanning
+/// after a period of inactivity. Used on low power targets only.
+void System::updateIdle()
+{
+#ifdef PROJECT_TARGET_LOW_POWER
+    const bool IDLE_SCAN = _hwa.idleScan();
+    const auto STATE     = _idle.update(core::mcu::timing::ms(), IDLE_SCAN);
+
+    if (STATE.idleScan != IDLE_SCAN)
+    {
+        _hwa.setIdleScan(STATE.idleScan);
+    }
+
+    if (STATE.sleep)
+    {
+        _hwa.sleep();
+    }
+#endif
+}
+
+/// Stores the time at which the specified startup stage was completed.
+void System::bootStageDone(bootStage_t stage)
+{
+    _bootTime[static_cast<uint8_t>(stage)] = core::mcu::timing::ms();
+}
+
+void System::sendLog()
+{
+#ifdef OPENDECK_BINARY_LOGGER
+    // log is sent only once configurator is connected so that other hosts don't receive it
+    if (!_sysExConf.isConfigurationEnabled())
+    {
+        return;
+    }
+
+    using namespace util::binary_log;
+
+    static constexpr size_t MAX_PACKED_SIZE = packedSize(MAX_RECORD_SIZE);
+
+    std::array<uint8_t, MAX_RECORD_SIZE>      records;
+    std::array<uint8_t, MAX_PACKED_SIZE>      packed;
+    std::array<uint16_t, MAX_PACKED_SIZE + 1> message;
+
+    const size_t SIZE = APP_LOGGER.read(records.data(), records.size());
+
+    if (!SIZE)
+    {
+        return;
+    }
+
+    // log records are 8-bit: encode them so that they can be sent using sysex
+    const size_t PACKED_SIZE = pack7Bit(records.data(), SIZE, packed.data());
+
+    message[0] = SYSEX_CM_LOG;
+
+    for (size_t i = 0; i < PACKED_SIZE; i++)
+    {
+        message[i + 1] = packed[i];
+    }
+
+    _sysExConf.sendCustomMessage(message.data(), PACKED_SIZE + 1);
+#endif
+}
+
 uint8_t System::resolvedMidiChannel() const
 {
     const uint8_t globalChannel = _components.database().read(database::Config::Section::global_t::MIDI_SETTINGS,
@@ -454,11 +706,8 @@ void System::ensureSaxAnalogConfigured()
     // That prevented using a second pressure sensor for Pitch Bend while sax breath
     // was enabled. Keep only trim + breath reserved so other analog inputs can be
     // freely configured (e.g. PITCH_BEND).
-    static constexpr size_t SAX_BREATH_ENABLE_SETTING_INDEX      = 6;
-    static constexpr size_t SAX_BREATH_ANALOG_INDEX_SETTING_INDEX = 7;
-
     const uint16_t enabled = _components.database().read(database::Config::Section::system_t::SYSTEM_SETTINGS,
-                                                         SAX_BREATH_ENABLE_SETTING_INDEX);
+                                                         Config::systemSetting_t::SAX_BREATH_ENABLE);
 
     if (!enabled)
     {
@@ -466,7 +715,7 @@ void System::ensureSaxAnalogConfigured()
     }
 
     const uint16_t breathIndexSetting = _components.database().read(database::Config::Section::system_t::SYSTEM_SETTINGS,
-                                                                    SAX_BREATH_ANALOG_INDEX_SETTING_INDEX);
+                                                                    Config::systemSetting_t::SAX_BREATH_ANALOG_INDEX);
 
     const size_t breathIndex = static_cast<size_t>(breathIndexSetting);
 
@@ -505,33 +754,42 @@ void System::updateSax()
         return;
     }
 
-    static constexpr size_t SAX_BREATH_ENABLE_SETTING_INDEX       = 6;
-    static constexpr size_t SAX_BREATH_ANALOG_INDEX_SETTING_INDEX  = 7;
-    static constexpr size_t SAX_BREATH_CC_SETTING_INDEX            = 8;
-    static constexpr size_t SAX_BREATH_MID_PERCENT_SETTING_INDEX   = 10;
     static constexpr size_t TRIM_ANALOG_INDEX                      = 0;
     static constexpr uint16_t UNKNOWN                               = 0xFFFF;
     static constexpr int32_t TRIM_RANGE_PERCENT                     = 15;
+    static constexpr uint32_t SAX_NOTE_ON_HYSTERESIS_PERCENT        = 2;
+    static constexpr uint32_t SAX_FULL_VELOCITY_RISE_PERCENT        = 10;
+    static constexpr uint16_t SAX_VELOCITY_SAMPLES                  = 8;
 
     const uint16_t enabled = _components.database().read(database::Config::Section::system_t::SYSTEM_SETTINGS,
-                                                         SAX_BREATH_ENABLE_SETTING_INDEX);
+                                                         Config::systemSetting_t::SAX_BREATH_ENABLE);
 
     if (!enabled)
     {
         _lastSaxBreathValue = UNKNOWN;
+        setSaxBreathGated(false);
         updateSaxFingering();
         return;
     }
 
     const size_t breathIndex = static_cast<size_t>(
         _components.database().read(database::Config::Section::system_t::SYSTEM_SETTINGS,
-                                   SAX_BREATH_ANALOG_INDEX_SETTING_INDEX));
+                                   Config::systemSetting_t::SAX_BREATH_ANALOG_INDEX));
 
     if (breathIndex >= ::io::analog::Collection::SIZE(::io::analog::GROUP_ANALOG_INPUTS))
     {
+        setSaxBreathGated(false);
         return;
     }
 
+    if (breathIndex != _saxBreathIndex)
+    {
+        _articulation.reset();
+        _saxBreathIndex = breathIndex;
+    }
+
+    setSaxBreathGated(true);
+
     // Force fast polling for dedicated sax inputs.
     _analog->updateSingle(breathIndex);
     if (breathIndex != TRIM_ANALOG_INDEX)
@@ -568,9 +826,9 @@ void System::updateSax()
     }
 
     const uint16_t midPercentRaw = _components.database().read(database::Config::Section::system_t::SYSTEM_SETTINGS,
-                                                              SAX_BREATH_MID_PERCENT_SETTING_INDEX);
+                                                              Config::systemSetting_t::SAX_BREATH_MID_PERCENT);
     const uint16_t ccMode        = _components.database().read(database::Config::Section::system_t::SYSTEM_SETTINGS,
-                                                              SAX_BREATH_CC_SETTING_INDEX);
+                                                              Config::systemSetting_t::SAX_BREATH_CC);
 
     const uint16_t breathRaw = _analog->value(breathIndex);
 
@@ -595,6 +853,17 @@ void System::updateSax()
         }
     }
 
+    // articulation works with raw readings: note starts slightly above the breath midpoint
+    // and stops once breath falls back to it
+    const uint32_t adcMax = (1UL << _analog->adcBits()) - 1;
+
+    Articulation::Config articulation;
+    articulation.offThreshold    = static_cast<uint16_t>((static_cast<uint32_t>(midPercent) * adcMax) / 100);
+    articulation.onThreshold     = static_cast<uint16_t>(std::min(articulation.offThreshold + ((adcMax * SAX_NOTE_ON_HYSTERESIS_PERCENT) / 100), adcMax));
+    articulation.fullScaleRise   = static_cast<uint16_t>((adcMax * SAX_FULL_VELOCITY_RISE_PERCENT) / 100);
+    articulation.velocitySamples = SAX_VELOCITY_SAMPLES;
+    _articulation.configure(articulation);
+
     const uint16_t midValue = static_cast<uint16_t>((midPercent * 127 + 50) / 100);
 
     uint16_t outValue = 0;
@@ -618,6 +887,8 @@ void System::updateSax()
 
     if ((_lastSaxBreathValue != UNKNOWN) && (outValue == _lastSaxBreathValue))
     {
+        // fingering still has to be followed while breath is held steady
+        updateSaxFingering();
         return;
     }
 
@@ -661,14 +932,6 @@ void System::updateSax()
 
 void System::updateSaxFingering()
 {
-    // UI/firmware contract: 26 keys, split into lo14 + hi12.
-    static constexpr uint8_t  KEY_COUNT   = 26;
-    static constexpr uint8_t  LO_BITS     = 14;
-    static constexpr uint32_t LO_MASK     = (1u << LO_BITS) - 1u; // 0x3FFF
-    static constexpr uint8_t  HI_BITS     = KEY_COUNT - LO_BITS;  // 12
-    static constexpr uint32_t HI_MASK     = (1u << HI_BITS) - 1u; // 0x0FFF
-    static constexpr uint32_t ENABLE_BIT  = (1u << HI_BITS);      // 0x1000
-
     if (_buttons == nullptr)
     {
         return;
@@ -690,34 +953,31 @@ void System::updateSaxFingering()
     _lastSaxFingeringMask = mask;
 
     // Resolve transpose (0..48 where 24 == 0 semitones).
-    const uint16_t transposeRaw = _components.database().read(database::Config::Section::system_t::SYSTEM_SETTINGS, 11);
+    const uint16_t transposeRaw = _components.database().read(database::Config::Section::system_t::SYSTEM_SETTINGS,
+                                                              Config::systemSetting_t::SAX_TRANSPOSE);
     const int32_t  transpose    = static_cast<int32_t>(core::util::CONSTRAIN(transposeRaw, static_cast<uint16_t>(0), static_cast<uint16_t>(48))) - 24;
 
-    int16_t resolvedNote = -1;
-
-    for (uint16_t entry = 0; entry < 128; entry++)
+#ifdef PROJECT_TARGET_SAX_FINGERING_INDEX
+    if (_saxFingeringDirty)
     {
-        const uint32_t hiEnable = _components.database().read(database::Config::Section::global_t::SAX_FINGERING_MASK_HI12_ENABLE, entry);
-        if ((hiEnable & ENABLE_BIT) == 0)
-        {
-            continue;
-        }
-
-        const uint32_t lo = _components.database().read(database::Config::Section::global_t::SAX_FINGERING_MASK_LO14, entry) & LO_MASK;
-        const uint32_t hi = (hiEnable & HI_MASK);
-        const uint32_t entryMask = lo | (hi << LO_BITS);
+        loadSaxFingering();
+    }
 
-        if (entryMask != mask)
-        {
-            continue;
-        }
+    int16_t resolvedNote = _saxFingering.resolve(mask);
+#else
+    int16_t resolvedNote = resolveSaxFingering(mask);
+#endif
 
-        const uint32_t noteRaw = _components.database().read(database::Config::Section::global_t::SAX_FINGERING_NOTE, entry) & 0x7Fu;
-        int32_t noteWithTranspose = static_cast<int32_t>(noteRaw) + transpose;
-        noteWithTranspose         = core::util::CONSTRAIN(noteWithTranspose, static_cast<int32_t>(0), static_cast<int32_t>(127));
+    if (resolvedNote != Fingering::NO_NOTE)
+    {
+        resolvedNote = static_cast<int16_t>(core::util::CONSTRAIN(static_cast<int32_t>(resolvedNote) + transpose, static_cast<int32_t>(0), static_cast<int32_t>(127)));
+    }
 
-        resolvedNote = static_cast<int16_t>(noteWithTranspose);
-        break;
+    if (_saxBreathGated)
+    {
+        // note timing and velocity are determined by breath
+        _articulation.note(resolvedNote);
+        return;
     }
 
     if (resolvedNote == _lastSaxFingeringNote)
@@ -725,34 +985,134 @@ void System::updateSaxFingering()
         return;
     }
 
-    const uint8_t channel = resolvedMidiChannel();
-
     // Monophonic: turn off previous note, then turn on new note.
     if (_lastSaxFingeringNote >= 0)
     {
-        messaging::Event off = {};
-        off.componentIndex   = 0;
-        off.channel          = channel;
-        off.index            = static_cast<uint16_t>(_lastSaxFingeringNote);
-        off.value            = 0;
-        off.message          = midi::messageType_t::NOTE_OFF;
-        MidiDispatcher.notify(messaging::eventType_t::BUTTON, off);
+        sendSaxNote(static_cast<uint8_t>(_lastSaxFingeringNote), 0);
     }
 
     if (resolvedNote >= 0)
     {
-        messaging::Event on = {};
-        on.componentIndex   = 0;
-        on.channel          = channel;
-        on.index            = static_cast<uint16_t>(resolvedNote);
-        on.value            = 127;
-        on.message          = midi::messageType_t::NOTE_ON;
-        MidiDispatcher.notify(messaging::eventType_t::BUTTON, on);
+        sendSaxNote(static_cast<uint8_t>(resolvedNote), 127);
     }
 
     _lastSaxFingeringNote = resolvedNote;
 }
 
+/// Reads single entry of the fingering table from database.
+/// returns: False if the entry is disabled.
+bool System::readSaxFingering(size_t entry, Fingering::Entry& fingering)
+{
+    // UI/firmware contract: 26 keys, split into lo14 + hi12.
+    static constexpr uint8_t  KEY_COUNT   = 26;
+    static constexpr uint8_t  LO_BITS     = 14;
+    static constexpr uint32_t LO_MASK     = (1u << LO_BITS) - 1u; // 0x3FFF
+    static constexpr uint8_t  HI_BITS     = KEY_COUNT - LO_BITS;  // 12
+    static constexpr uint32_t HI_MASK     = (1u << HI_BITS) - 1u; // 0x0FFF
+    static constexpr uint32_t ENABLE_BIT  = (1u << HI_BITS);      // 0x1000
+
+    const uint32_t hiEnable = _components.database().read(database::Config::Section::global_t::SAX_FINGERING_MASK_HI12_ENABLE, entry);
+    if ((hiEnable & ENABLE_BIT) == 0)
+    {
+        return false;
+    }
+
+    const uint32_t lo     = _components.database().read(database::Config::Section::global_t::SAX_FINGERING_MASK_LO14, entry) & LO_MASK;
+    const uint32_t hi     = (hiEnable & HI_MASK);
+    const uint32_t careLo = _components.database().read(database::Config::Section::global_t::SAX_FINGERING_CARE_LO14, entry) & LO_MASK;
+    const uint32_t careHi = _components.database().read(database::Config::Section::global_t::SAX_FINGERING_CARE_HI12, entry) & HI_MASK;
+
+    fingering.keys = lo | (hi << LO_BITS);
+    fingering.care = careLo | (careHi << LO_BITS);
+    fingering.note = _components.database().read(database::Config::Section::global_t::SAX_FINGERING_NOTE, entry) & 0x7Fu;
+
+    return true;
+}
+
+#ifdef PROJECT_TARGET_SAX_FINGERING_INDEX
+/// Compiles enabled entries of the fingering table from database so that
+/// the note can be resolved without reading the table on each key change.
+void System::loadSaxFingering()
+{
+    // Cleared before the table is read: table change during the load sets it again
+    // so that the change isn't lost.
+    _saxFingeringDirty = false;
+
+    _saxFingering.clear();
+
+    // entries are checked in table order: the first one which matches wins
+    for (uint16_t entry = 0; entry < SAX_FINGERING_ENTRIES; entry++)
+    {
+        Fingering::Entry fingering;
+
+        if (readSaxFingering(entry, fingering))
+        {
+            _saxFingering.add(fingering);
+        }
+    }
+
+    _saxFingering.build();
+}
+#else
+/// Resolves the note by reading the fingering table from database in table order.
+/// Used on targets without RAM reserved for the compiled fingering table.
+int16_t System::resolveSaxFingering(uint32_t mask)
+{
+    for (uint16_t entry = 0; entry < SAX_FINGERING_ENTRIES; entry++)
+    {
+        Fingering::Entry fingering;
+
+        if (readSaxFingering(entry, fingering) && !((mask ^ fingering.keys) & fingering.care))
+        {
+            return fingering.note;
+        }
+    }
+
+    return Fingering::NO_NOTE;
+}
+#endif
+
+/// Switches between notes gated by breath and notes following fingering only.
+/// Note playing in the mode which is left is stopped.
+void System::setSaxBreathGated(bool state)
+{
+    if (state == _saxBreathGated)
+    {
+        return;
+    }
+
+    if (state)
+    {
+        if (_lastSaxFingeringNote >= 0)
+        {
+            sendSaxNote(static_cast<uint8_t>(_lastSaxFingeringNote), 0);
+            _lastSaxFingeringNote = -1;
+        }
+    }
+    else
+    {
+        _articulation.reset();
+    }
+
+    _saxBreathGated = state;
+
+    // resolve the fingering again in the new mode
+    _lastSaxFingeringMask = 0xFFFFFFFFu;
+}
+
+/// Sends note on for non-zero velocity and note off otherwise.
+void System::sendSaxNote(uint8_t note, uint8_t velocity)
+{
+    messaging::Event event = {};
+    event.componentIndex   = 0;
+    event.channel          = resolvedMidiChannel();
+    event.index            = note;
+    event.value            = velocity;
+    event.message          = velocity ? midi::messageType_t::NOTE_ON : midi::messageType_t::NOTE_OFF;
+
+    MidiDispatcher.notify(messaging::eventType_t::BUTTON, event);
+}
+
 void System::backup()
 {
     uint8_t backupRequest[] = {
@@ -844,110 +1204,901 @@ void System::backup()
     _backupRestoreState = backupRestoreState_t::NONE;
 }
 
-ioComponent_t System::checkComponents()
+bool System::handleBulkRequest(const uint8_t* sysEx, size_t length)
 {
-    switch (_componentIndex)
-    {
-    case ioComponent_t::BUTTONS:
+    if ((length <= (BULK_REQUEST_ID_OFFSET + 1)) ||
+        (sysEx[1] != SYS_EX_MID.id1) ||
+        (sysEx[2] != SYS_EX_MID.id2) ||
+        (sysEx[3] != SYS_EX_MID.id3) ||
+        (sysEx[4] != static_cast<uint8_t>(lib::sysexconf::status_t::REQUEST)) ||
+        (sysEx[5] != 0))
     {
-        _componentIndex = ioComponent_t::ENCODERS;
+        return false;
     }
-    break;
 
-    case ioComponent_t::ENCODERS:
-    {
-        _componentIndex = ioComponent_t::ANALOG;
-    }
-    break;
+    const uint8_t REQUEST_ID = sysEx[BULK_REQUEST_ID_OFFSET];
+
+    size_t headerSize = 0;
 
-    case ioComponent_t::ANALOG:
+    switch (REQUEST_ID)
     {
-        _componentIndex = ioComponent_t::LEDS;
+    case SYSEX_CR_BULK_GET:
+    case SYSEX_CR_BULK_SET:
+    {
+        headerSize = BULK_VALUES_OFFSET;
     }
     break;
 
-    case ioComponent_t::LEDS:
+    case SYSEX_CR_SECTION_CRC:
     {
-        _componentIndex = ioComponent_t::I2C;
+        headerSize = BULK_START_OFFSET;
     }
     break;
 
-    case ioComponent_t::I2C:
+    case SYSEX_CR_SAX_TABLE_UPLOAD:
     {
-        _componentIndex = ioComponent_t::TOUCHSCREEN;
+        headerSize = SAX_UPLOAD_ENTRIES_OFFSET;
     }
     break;
 
-    case ioComponent_t::TOUCHSCREEN:
     default:
-    {
-        _componentIndex = ioComponent_t::BUTTONS;
-    }
-    break;
+        return false;
     }
 
-    // For each component, allow up to MAX_UPDATES_PER_RUN updates:
-    // This is done so that no single component update takes too long, and
-    // thus making other things wait.
+    // response starts with the copy of request header
+    std::array<uint8_t, BULK_MAX_RESPONSE_SIZE> response = {};
 
-    auto component         = _components.io().at(static_cast<size_t>(_componentIndex));
-    auto maxComponentIndex = component->maxComponentUpdateIndex();
-    auto loopIterations    = maxComponentIndex >= MAX_UPDATES_PER_RUN ? MAX_UPDATES_PER_RUN : !maxComponentIndex ? 1
-                                                                                                                 : maxComponentIndex;
+    const size_t HEADER_SIZE = std::min(headerSize, length - 1);
 
-    if (component != nullptr)
+    for (size_t i = 0; i < HEADER_SIZE; i++)
     {
-        for (size_t i = 0; i < loopIterations; i++)
-        {
-            component->updateSingle(_componentUpdateIndex[static_cast<size_t>(_componentIndex)]);
-
-            if (++_componentUpdateIndex[static_cast<size_t>(_componentIndex)] >= maxComponentIndex)
-            {
-                _componentUpdateIndex[static_cast<size_t>(_componentIndex)] = 0;
-            }
-        }
+        response[i] = sysEx[i];
     }
 
-    // return the last processed io component
-    return _componentIndex;
-}
+    size_t  size   = HEADER_SIZE;
+    uint8_t status = sys::Config::Status::ERROR_CONNECTION;
 
-void System::checkProtocols()
-{
-    for (size_t i = 0; i < _components.protocol().size(); i++)
+    if (_sysExConf.isConfigurationEnabled() && _components.database().isFactoryResetInProgress())
     {
-        auto component = _components.protocol().at(i);
+        status = sys::Config::Status::ERROR_BUSY;
+    }
+    else if (_sysExConf.isConfigurationEnabled())
+    {
+        switch (REQUEST_ID)
+        {
+        case SYSEX_CR_BULK_GET:
+        {
+            status = bulkGet(sysEx, length, response.data(), size);
+        }
+        break;
 
-        if (component != nullptr)
+        case SYSEX_CR_BULK_SET:
         {
-            component->read();
+            status = bulkSet(sysEx, length);
         }
-    }
-}
+        break;
 
-void System::forceComponentRefresh()
-{
-    if (_components.database().read(database::Config::Section::system_t::SYSTEM_SETTINGS,
-                                    Config::systemSetting_t::DISABLE_FORCED_REFRESH_AFTER_PRESET_CHANGE))
-    {
-        return;
+        case SYSEX_CR_SECTION_CRC:
+        {
+            status = sectionCrc(sysEx, length, response.data(), size);
+        }
+        break;
+
+        default:
+        {
+#ifdef PROJECT_TARGET_SAX_TABLE_UPLOAD
+            status = saxTableUpload(sysEx, length);
+#else
+            status = sys::Config::Status::ERROR_NOT_SUPPORTED;
+#endif
+        }
+        break;
+        }
     }
 
-    // extra check here - it's possible that preset was changed and then backup/restore procedure started
-    // in that case this would get called
-    if (_backupRestoreState != backupRestoreState_t::NONE)
+    if (status != sys::Config::Status::ACK)
     {
-        return;
+        // no payload on error
+        size = HEADER_SIZE;
     }
 
-    messaging::Event event = {};
-    event.systemMessage    = messaging::systemMessage_t::FORCE_IO_REFRESH;
+    response[4]      = status;
+    response[size++] = 0xF7;
 
-    MidiDispatcher.notify(messaging::eventType_t::SYSTEM, event);
+    _sysExDataHandler.sendResponse(response.data(), size);
+
+    return true;
+}
+
+uint8_t System::bulkGet(const uint8_t* sysEx, size_t length, uint8_t* response, size_t& size)
+{
+    if (length != (BULK_VALUES_OFFSET + 1))
+    {
+        return sys::Config::Status::ERROR_MESSAGE_LENGTH;
+    }
+
+    const uint8_t  BLOCK   = sysEx[BULK_BLOCK_OFFSET];
+    const uint8_t  SECTION = sysEx[BULK_SECTION_OFFSET];
+    const uint16_t START   = util::Conversion::Merge14Bit(sysEx[BULK_START_OFFSET], sysEx[BULK_START_OFFSET + 1]).value();
+    const uint16_t COUNT   = util::Conversion::Merge14Bit(sysEx[BULK_COUNT_OFFSET], sysEx[BULK_COUNT_OFFSET + 1]).value();
+
+    if (!COUNT || (COUNT > BULK_MAX_VALUES))
+    {
+        return sys::Config::Status::ERROR_AMOUNT;
+    }
+
+    if ((START + COUNT) > MAX_INDEXES_PER_SECTION)
+    {
+        return sys::Config::Status::ERROR_INDEX;
+    }
+
+    for (uint16_t i = 0; i < COUNT; i++)
+    {
+        uint16_t value  = 0;
+        auto     status = internalRequest(lib::sysexconf::wish_t::GET, BLOCK, SECTION, START + i, value);
+
+        if (status != sys::Config::Status::ACK)
+        {
+            return status;
+        }
+
+        auto split = util::Conversion::Split14Bit(value);
+
+        response[size++] = split.high();
+        response[size++] = split.low();
+    }
+
+    return sys::Config::Status::ACK;
+}
+
+uint8_t System::bulkSet(const uint8_t* sysEx, size_t length)
+{
+    if (length < (BULK_VALUES_OFFSET + 1))
+    {
+        return sys::Config::Status::ERROR_MESSAGE_LENGTH;
+    }
+
+    const uint8_t  BLOCK   = sysEx[BULK_BLOCK_OFFSET];
+    const uint8_t  SECTION = sysEx[BULK_SECTION_OFFSET];
+    const uint16_t START   = util::Conversion::Merge14Bit(sysEx[BULK_START_OFFSET], sysEx[BULK_START_OFFSET + 1]).value();
+    const uint16_t COUNT   = util::Conversion::Merge14Bit(sysEx[BULK_COUNT_OFFSET], sysEx[BULK_COUNT_OFFSET + 1]).value();
+
+    if (!COUNT || (COUNT > BULK_MAX_VALUES))
+    {
+        return sys::Config::Status::ERROR_AMOUNT;
+    }
+
+    if (length != (BULK_VALUES_OFFSET + (COUNT * 2) + 1))
+    {
+        return sys::Config::Status::ERROR_MESSAGE_LENGTH;
+    }
+
+    if ((START + COUNT) > MAX_INDEXES_PER_SECTION)
+    {
+        return sys::Config::Status::ERROR_INDEX;
+    }
+
+    // Values are written directly to database, so only sections which are stored as-is
+    // can be written this way: component handlers aren't called for bulk writes.
+    if (!isBulkWritable(BLOCK, SECTION))
+    {
+        return sys::Config::Status::ERROR_NOT_SUPPORTED;
+    }
+
+    // Whole range is validated by sysexconf before anything is written.
+    // Current values are read as well so that values which are already stored aren't written,
+    // and so that the range can be restored if any of the writes fails.
+    std::array<uint16_t, BULK_MAX_VALUES> previous = {};
+
+    for (uint16_t i = 0; i < COUNT; i++)
+    {
+        auto status = internalRequest(lib::sysexconf::wish_t::GET, BLOCK, SECTION, START + i, previous[i]);
+
+        if (status != sys::Config::Status::ACK)
+        {
+            return status;
+        }
+
+        const size_t VALUE_OFFSET = BULK_VALUES_OFFSET + (i * 2);
+        uint16_t     value        = util::Conversion::Merge14Bit(sysEx[VALUE_OFFSET], sysEx[VALUE_OFFSET + 1]).value();
+
+        _internalResponse.validateOnly = true;
+        status                         = internalRequest(lib::sysexconf::wish_t::SET, BLOCK, SECTION, START + i, value);
+        _internalResponse.validateOnly = false;
+
+        if (status != sys::Config::Status::ACK)
+        {
+            return status;
+        }
+    }
+
+    InputHold hold(*this);
+
+    for (uint16_t i = 0; i < COUNT; i++)
+    {
+        const size_t VALUE_OFFSET = BULK_VALUES_OFFSET + (i * 2);
+        uint16_t     value        = util::Conversion::Merge14Bit(sysEx[VALUE_OFFSET], sysEx[VALUE_OFFSET + 1]).value();
+
+        if (value == previous[i])
+        {
+            continue;
+        }
+
+        if (!bulkWrite(BLOCK, SECTION, START + i, value))
+        {
+            for (uint16_t restore = 0; restore < i; restore++)
+            {
+                bulkWrite(BLOCK, SECTION, START + restore, previous[restore]);
+            }
+
+            return sys::Config::Status::ERROR_WRITE;
+        }
+    }
+
+    if (BLOCK == static_cast<uint8_t>(sys::Config::block_t::GLOBAL))
+    {
+        // only fingering table sections are written here
+        _lastSaxFingeringMask = 0xFFFFFFFFu;
+        _saxFingeringDirty    = true;
+    }
+
+    return sys::Config::Status::ACK;
+}
+
+/// Checks whether the section can be written by bulk requests.
+/// Only sections whose values are stored as-is, without any other action taken by the component
+/// owning them, are writable. Everything else needs to be written with single requests.
+bool System::isBulkWritable(uint8_t block, uint8_t section)
+{
+    switch (static_cast<sys::Config::block_t>(block))
+    {
+    case sys::Config::block_t::GLOBAL:
+    {
+        switch (static_cast<sys::Config::Section::global_t>(section))
+        {
+        case sys::Config::Section::global_t::SAX_FINGERING_MASK_LO14:
+        case sys::Config::Section::global_t::SAX_FINGERING_MASK_HI12_ENABLE:
+        case sys::Config::Section::global_t::SAX_FINGERING_NOTE:
+        case sys::Config::Section::global_t::SAX_FINGERING_CARE_LO14:
+        case sys::Config::Section::global_t::SAX_FINGERING_CARE_HI12:
+            return true;
+
+        default:
+            return false;
+        }
+    }
+
+    case sys::Config::block_t::BUTTONS:
+    {
+        // changing the type resets the button state
+        return (section < static_cast<uint8_t>(sys::Config::Section::button_t::AMOUNT)) &&
+               (section != static_cast<uint8_t>(sys::Config::Section::button_t::TYPE)) &&
+               (section != static_cast<uint8_t>(sys::Config::Section::button_t::MESSAGE_TYPE));
+    }
+
+    case sys::Config::block_t::ANALOG:
+    {
+        switch (static_cast<sys::Config::Section::analog_t>(section))
+        {
+        case sys::Config::Section::analog_t::ENABLE:
+        case sys::Config::Section::analog_t::INVERT:
+        case sys::Config::Section::analog_t::MIDI_ID:
+        case sys::Config::Section::analog_t::LOWER_LIMIT:
+        case sys::Config::Section::analog_t::UPPER_LIMIT:
+        case sys::Config::Section::analog_t::CHANNEL:
+        case sys::Config::Section::analog_t::LOWER_OFFSET:
+        case sys::Config::Section::analog_t::UPPER_OFFSET:
+            return true;
+
+        default:
+            return false;
+        }
+    }
+
+    default:
+        return false;
+    }
+}
+
+/// Writes single value of the section checked with isBulkWritable directly to database.
+bool System::bulkWrite(uint8_t block, uint8_t section, uint16_t index, uint16_t value)
+{
+    switch (static_cast<sys::Config::block_t>(block))
+    {
+    case sys::Config::block_t::GLOBAL:
+        return _components.database().update(util::Conversion::SYS_2_DB_SECTION(static_cast<sys::Config::Section::global_t>(section)), index, value);
+
+    case sys::Config::block_t::BUTTONS:
+        return _components.database().update(util::Conversion::SYS_2_DB_SECTION(static_cast<sys::Config::Section::button_t>(section)), index, value);
+
+    case sys::Config::block_t::ANALOG:
+        return _components.database().update(util::Conversion::SYS_2_DB_SECTION(static_cast<sys::Config::Section::analog_t>(section)), index, value);
+
+    default:
+        return false;
+    }
+}
+
+uint8_t System::sectionCrc(const uint8_t* sysEx, size_t length, uint8_t* response, size_t& size)
+{
+    if (length != (BULK_SECTION_OFFSET + 2))
+    {
+        return sys::Config::Status::ERROR_MESSAGE_LENGTH;
+    }
+
+    // CRC-16/CCITT-FALSE
+    auto update = [](uint16_t crc, uint8_t data)
+    {
+        crc ^= static_cast<uint16_t>(data) << 8;
+
+        for (size_t bit = 0; bit < 8; bit++)
+        {
+            crc = (crc & 0x8000) ? static_cast<uint16_t>((crc << 1) ^ 0x1021) : static_cast<uint16_t>(crc << 1);
+        }
+
+        return crc;
+    };
+
+    // indexes which can't be read are part of the checksum as well
+    auto readable = [](uint8_t status)
+    {
+        return (status == sys::Config::Status::ACK) ||
+               (status == sys::Config::Status::ERROR_READ) ||
+               (status == sys::Config::Status::ERROR_NOT_SUPPORTED);
+    };
+
+    const uint8_t BLOCK   = sysEx[BULK_BLOCK_OFFSET];
+    const uint8_t SECTION = sysEx[BULK_SECTION_OFFSET];
+
+    // Section size isn't known here. Block and section are validated by sysexconf with the first
+    // request, after which the size is found by bisecting on the index: sysexconf reports invalid
+    // index for everything past the end of the section.
+    uint16_t probeValue = 0;
+    auto     status     = internalRequest(lib::sysexconf::wish_t::GET, BLOCK, SECTION, 0, probeValue);
+
+    if ((status != sys::Config::Status::ERROR_INDEX) && !readable(status))
+    {
+        return status;
+    }
+
+    uint16_t count = 0;
+
+    if (status != sys::Config::Status::ERROR_INDEX)
+    {
+        uint16_t low  = 1;
+        uint16_t high = MAX_INDEXES_PER_SECTION;
+
+        while (low < high)
+        {
+            const uint16_t MID = low + ((high - low) / 2);
+
+            if (internalRequest(lib::sysexconf::wish_t::GET, BLOCK, SECTION, MID, probeValue) == sys::Config::Status::ERROR_INDEX)
+            {
+                high = MID;
+            }
+            else
+            {
+                low = MID + 1;
+            }
+        }
+
+        count = low;
+    }
+
+    // values are read in a single pass directly from the components
+    uint16_t crc = 0xFFFF;
+
+    for (uint16_t index = 0; index < count; index++)
+    {
+        uint16_t value = 0;
+        status         = _sysExDataHandler.get(BLOCK, SECTION, index, value);
+
+        if (!readable(status))
+        {
+            return status;
+        }
+
+        crc = update(crc, status);
+        crc = update(crc, value >> 8);
+        crc = update(crc, value & 0xFF);
+    }
+
+    auto split = util::Conversion::Split14Bit(count);
+
+    response[size++] = split.high();
+    response[size++] = split.low();
+    response[size++] = (crc >> 14) & 0x03;
+    response[size++] = (crc >> 7) & 0x7F;
+    response[size++] = crc & 0x7F;
+
+    return sys::Config::Status::ACK;
+}
+
+#ifdef PROJECT_TARGET_SAX_TABLE_UPLOAD
+uint8_t System::saxTableUpload(const uint8_t* sysEx, size_t length)
+{
+    static constexpr uint32_t MASK_LAST_BYTE = 0x1F;    // 26-bit mask: 7 + 7 + 7 + 5 bits
+    static constexpr uint8_t  FLAG_ENABLED   = 0x01;
+
+    if (length < (SAX_UPLOAD_ENTRIES_OFFSET + 1))
+    {
+        return sys::Config::Status::ERROR_MESSAGE_LENGTH;
+    }
+
+    const size_t  START  = sysEx[SAX_UPLOAD_START_OFFSET];
+    const size_t  COUNT  = sysEx[SAX_UPLOAD_COUNT_OFFSET];
+    const bool    LAST   = sysEx[SAX_UPLOAD_LAST_OFFSET];
+    const uint8_t FORMAT = sysEx[SAX_UPLOAD_FORMAT_OFFSET];
+    const bool    CARE   = FORMAT == SAX_UPLOAD_FORMAT_CARE;
+    const size_t  SIZE   = CARE ? SAX_UPLOAD_CARE_ENTRY_SIZE : SAX_UPLOAD_ENTRY_SIZE;
+
+    if ((FORMAT != SAX_UPLOAD_FORMAT_MASK) && (FORMAT != SAX_UPLOAD_FORMAT_CARE))
+    {
+        _saxTableUpload.active = false;
+        return sys::Config::Status::ERROR_NEW_VALUE;
+    }
+
+    if (COUNT > (CARE ? SAX_TABLE_UPLOAD_MAX_CARE_ENTRIES : SAX_TABLE_UPLOAD_MAX_ENTRIES))
+    {
+        return sys::Config::Status::ERROR_AMOUNT;
+    }
+
+    if (length != (SAX_UPLOAD_ENTRIES_OFFSET + (COUNT * SIZE) + 1))
+    {
+        return sys::Config::Status::ERROR_MESSAGE_LENGTH;
+    }
+
+    // upload always starts from the first entry and continues where the previous chunk ended
+    if (START == 0)
+    {
+        _saxTableUpload.active  = true;
+        _saxTableUpload.entries = 0;
+    }
+
+    if (!_saxTableUpload.active || (START != _saxTableUpload.entries) || ((START + COUNT) > SAX_FINGERING_ENTRIES))
+    {
+        _saxTableUpload.active = false;
+        return sys::Config::Status::ERROR_INDEX;
+    }
+
+    // validate the whole chunk before storing anything
+    for (size_t i = 0; i < COUNT; i++)
+    {
+        const uint8_t* entry = &sysEx[SAX_UPLOAD_ENTRIES_OFFSET + (i * SIZE)];
+
+        if ((entry[3] > MASK_LAST_BYTE) || (entry[5] & ~FLAG_ENABLED) || (CARE && (entry[9] > MASK_LAST_BYTE)))
+        {
+            _saxTableUpload.active = false;
+            return sys::Config::Status::ERROR_NEW_VALUE;
+        }
+    }
+
+    auto mask26 = [](const uint8_t* data)
+    {
+        return data[0] |
+               (static_cast<uint32_t>(data[1]) << 7) |
+               (static_cast<uint32_t>(data[2]) << 14) |
+               (static_cast<uint32_t>(data[3]) << 21);
+    };
+
+    for (size_t i = 0; i < COUNT; i++)
+    {
+        const uint8_t* entry = &sysEx[SAX_UPLOAD_ENTRIES_OFFSET + (i * SIZE)];
+
+        uint32_t mask = mask26(entry);
+
+        if (entry[5] & FLAG_ENABLED)
+        {
+            mask |= SaxTableUpload::ENABLED;
+        }
+
+        _saxTableUpload.masks[START + i] = mask;
+        _saxTableUpload.care[START + i]  = CARE ? mask26(&entry[6]) : SaxTableUpload::ALL_KEYS;
+        _saxTableUpload.notes[START + i] = entry[4];
+    }
+
+    _saxTableUpload.entries += COUNT;
+
+    if (!LAST)
+    {
+        return sys::Config::Status::ACK;
+    }
+
+    _saxTableUpload.active = false;
+
+    return commitSaxTableUpload();
+}
+
+uint8_t System::commitSaxTableUpload()
+{
+    // UI/firmware contract: 26 keys, split into lo14 + hi12.
+    static constexpr uint8_t  KEY_COUNT  = 26;
+    static constexpr uint8_t  LO_BITS    = 14;
+    static constexpr uint32_t LO_MASK    = (1u << LO_BITS) - 1u;
+    static constexpr uint8_t  HI_BITS    = KEY_COUNT - LO_BITS;
+    static constexpr uint32_t HI_MASK    = (1u << HI_BITS) - 1u;
+    static constexpr uint32_t ENABLE_BIT = (1u << HI_BITS);
+
+    auto& database = _components.database();
+
+    // Staged table of another preset whose commit has been interrupted can't be overwritten:
+    // it is applied once that preset gets selected.
+    if (database.read(database::Config::Section::system_t::SYSTEM_SETTINGS, Config::systemSetting_t::SAX_TABLE_COMMIT))
+    {
+        return sys::Config::Status::ERROR_BUSY;
+    }
+
+    // Uploaded table is written to the stage first, where it doesn't affect the table in use.
+    // Power loss before the commit is recorded leaves the existing table as it was.
+    bool ok = true;
+
+    auto stage = [&](size_t entry, size_t value, uint16_t data)
+    {
+        const size_t INDEX = (entry * SAX_TABLE_STAGE_VALUES) + value;
+
+        if (database.read(database::Config::Section::system_t::SAX_TABLE_STAGE, INDEX) != data)
+        {
+            ok &= database.update(database::Config::Section::system_t::SAX_TABLE_STAGE, INDEX, data);
+        }
+    };
+
+    for (size_t entry = 0; ok && (entry < SAX_FINGERING_ENTRIES); entry++)
+    {
+        if (entry >= _saxTableUpload.entries)
+        {
+            // uploaded table replaces the existing one: remaining entries are kept, but disabled
+            for (size_t value = 0; value < SAX_TABLE_STAGE_VALUES; value++)
+            {
+                uint16_t data = database.read(SAX_TABLE_SECTIONS[value], entry);
+
+                if (SAX_TABLE_SECTIONS[value] == database::Config::Section::global_t::SAX_FINGERING_MASK_HI12_ENABLE)
+                {
+                    data &= ~ENABLE_BIT;
+                }
+
+                stage(entry, value, data);
+            }
+
+            continue;
+        }
+
+        const uint32_t mask     = _saxTableUpload.masks[entry];
+        uint16_t       hiEnable = static_cast<uint16_t>((mask >> LO_BITS) & HI_MASK);
+
+        if (mask & SaxTableUpload::ENABLED)
+        {
+            hiEnable |= ENABLE_BIT;
+        }
+
+        // same order as in SAX_TABLE_SECTIONS
+        stage(entry, 0, static_cast<uint16_t>(mask & LO_MASK));
+        stage(entry, 1, hiEnable);
+        stage(entry, 2, _saxTableUpload.notes[entry]);
+        stage(entry, 3, _saxTableUpload.care[entry] & LO_MASK);
+        stage(entry, 4, (_saxTableUpload.care[entry] >> LO_BITS) & HI_MASK);
+    }
+
+    if (!ok)
+    {
+        return sys::Config::Status::ERROR_WRITE;
+    }
+
+    // Commit point: from now on, staged table is applied to the preset even if it gets interrupted
+    // (see recoverSaxTableCommit).
+    if (!database.update(database::Config::Section::system_t::SYSTEM_SETTINGS,
+                         Config::systemSetting_t::SAX_TABLE_COMMIT,
+                         database.getPreset() + 1))
+    {
+        return sys::Config::Status::ERROR_WRITE;
+    }
+
+    ok = applySaxTableStage();
+
+    if (ok)
+    {
+        ok = database.update(database::Config::Section::system_t::SYSTEM_SETTINGS,
+                             Config::systemSetting_t::SAX_TABLE_COMMIT,
+                             0);
+    }
+
+    // single recompute for the whole table
+    _lastSaxFingeringMask = 0xFFFFFFFFu;
+    _saxFingeringDirty    = true;
+
+    return ok ? sys::Config::Status::ACK : sys::Config::Status::ERROR_WRITE;
+}
+
+/// Copies staged sax fingering table to the active preset. Only the changed values are written.
+/// returns: True if the whole table has been written, false otherwise.
+bool System::applySaxTableStage()
+{
+    auto& database = _components.database();
+    bool  ok       = true;
+
+    for (size_t entry = 0; entry < SAX_FINGERING_ENTRIES; entry++)
+    {
+        for (size_t value = 0; value < SAX_TABLE_STAGE_VALUES; value++)
+        {
+            const uint32_t data = database.read(database::Config::Section::system_t::SAX_TABLE_STAGE,
+                                                (entry * SAX_TABLE_STAGE_VALUES) + value);
+
+            if (database.read(SAX_TABLE_SECTIONS[value], entry) != data)
+            {
+                ok &= database.update(SAX_TABLE_SECTIONS[value], entry, data);
+            }
+        }
+    }
+
+    return ok;
+}
+
+void System::recoverSaxTableCommit()
+{
+    const uint32_t journal = _components.database().read(database::Config::Section::system_t::SYSTEM_SETTINGS,
+                                                         Config::systemSetting_t::SAX_TABLE_COMMIT);
+
+    // table is stored per preset: check it once that preset becomes active
+    if (journal != static_cast<uint32_t>(_components.database().getPreset() + 1))
+    {
+        return;
+    }
+
+    // Table has been fully staged before the commit was interrupted, so it contains a mix of
+    // old and uploaded entries at most. Finish the commit so that the uploaded table is used.
+    if (applySaxTableStage())
+    {
+        _components.database().update(database::Config::Section::system_t::SYSTEM_SETTINGS,
+                                      Config::systemSetting_t::SAX_TABLE_COMMIT,
+                                      0);
+    }
+
+    _lastSaxFingeringMask = 0xFFFFFFFFu;
+    _saxFingeringDirty    = true;
+}
+#endif
+
+uint8_t System::internalRequest(lib::sysexconf::wish_t wish, uint8_t block, uint8_t section, uint16_t index, uint16_t& value)
+{
+    auto splitIndex = util::Conversion::Split14Bit(index);
+    auto splitValue = util::Conversion::Split14Bit(value);
+
+    uint8_t request[] = {
+        0xF0,
+        SYS_EX_MID.id1,
+        SYS_EX_MID.id2,
+        SYS_EX_MID.id3,
+        0x00,    // request
+        0x00,    // part
+        static_cast<uint8_t>(wish),
+        static_cast<uint8_t>(lib::sysexconf::amount_t::SINGLE),
+        block,
+        section,
+        splitIndex.high(),
+        splitIndex.low(),
+        splitValue.high(),
+        splitValue.low(),
+        0xF7
+    };
+
+    // Pass the request through sysexconf so that block, section, index and new value are validated
+    // against the layout the same way as for single requests. Response is captured in
+    // SysExDataHandler::sendResponse instead of being sent to host.
+    _internalResponse.active = true;
+    _internalResponse.status = sys::Config::Status::ERROR_STATUS;
+    _internalResponse.value  = value;
+
+    _sysExConf.handleMessage(request, sizeof(request));
+
+    _internalResponse.active = false;
+    value                    = _internalResponse.value;
+
+    return _internalResponse.status;
+}
+
+ioComponent_t System::checkComponents()
+{
+    // components updated on input core are skipped
+    do
+    {
+        switch (_componentIndex)
+        {
+        case ioComponent_t::BUTTONS:
+        {
+            _componentIndex = ioComponent_t::ENCODERS;
+        }
+        break;
+
+        case ioComponent_t::ENCODERS:
+        {
+            _componentIndex = ioComponent_t::ANALOG;
+        }
+        break;
+
+        case ioComponent_t::ANALOG:
+        {
+            _componentIndex = ioComponent_t::LEDS;
+        }
+        break;
+
+        case ioComponent_t::LEDS:
+        {
+            _componentIndex = ioComponent_t::I2C;
+        }
+        break;
+
+        case ioComponent_t::I2C:
+        {
+            _componentIndex = ioComponent_t::TOUCHSCREEN;
+        }
+        break;
+
+        case ioComponent_t::TOUCHSCREEN:
+        default:
+        {
+            _componentIndex = ioComponent_t::BUTTONS;
+        }
+        break;
+        }
+    } while (runsOnInputCore(_componentIndex));
+
+    // For each component, allow up to MAX_UPDATES_PER_RUN updates:
+    // This is done so that no single component update takes too long, and
+    // thus making other things wait.
+
+    auto component         = _components.io().at(static_cast<size_t>(_componentIndex));
+    auto maxComponentIndex = component->maxComponentUpdateIndex();
+    auto loopIterations    = maxComponentIndex >= MAX_UPDATES_PER_RUN ? MAX_UPDATES_PER_RUN : !maxComponentIndex ? 1
+                                                                                                                 : maxComponentIndex;
+
+    if (component != nullptr)
+    {
+        // components which track changes process all of them at once
+        if (component->updateChanged())
+        {
+            return _componentIndex;
+        }
+
+        for (size_t i = 0; i < loopIterations; i++)
+        {
+            component->updateSingle(_componentUpdateIndex[static_cast<size_t>(_componentIndex)]);
+
+            if (++_componentUpdateIndex[static_cast<size_t>(_componentIndex)] >= maxComponentIndex)
+            {
+                _componentUpdateIndex[static_cast<size_t>(_componentIndex)] = 0;
+            }
+        }
+    }
+
+    // return the last processed io component
+    return _componentIndex;
+}
+
+void System::checkProtocols()
+{
+    for (size_t i = 0; i < _components.protocol().size(); i++)
+    {
+        auto component = _components.protocol().at(i);
+
+        if (component != nullptr)
+        {
+            component->read();
+        }
+    }
+}
+
+/// Starts resending of current component values.
+/// Components aren't refreshed all at once, but rather spread over multiple run() calls
+/// at rate specified with FORCED_REFRESH_RATE setting.
+/// param [in]: differential    If set, only the values different from the ones last sent are resent.
+void System::forceComponentRefresh(bool differential)
+{
+    if (_components.database().read(database::Config::Section::system_t::SYSTEM_SETTINGS,
+                                    Config::systemSetting_t::DISABLE_FORCED_REFRESH_AFTER_PRESET_CHANGE))
+    {
+        return;
+    }
+
+    // extra check here - it's possible that preset was changed and then backup/restore procedure started
+    // in that case this would get called
+    if (_backupRestoreState != backupRestoreState_t::NONE)
+    {
+        return;
+    }
+
+    messaging::Event event = {};
+    event.systemMessage    = messaging::systemMessage_t::FORCE_IO_REFRESH;
+    event.value            = differential;
+
+    MidiDispatcher.notify(messaging::eventType_t::SYSTEM, event);
+
+    // restart if refresh is already in progress
+    _forcedRefreshComponent = ioComponent_t::BUTTONS;
+    _forcedRefreshIndex     = 0;
+    _forcedRefreshTime      = core::mcu::timing::ms();
+}
+
+void System::updateForcedRefresh()
+{
+    if (_forcedRefreshComponent == ioComponent_t::AMOUNT)
+    {
+        return;
+    }
+
+    if (_backupRestoreState != backupRestoreState_t::NONE)
+    {
+        _forcedRefreshComponent = ioComponent_t::AMOUNT;
+        return;
+    }
+
+    const uint32_t NOW     = core::mcu::timing::ms();
+    uint32_t       elapsed = NOW - _forcedRefreshTime;
+
+    if (!elapsed)
+    {
+        return;
+    }
+
+    if (elapsed > MAX_FORCED_REFRESH_ELAPSED)
+    {
+        elapsed = MAX_FORCED_REFRESH_ELAPSED;
+    }
+
+    _forcedRefreshTime = NOW;
+
+    uint16_t rate = _components.database().read(database::Config::Section::system_t::SYSTEM_SETTINGS,
+                                                Config::systemSetting_t::FORCED_REFRESH_RATE);
+
+    if (!rate)
+    {
+        rate = DEFAULT_FORCED_REFRESH_RATE;
+    }
+
+    size_t budget = elapsed * rate;
+
+    // Only buttons and analog components are refreshed since they are the only ones
+    // with an absolute state to resend. Encoders send relative steps (or accumulate
+    // their value from movement only), so a refresh would either move the target
+    // or send nothing meaningful. Touchscreen screens are tied to the active preset
+    // and are reinitialized by the touchscreen component itself on PRESET_CHANGED.
+    InputHold hold(*this);
+
+    while (budget)
+    {
+        auto component = _components.io().at(static_cast<size_t>(_forcedRefreshComponent));
+
+        if ((component == nullptr) || (_forcedRefreshIndex >= component->maxComponentUpdateIndex()))
+        {
+            _forcedRefreshComponent = (_forcedRefreshComponent == ioComponent_t::BUTTONS) ? ioComponent_t::ANALOG : ioComponent_t::AMOUNT;
+            _forcedRefreshIndex     = 0;
+
+            if (_forcedRefreshComponent == ioComponent_t::AMOUNT)
+            {
+                break;
+            }
+
+            continue;
+        }
+
+        component->updateSingle(_forcedRefreshIndex++, true);
+        budget--;
+    }
 }
 
 void System::SysExDataHandler::sendResponse(uint8_t* array, uint16_t size)
 {
+    if (_system._internalResponse.active)
+    {
+        // status is located after manufacturer ID, value is placed in last two bytes before F7
+        _system._internalResponse.status = array[4];
+
+        if (size >= 3)
+        {
+            _system._internalResponse.value = util::Conversion::Merge14Bit(array[size - 3], array[size - 2]).value();
+        }
+
+        return;
+    }
+
     messaging::Event event = {};
     event.systemMessage    = messaging::systemMessage_t::SYS_EX_RESPONSE;
     event.message          = midi::messageType_t::SYS_EX;
@@ -976,6 +2127,23 @@ uint8_t System::SysExDataHandler::customRequest(uint16_t request, CustomResponse
         customResponse.append(PROJECT_TARGET_UID & static_cast<uint32_t>(0xFF));
     };
 
+    if (_system._components.database().isFactoryResetInProgress())
+    {
+        // requests which read or write configuration must wait until the reset is done
+        switch (request)
+        {
+        case SYSEX_CR_FACTORY_RESET:
+        case SYSEX_CR_SAX_PB_CENTER_CAPTURE:
+        case SYSEX_CR_FULL_BACKUP:
+        case SYSEX_CR_RESTORE_START:
+        case SYSEX_CR_RESTORE_END:
+            return sys::Config::Status::ERROR_BUSY;
+
+        default:
+            break;
+        }
+    }
+
     switch (request)
     {
     case SYSEX_CR_FIRMWARE_VERSION:
@@ -999,7 +2167,8 @@ uint8_t System::SysExDataHandler::customRequest(uint16_t request, CustomResponse
 
     case SYSEX_CR_FACTORY_RESET:
     {
-        if (!_system._components.database().factoryReset())
+        // defaults are written in batches from System::run()
+        if (!_system._components.database().startFactoryReset())
         {
             result = static_cast<uint8_t>(lib::sysexconf::status_t::ERROR_WRITE);
         }
@@ -1080,6 +2249,16 @@ uint8_t System::SysExDataHandler::customRequest(uint16_t request, CustomResponse
     }
     break;
 
+    case SYSEX_CR_BOOT_TIMES:
+    {
+        // time in milliseconds since power on at which each startup stage was completed
+        for (size_t i = 0; i < static_cast<size_t>(bootStage_t::AMOUNT); i++)
+        {
+            customResponse.append(std::min(_system._bootTime[i], static_cast<uint32_t>(midi::MAX_VALUE_14BIT)));
+        }
+    }
+    break;
+
     case SYSEX_CR_RESTORE_END:
     {
         _system._backupRestoreState = backupRestoreState_t::NONE;
@@ -1111,6 +2290,11 @@ uint8_t System::SysExDataHandler::get(uint8_t   block,
                                       uint16_t  index,
                                       uint16_t& value)
 {
+    if (_system._components.database().isFactoryResetInProgress())
+    {
+        return sys::Config::Status::ERROR_BUSY;
+    }
+
     return ConfigHandler.get(static_cast<sys::Config::block_t>(block), section, index, value);
 }
 
@@ -1119,34 +2303,55 @@ uint8_t System::SysExDataHandler::set(uint8_t  block,
                                       uint16_t index,
                                       uint16_t value)
 {
+    if (_system._components.database().isFactoryResetInProgress())
+    {
+        return sys::Config::Status::ERROR_BUSY;
+    }
+
+    if (_system._internalResponse.active && _system._internalResponse.validateOnly)
+    {
+        // request has passed sysexconf validation - nothing else to do
+        return sys::Config::Status::ACK;
+    }
+
     return ConfigHandler.set(static_cast<sys::Config::block_t>(block), section, index, value);
 }
 
 void System::DatabaseHandlers::presetChange(uint8_t preset)
 {
+    InputHold hold(_system);
+
+    // fingering table is stored per preset
+    _system._saxFingeringDirty    = true;
+    _system._lastSaxFingeringMask = 0xFFFFFFFFu;
+
+#ifdef PROJECT_TARGET_SAX_TABLE_UPLOAD
+    _system.recoverSaxTableCommit();
+#endif
+
     if (_system._backupRestoreState == backupRestoreState_t::NONE)
     {
-        _system._scheduler.registerTask({ SCHEDULED_TASK_PRESET,
-                                          PRESET_CHANGE_NOTIFY_DELAY,
-                                          [&]()
-                                          {
-                                              messaging::Event event = {};
-                                              event.componentIndex   = 0;
-                                              event.channel          = 0;
-                                              event.index            = _system._components.database().getPreset();
-                                              event.value            = 0;
-                                              event.systemMessage    = messaging::systemMessage_t::PRESET_CHANGED;
+        TaskScheduler.registerTask(_system._presetTask,
+                                   PRESET_CHANGE_NOTIFY_DELAY,
+                                   [&]()
+                                   {
+                                       messaging::Event event = {};
+                                       event.componentIndex   = 0;
+                                       event.channel          = 0;
+                                       event.index            = _system._components.database().getPreset();
+                                       event.value            = 0;
+                                       event.systemMessage    = messaging::systemMessage_t::PRESET_CHANGED;
 
-                                              MidiDispatcher.notify(messaging::eventType_t::SYSTEM, event);
+                                       MidiDispatcher.notify(messaging::eventType_t::SYSTEM, event);
 
-                                              _system.forceComponentRefresh();
-                                          } });
+                                       _system.forceComponentRefresh(true);
+                                   });
     }
 }
 
 void System::DatabaseHandlers::initialized()
 {
-    // nothing to do here
+    _system._saxFingeringDirty = true;
 }
 
 void System::DatabaseHandlers::factoryResetStart()
@@ -1161,8 +2366,22 @@ void System::DatabaseHandlers::factoryResetStart()
     MidiDispatcher.notify(messaging::eventType_t::SYSTEM, event);
 }
 
+void System::DatabaseHandlers::factoryResetProgress(uint8_t percentage)
+{
+    messaging::Event event = {};
+    event.componentIndex   = 0;
+    event.channel          = 0;
+    event.index            = 0;
+    event.value            = percentage;
+    event.systemMessage    = messaging::systemMessage_t::FACTORY_RESET_PROGRESS;
+
+    MidiDispatcher.notify(messaging::eventType_t::SYSTEM, event);
+}
+
 void System::DatabaseHandlers::factoryResetDone()
 {
+    _system._saxFingeringDirty = true;
+
     messaging::Event event = {};
     event.componentIndex   = 0;
     event.channel          = 0;
@@ -1206,7 +2425,9 @@ std::optional<uint8_t> System::sysConfigGet(sys::Config::Section::global_t secti
 
     if ((section == sys::Config::Section::global_t::SAX_FINGERING_MASK_LO14) ||
         (section == sys::Config::Section::global_t::SAX_FINGERING_MASK_HI12_ENABLE) ||
-        (section == sys::Config::Section::global_t::SAX_FINGERING_NOTE))
+        (section == sys::Config::Section::global_t::SAX_FINGERING_NOTE) ||
+        (section == sys::Config::Section::global_t::SAX_FINGERING_CARE_LO14) ||
+        (section == sys::Config::Section::global_t::SAX_FINGERING_CARE_HI12))
     {
         if (index >= 128)
         {
@@ -1232,12 +2453,16 @@ std::optional<uint8_t> System::sysConfigGet(sys::Config::Section::global_t secti
         return std::nullopt;
     }
 
-    // Handle only custom system settings here.
     // Non-custom settings (ACTIVE_PRESET, PRESET_PRESERVE, etc) are handled by database::Admin.
     const size_t customStart = static_cast<size_t>(database::Config::systemSetting_t::CUSTOM_SYSTEM_SETTING_START);
     const size_t customEnd   = static_cast<size_t>(database::Config::systemSetting_t::CUSTOM_SYSTEM_SETTING_END);
 
-    if ((index < customStart) || (index >= customEnd))
+    if (index < customStart)
+    {
+        return _components.database().sysConfigGet(section, index, value);
+    }
+
+    if (index >= customEnd)
     {
         return std::nullopt;
     }
@@ -1249,7 +2474,7 @@ std::optional<uint8_t> System::sysConfigGet(sys::Config::Section::global_t secti
                       : sys::Config::Status::ERROR_READ;
 
     // Hide internal init flag bit from UI for sax transpose.
-    if (index == 11)
+    if (index == static_cast<size_t>(Config::systemSetting_t::SAX_TRANSPOSE))
     {
         readValue &= 0x7FFFu;
     }
@@ -1310,6 +2535,10 @@ std::optional<uint8_t> System::sysConfigSet(sys::Config::Section::global_t secti
         ok &= _components.database().update(database::Config::Section::global_t::SAX_FINGERING_MASK_LO14, index, lo14);
         ok &= _components.database().update(database::Config::Section::global_t::SAX_FINGERING_MASK_HI12_ENABLE, index, hiEnable);
 
+        // captured entry matches exactly the captured keys
+        ok &= _components.database().update(database::Config::Section::global_t::SAX_FINGERING_CARE_LO14, index, LO_MASK);
+        ok &= _components.database().update(database::Config::Section::global_t::SAX_FINGERING_CARE_HI12, index, HI_MASK);
+
         if (value < 128)
         {
             ok &= _components.database().update(database::Config::Section::global_t::SAX_FINGERING_NOTE, index, static_cast<uint8_t>(value & 0x7F));
@@ -1317,13 +2546,16 @@ std::optional<uint8_t> System::sysConfigSet(sys::Config::Section::global_t secti
 
         // Force recompute on next tick.
         _lastSaxFingeringMask = 0xFFFFFFFFu;
+        _saxFingeringDirty    = true;
 
         return ok ? sys::Config::Status::ACK : sys::Config::Status::ERROR_WRITE;
     }
 
     if ((section == sys::Config::Section::global_t::SAX_FINGERING_MASK_LO14) ||
         (section == sys::Config::Section::global_t::SAX_FINGERING_MASK_HI12_ENABLE) ||
-        (section == sys::Config::Section::global_t::SAX_FINGERING_NOTE))
+        (section == sys::Config::Section::global_t::SAX_FINGERING_NOTE) ||
+        (section == sys::Config::Section::global_t::SAX_FINGERING_CARE_LO14) ||
+        (section == sys::Config::Section::global_t::SAX_FINGERING_CARE_HI12))
     {
         if (index >= 128)
         {
@@ -1343,6 +2575,7 @@ std::optional<uint8_t> System::sysConfigSet(sys::Config::Section::global_t secti
         if (result == sys::Config::Status::ACK)
         {
             _lastSaxFingeringMask = 0xFFFFFFFFu;
+            _saxFingeringDirty    = true;
         }
 
         return result;
@@ -1356,13 +2589,29 @@ std::optional<uint8_t> System::sysConfigSet(sys::Config::Section::global_t secti
     const size_t customStart = static_cast<size_t>(database::Config::systemSetting_t::CUSTOM_SYSTEM_SETTING_START);
     const size_t customEnd   = static_cast<size_t>(database::Config::systemSetting_t::CUSTOM_SYSTEM_SETTING_END);
 
-    if ((index < customStart) || (index >= customEnd))
+    if (index < customStart)
+    {
+        return _components.database().sysConfigSet(section, index, value);
+    }
+
+    if (index >= customEnd)
     {
         return std::nullopt;
     }
 
+    // written only by the firmware
+    if (index == static_cast<size_t>(Config::systemSetting_t::SAX_TABLE_COMMIT))
+    {
+        return sys::Config::Status::ERROR_NOT_SUPPORTED;
+    }
+
+    if ((index == static_cast<size_t>(Config::systemSetting_t::FORCED_REFRESH_RATE)) && (value > MAX_FORCED_REFRESH_RATE))
+    {
+        return sys::Config::Status::ERROR_NEW_VALUE;
+    }
+
     // Preserve internal init flag bit for sax transpose and always mark as initialized.
-    if (index == 11)
+    if (index == static_cast<size_t>(Config::systemSetting_t::SAX_TRANSPOSE))
     {
         static constexpr uint16_t SAX_TRANSPOSE_INIT_FLAG  = 0x8000;
         static constexpr uint16_t SAX_TRANSPOSE_VALUE_MASK = 0x7FFF;
@@ -1376,13 +2625,14 @@ std::optional<uint8_t> System::sysConfigSet(sys::Config::Section::global_t secti
     // If sax/breath settings change, ensure reserved analog config in current preset.
     if (result == sys::Config::Status::ACK)
     {
-        if ((index == 6) || (index == 7))
+        if ((index == static_cast<size_t>(Config::systemSetting_t::SAX_BREATH_ENABLE)) ||
+            (index == static_cast<size_t>(Config::systemSetting_t::SAX_BREATH_ANALOG_INDEX)))
         {
             ensureSaxAnalogConfigured();
         }
 
         // Apply pitch bend deadzone immediately when changed from UI.
-        if (index == 12)
+        if (index == static_cast<size_t>(Config::systemSetting_t::SAX_PB_DEADZONE))
         {
             if (_analog != nullptr)
             {
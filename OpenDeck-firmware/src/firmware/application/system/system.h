@@ -21,11 +21,17 @@ limitations under the License.
 #include "deps.h"
 #include "config.h"
 #include "layout.h"
+#include "articulation.h"
+#include "fingering.h"
+#include "input_core.h"
+#include "idle.h"
 #include "application/util/cinfo/cinfo.h"
 #include "application/util/scheduler/scheduler.h"
 
 #include "lib/sysexconf/sysexconf.h"
 
+#include <array>
+
 namespace io::analog
 {
     class Analog;
@@ -46,14 +52,11 @@ namespace sys
 
         bool              init();
         io::ioComponent_t run();
+#ifdef PROJECT_TARGET_DUAL_CORE
+        void runInput();
+#endif
 
         private:
-        enum
-        {
-            SCHEDULED_TASK_PRESET,
-            SCHEDULED_TASK_FORCED_REFRESH,
-        };
-
         enum class backupRestoreState_t : uint8_t
         {
             NONE,
@@ -61,6 +64,20 @@ namespace sys
             RESTORE
         };
 
+        /// Startup stages in the order in which they are completed.
+        /// Time at which each stage was completed is reported with SYSEX_CR_BOOT_TIMES request.
+        /// Work which isn't needed to process inputs (indicator flashes, display welcome message,
+        /// touchscreen startup) runs in the background after FIRST_RUN and isn't part of any stage.
+        enum class bootStage_t : uint8_t
+        {
+            HW,
+            DATABASE,
+            IO,
+            PROTOCOLS,
+            FIRST_RUN,
+            AMOUNT
+        };
+
         class SysExDataHandler : public lib::sysexconf::DataHandler
         {
             public:
@@ -86,6 +103,7 @@ namespace sys
 
             void presetChange(uint8_t preset) override;
             void factoryResetStart() override;
+            void factoryResetProgress(uint8_t percentage) override;
             void factoryResetDone() override;
             void initialized() override;
 
@@ -93,6 +111,85 @@ namespace sys
             System& _system;
         };
 
+        /// Keeps input core between two ticks while in scope so that the state used by input
+        /// components can be changed. Has no effect in single-core builds.
+        class InputHold
+        {
+            public:
+            InputHold(System& system);
+            ~InputHold();
+
+            private:
+            [[maybe_unused]] System& _system;
+        };
+
+        /// Holds the response to the request generated internally (see internalRequest).
+        struct InternalResponse
+        {
+            bool     active       = false;
+            bool     validateOnly = false;    ///< Set requests are only validated by sysexconf, without being applied.
+            uint8_t  status       = 0;
+            uint16_t value        = 0;
+        };
+
+#ifdef PROJECT_TARGET_SAX_TABLE_UPLOAD
+        /// Sax fingering table entries received so far in the upload which is in progress.
+        /// Entries are written to database only once the last chunk is received.
+        struct SaxTableUpload
+        {
+            /// Set in stored mask when the entry is enabled.
+            static constexpr uint32_t ENABLED = 1UL << 26;
+
+            /// Care mask of entries uploaded without one.
+            static constexpr uint32_t ALL_KEYS = ENABLED - 1;
+
+            bool                                         active  = false;
+            size_t                                       entries = 0;
+            std::array<uint32_t, SAX_FINGERING_ENTRIES> masks   = {};
+            std::array<uint32_t, SAX_FINGERING_ENTRIES> care    = {};
+            std::array<uint8_t, SAX_FINGERING_ENTRIES>  notes   = {};
+        };
+#endif
+
+        /// Layout of bulk request: F0, manufacturer ID, status, part, request ID, block, section,
+        /// start index (2 bytes), value count (2 bytes), values (2 bytes each, set only), F7.
+        /// Section CRC request ends after section.
+        static constexpr size_t BULK_REQUEST_ID_OFFSET  = 6;
+        static constexpr size_t BULK_BLOCK_OFFSET       = 7;
+        static constexpr size_t BULK_SECTION_OFFSET     = 8;
+        static constexpr size_t BULK_START_OFFSET       = 9;
+        static constexpr size_t BULK_COUNT_OFFSET       = 11;
+        static constexpr size_t BULK_VALUES_OFFSET      = 13;
+        static constexpr size_t BULK_MAX_RESPONSE_SIZE  = BULK_VALUES_OFFSET + (BULK_MAX_VALUES * 2) + 1;
+        static constexpr size_t SECTION_CRC_SIZE        = 3;
+        static constexpr size_t MAX_INDEXES_PER_SECTION = 16384;
+
+        /// Layout of sax fingering table upload: F0, manufacturer ID, status, part, request ID,
+        /// first entry, entry count, last chunk flag, entry format, entries, F7. Each entry consists
+        /// of 26-bit key mask (4 bytes, LSB first), note and flags (bit 0: entry enabled). With
+        /// SAX_UPLOAD_FORMAT_CARE, it's followed by 26-bit care mask (4 bytes, LSB first). Entries
+        /// without care mask check all the keys.
+        static constexpr size_t  SAX_UPLOAD_START_OFFSET    = 7;
+        static constexpr size_t  SAX_UPLOAD_COUNT_OFFSET    = 8;
+        static constexpr size_t  SAX_UPLOAD_LAST_OFFSET     = 9;
+        static constexpr size_t  SAX_UPLOAD_FORMAT_OFFSET   = 10;
+        static constexpr size_t  SAX_UPLOAD_ENTRIES_OFFSET  = 11;
+        static constexpr size_t  SAX_UPLOAD_ENTRY_SIZE      = 6;
+        static constexpr size_t  SAX_UPLOAD_CARE_ENTRY_SIZE = 10;
+        static constexpr uint8_t SAX_UPLOAD_FORMAT_MASK     = 0;
+        static constexpr uint8_t SAX_UPLOAD_FORMAT_CARE     = 1;
+
+#ifdef PROJECT_TARGET_SAX_TABLE_UPLOAD
+        /// Database sections of sax fingering table in the order their values are staged.
+        static constexpr database::Config::Section::global_t SAX_TABLE_SECTIONS[SAX_TABLE_STAGE_VALUES] = {
+            database::Config::Section::global_t::SAX_FINGERING_MASK_LO14,
+            database::Config::Section::global_t::SAX_FINGERING_MASK_HI12_ENABLE,
+            database::Config::Section::global_t::SAX_FINGERING_NOTE,
+            database::Config::Section::global_t::SAX_FINGERING_CARE_LO14,
+            database::Config::Section::global_t::SAX_FINGERING_CARE_HI12,
+        };
+#endif
+
         static constexpr lib::sysexconf::ManufacturerId SYS_EX_MID = {
             Config::SYSEX_MANUFACTURER_ID_0,
             Config::SYSEX_MANUFACTURER_ID_1,
@@ -104,28 +201,105 @@ namespace sys
         DatabaseHandlers          _databaseHandlers;
         SysExDataHandler          _sysExDataHandler;
         lib::sysexconf::SysExConf _sysExConf;
-        util::Scheduler           _scheduler;
         util::ComponentInfo       _cInfo;
         Layout                    _layout;
         backupRestoreState_t      _backupRestoreState                                                    = backupRestoreState_t::NONE;
         io::ioComponent_t         _componentIndex                                                        = io::ioComponent_t::AMOUNT;
         size_t                    _componentUpdateIndex[static_cast<uint8_t>(io::ioComponent_t::AMOUNT)] = {};
+        io::ioComponent_t         _forcedRefreshComponent                                                = io::ioComponent_t::AMOUNT;
+        size_t                    _forcedRefreshIndex                                                    = 0;
+        uint32_t                  _forcedRefreshTime                                                     = 0;
+        util::Scheduler::handle_t _presetTask                                                            = util::Scheduler::INVALID_HANDLE;
+        util::Scheduler::handle_t _usbRefreshTask                                                        = util::Scheduler::INVALID_HANDLE;
+        InternalResponse          _internalResponse                                                      = {};
+#ifdef PROJECT_TARGET_SAX_TABLE_UPLOAD
+        SaxTableUpload            _saxTableUpload                                                        = {};
+#endif
+        uint32_t                  _bootTime[static_cast<uint8_t>(bootStage_t::AMOUNT)]                   = {};
+        bool                      _firstRunDone                                                          = false;
 
         ::io::analog::Analog* _analog = nullptr;
         ::io::buttons::Buttons* _buttons = nullptr;
         uint16_t              _lastSaxBreathValue = 0xFFFF;
 
-        uint32_t _lastSaxFingeringMask = 0xFFFFFFFFu;
-        int16_t  _lastSaxFingeringNote = -1;
+        uint32_t  _lastSaxFingeringMask = 0xFFFFFFFFu;
+        int16_t   _lastSaxFingeringNote = -1;
+#ifdef PROJECT_TARGET_SAX_FINGERING_INDEX
+        Fingering _saxFingering = {};
+#endif
+        bool _saxFingeringDirty = true;
+
+        Articulation _articulation;
+        bool         _saxBreathGated = false;
+        size_t       _saxBreathIndex = 0;
+
+#ifdef PROJECT_TARGET_DUAL_CORE
+        InputCore _inputCore;
+#endif
+
+#ifdef PROJECT_TARGET_LOW_POWER
+        Idle _idle;
+#endif
+
+#ifdef PROJECT_TARGET_SAX_RAM_BUDGET
+        /// RAM taken by optional sax features enabled in target config.
+        static constexpr size_t SAX_RAM_USAGE = 0
+#ifdef PROJECT_TARGET_SAX_FINGERING_INDEX
+                                                + sizeof(Fingering)
+#endif
+#ifdef PROJECT_TARGET_SAX_TABLE_UPLOAD
+                                                + sizeof(SaxTableUpload)
+#endif
+            ;
+
+        static_assert(SAX_RAM_USAGE <= PROJECT_TARGET_SAX_RAM_BUDGET, "Sax features don't fit into RAM budget of the target (sax.ramBudget)");
+#endif
+
+        /// Returns true if the component is updated on input core instead of in run().
+        static constexpr bool runsOnInputCore(io::ioComponent_t component)
+        {
+#ifdef PROJECT_TARGET_DUAL_CORE
+            return (component == io::ioComponent_t::BUTTONS) ||
+                   (component == io::ioComponent_t::ENCODERS) ||
+                   (component == io::ioComponent_t::ANALOG);
+#else
+            return false;
+#endif
+        }
 
         io::ioComponent_t      checkComponents();
         void                   checkProtocols();
         void                   updateSax();
         void                   updateSaxFingering();
+        bool                   readSaxFingering(size_t entry, Fingering::Entry& fingering);
+#ifdef PROJECT_TARGET_SAX_FINGERING_INDEX
+        void                   loadSaxFingering();
+#else
+        int16_t                resolveSaxFingering(uint32_t mask);
+#endif
+        void                   setSaxBreathGated(bool state);
+        void                   sendSaxNote(uint8_t note, uint8_t velocity);
         void                   ensureSaxAnalogConfigured();
         uint8_t                resolvedMidiChannel() const;
         void                   backup();
-        void                   forceComponentRefresh();
+        void                   forceComponentRefresh(bool differential);
+        void                   updateForcedRefresh();
+        void                   sendLog();
+        void                   updateIdle();
+        void                   bootStageDone(bootStage_t stage);
+        bool                   handleBulkRequest(const uint8_t* sysEx, size_t length);
+        uint8_t                bulkGet(const uint8_t* sysEx, size_t length, uint8_t* response, size_t& size);
+        uint8_t                bulkSet(const uint8_t* sysEx, size_t length);
+        bool                   isBulkWritable(uint8_t block, uint8_t section);
+        bool                   bulkWrite(uint8_t block, uint8_t section, uint16_t index, uint16_t value);
+        uint8_t                sectionCrc(const uint8_t* sysEx, size_t length, uint8_t* response, size_t& size);
+#ifdef PROJECT_TARGET_SAX_TABLE_UPLOAD
+        uint8_t                saxTableUpload(const uint8_t* sysEx, size_t length);
+        uint8_t                commitSaxTableUpload();
+        bool                   applySaxTableStage();
+        void                   recoverSaxTableCommit();
+#endif
+        uint8_t                internalRequest(lib::sysexconf::wish_t wish, uint8_t block, uint8_t section, uint16_t index, uint16_t& value);
         std::optional<uint8_t> sysConfigGet(sys::Config::Section::global_t section, size_t index, uint16_t& value);
         std::optional<uint8_t> sysConfigSet(sys::Config::Section::global_t section, size_t index, uint16_t value);
     };
@@ -20,56 +20,94 @@ limitations under the License.
 
 using namespace util;
 
-void Configurable::registerConfig(sys::Config::block_t block, getHandler_t&& getHandler, setHandler_t&& setHandler)
+bool Configurable::registerConfig(sys::Config::block_t block, getHandler_t getHandler, setHandler_t setHandler)
 {
-    _getters.push_back({ block, std::move(getHandler) });
-    _setters.push_back({ block, std::move(setHandler) });
+    auto handler = addHandler(getHandler, setHandler);
+
+    if (handler == NO_HANDLER)
+    {
+        return false;
+    }
+
+    for (size_t section = 0; section < MAX_SECTIONS; section++)
+    {
+        route(block, section, handler);
+    }
+
+    return true;
 }
 
 uint8_t Configurable::get(sys::Config::block_t block, uint8_t section, size_t index, uint16_t& value)
 {
-    for (size_t i = 0; i < _getters.size(); i++)
+    auto instance = handler(block, section);
+
+    if (instance == nullptr)
     {
-        if (_getters.at(i).handler != nullptr)
-        {
-            if (_getters.at(i).block == block)
-            {
-                auto result = _getters.at(i).handler(section, index, value);
-
-                if (result != std::nullopt)
-                {
-                    return *result;
-                }
-            }
-        }
+        return sys::Config::Status::ERROR_NOT_SUPPORTED;
     }
 
-    return sys::Config::Status::ERROR_NOT_SUPPORTED;
+    return instance->get(section, index, value).value_or(sys::Config::Status::ERROR_NOT_SUPPORTED);
 }
 
 uint8_t Configurable::set(sys::Config::block_t block, uint8_t section, size_t index, uint16_t value)
 {
-    for (size_t i = 0; i < _setters.size(); i++)
+    auto instance = handler(block, section);
+
+    if (instance == nullptr)
     {
-        if (_setters.at(i).handler != nullptr)
-        {
-            if (_setters.at(i).block == block)
-            {
-                auto result = _setters.at(i).handler(section, index, value);
-
-                if (result != std::nullopt)
-                {
-                    return *result;
-                }
-            }
-        }
+        return sys::Config::Status::ERROR_NOT_SUPPORTED;
     }
 
-    return sys::Config::Status::ERROR_NOT_SUPPORTED;
+    return instance->set(section, index, value).value_or(sys::Config::Status::ERROR_NOT_SUPPORTED);
 }
 
 void Configurable::clear()
 {
-    _getters.clear();
-    _setters.clear();
-}
\ No newline at end of file
+    for (auto& block : _routes)
+    {
+        block.fill(NO_HANDLER);
+    }
+
+    _handlers.fill({});
+    _totalHandlers = 0;
+}
+
+uint8_t Configurable::addHandler(getHandler_t& getHandler, setHandler_t& setHandler)
+{
+    if (_totalHandlers >= MAX_HANDLERS)
+    {
+        return NO_HANDLER;
+    }
+
+    _handlers[_totalHandlers] = { getHandler, setHandler };
+
+    return _totalHandlers++;
+}
+
+void Configurable::route(sys::Config::block_t block, size_t section, uint8_t handler)
+{
+    if ((block >= sys::Config::block_t::AMOUNT) || (section >= MAX_SECTIONS))
+    {
+        return;
+    }
+
+    // section is owned by the component which registered it last
+    _routes[static_cast<size_t>(block)][section] = handler;
+}
+
+Configurable::Handler* Configurable::handler(sys::Config::block_t block, uint8_t section)
+{
+    if ((block >= sys::Config::block_t::AMOUNT) || (section >= MAX_SECTIONS))
+    {
+        return nullptr;
+    }
+
+    auto index = _routes[static_cast<size_t>(block)][section];
+
+    if (index == NO_HANDLER)
+    {
+        return nullptr;
+    }
+
+    return &_handlers[index];
+}
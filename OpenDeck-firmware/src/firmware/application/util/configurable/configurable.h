@@ -19,17 +19,23 @@ limitations under the License.
 #pragma once
 
 #include "application/system/config.h"
+#include "application/util/function/function.h"
 
-#include <functional>
+#include <algorithm>
+#include <array>
+#include <initializer_list>
 #include <optional>
 
 namespace util
 {
+    /// Routes configuration requests to the component responsible for them.
+    /// Each (block, section) pair is handled by a single component, resolved
+    /// with a table lookup when the request arrives.
     class Configurable
     {
         public:
-        using getHandler_t = std::function<std::optional<uint8_t>(uint8_t section, size_t index, uint16_t& value)>;
-        using setHandler_t = std::function<std::optional<uint8_t>(uint8_t section, size_t index, uint16_t value)>;
+        using getHandler_t = Function<std::optional<uint8_t>(uint8_t section, size_t index, uint16_t& value)>;
+        using setHandler_t = Function<std::optional<uint8_t>(uint8_t section, size_t index, uint16_t value)>;
 
         static Configurable& instance()
         {
@@ -37,29 +43,75 @@ namespace util
             return instance;
         }
 
-        void    registerConfig(sys::Config::block_t block, getHandler_t&& getHandler, setHandler_t&& setHandler);
+        /// Registers handlers for all sections of the specified block.
+        /// returns: True if the handlers have been registered, false if there is no space left for them.
+        bool registerConfig(sys::Config::block_t block, getHandler_t getHandler, setHandler_t setHandler);
+
+        /// Registers handlers for specified sections of the block only.
+        /// Used for blocks whose sections are handled by different components.
+        /// returns: True if the handlers have been registered, false if there is no space left for them.
+        template<typename T>
+        bool registerConfig(sys::Config::block_t block, std::initializer_list<T> sections, getHandler_t getHandler, setHandler_t setHandler)
+        {
+            auto handler = addHandler(getHandler, setHandler);
+
+            if (handler == NO_HANDLER)
+            {
+                return false;
+            }
+
+            for (auto section : sections)
+            {
+                route(block, static_cast<size_t>(section), handler);
+            }
+
+            return true;
+        }
+
         uint8_t get(sys::Config::block_t block, uint8_t section, size_t index, uint16_t& value);
         uint8_t set(sys::Config::block_t block, uint8_t section, size_t index, uint16_t value);
         void    clear();
 
         private:
-        Configurable() = default;
-
-        struct GetHandlerInternal
+        Configurable()
         {
-            sys::Config::block_t block   = sys::Config::block_t::GLOBAL;
-            getHandler_t         handler = nullptr;
-        };
+            clear();
+        }
 
-        struct SetHandlerInternal
+        struct Handler
         {
-            sys::Config::block_t block   = sys::Config::block_t::GLOBAL;
-            setHandler_t         handler = nullptr;
+            getHandler_t get = nullptr;
+            setHandler_t set = nullptr;
         };
 
-        std::vector<GetHandlerInternal> _getters = {};
-        std::vector<SetHandlerInternal> _setters = {};
+        static constexpr uint8_t NO_HANDLER   = 0xFF;
+        static constexpr size_t  MAX_SECTIONS = std::max({
+            static_cast<size_t>(sys::Config::Section::global_t::AMOUNT),
+            static_cast<size_t>(sys::Config::Section::button_t::AMOUNT),
+            static_cast<size_t>(sys::Config::Section::encoder_t::AMOUNT),
+            static_cast<size_t>(sys::Config::Section::analog_t::AMOUNT),
+            static_cast<size_t>(sys::Config::Section::leds_t::AMOUNT),
+            static_cast<size_t>(sys::Config::Section::i2c_t::AMOUNT),
+            static_cast<size_t>(sys::Config::Section::touchscreen_t::AMOUNT),
+        });
+
+        /// Global block is the only one shared between components: each of its sections
+        /// can have its own handler, while all other blocks have a single one.
+        static constexpr size_t MAX_HANDLERS = static_cast<size_t>(sys::Config::block_t::AMOUNT) - 1 +
+                                               static_cast<size_t>(sys::Config::Section::global_t::AMOUNT);
+
+        static_assert(MAX_HANDLERS < NO_HANDLER, "Handler index doesn't fit in route");
+
+        using routes_t = std::array<std::array<uint8_t, MAX_SECTIONS>, static_cast<size_t>(sys::Config::block_t::AMOUNT)>;
+
+        std::array<Handler, MAX_HANDLERS> _handlers      = {};
+        routes_t                          _routes        = {};
+        size_t                            _totalHandlers = 0;
+
+        uint8_t  addHandler(getHandler_t& getHandler, setHandler_t& setHandler);
+        void     route(sys::Config::block_t block, size_t section, uint8_t handler);
+        Handler* handler(sys::Config::block_t block, uint8_t section);
     };
 }    // namespace util
 
-#define ConfigHandler util::Configurable::instance()
\ No newline at end of file
+#define ConfigHandler util::Configurable::instance()
@@ -18,16 +18,26 @@ limitations under the License.
 
 #pragma once
 
+#include "application/util/function/function.h"
+
 #include <vector>
 #include <functional>
 
 namespace util
 {
-    template<typename Source, typename Event>
+    /// Delivers events to all listeners of the event source.
+    /// Each listener runs in a single context (eg. CPU core). By default all listeners are
+    /// called directly from notify(). Once routing is set, only the listeners from the context
+    /// in which notify() is called are called directly, and the event is forwarded once to
+    /// each of the other contexts with listeners for the source. Forwarded events are passed
+    /// to the listeners with deliver() from the context to which they were forwarded.
+    template<typename Source, typename Event, typename Context = uint8_t>
     class Dispatcher
     {
         public:
         using messageCallback_t = std::function<void(const Event& event)>;
+        using contextHandler_t  = Function<Context()>;
+        using forwardHandler_t  = Function<void(Context context, Source source, const Event& event)>;
 
         static Dispatcher& instance()
         {
@@ -35,28 +45,78 @@ namespace util
             return instance;
         }
 
-        void listen(Source source, messageCallback_t&& callback)
+        void listen(Source source, messageCallback_t&& callback, Context context = Context{})
         {
-            _listener.push_back({ source, std::move(callback) });
+            _listener.push_back({ source, context, std::move(callback) });
+        }
+
+        /// Enables delivery of events across contexts.
+        /// param [in]: contextHandler  Returns the context from which dispatcher is called.
+        /// param [in]: forwardHandler  Passes event to the specified context.
+        void route(contextHandler_t contextHandler, forwardHandler_t forwardHandler)
+        {
+            _contextHandler = contextHandler;
+            _forwardHandler = forwardHandler;
         }
 
         void notify(Source source, Event const& event)
         {
-            for (size_t i = 0; i < _listener.size(); i++)
+            if (!_contextHandler)
             {
-                if (_listener[i].source == source)
+                for (size_t i = 0; i < _listener.size(); i++)
                 {
-                    if (_listener[i].callback != nullptr)
+                    if (_listener[i].source == source)
                     {
-                        _listener[i].callback(event);
+                        call(i, event);
                     }
                 }
+
+                return;
+            }
+
+            const Context CURRENT   = _contextHandler();
+            uint32_t      forwarded = 0;
+
+            for (size_t i = 0; i < _listener.size(); i++)
+            {
+                if (_listener[i].source != source)
+                {
+                    continue;
+                }
+
+                if (_listener[i].context == CURRENT)
+                {
+                    call(i, event);
+                    continue;
+                }
+
+                const uint32_t CONTEXT_BIT = 1UL << static_cast<uint8_t>(_listener[i].context);
+
+                if (!(forwarded & CONTEXT_BIT))
+                {
+                    forwarded |= CONTEXT_BIT;
+                    _forwardHandler(_listener[i].context, source, event);
+                }
+            }
+        }
+
+        /// Calls the listeners from specified context only. Used to pass forwarded events.
+        void deliver(Context context, Source source, Event const& event)
+        {
+            for (size_t i = 0; i < _listener.size(); i++)
+            {
+                if ((_listener[i].source == source) && (_listener[i].context == context))
+                {
+                    call(i, event);
+                }
             }
         }
 
         void clear()
         {
             _listener.clear();
+            _contextHandler = nullptr;
+            _forwardHandler = nullptr;
         }
 
         private:
@@ -65,9 +125,20 @@ namespace util
         struct Listener
         {
             Source            source;
+            Context           context  = Context{};
             messageCallback_t callback = nullptr;
         };
 
-        std::vector<Listener> _listener = {};
+        std::vector<Listener> _listener       = {};
+        contextHandler_t      _contextHandler = nullptr;
+        forwardHandler_t      _forwardHandler = nullptr;
+
+        void call(size_t index, Event const& event)
+        {
+            if (_listener[index].callback != nullptr)
+            {
+                _listener[index].callback(event);
+            }
+        }
     };
-}    // namespace util
\ No newline at end of file
+}    // namespace util
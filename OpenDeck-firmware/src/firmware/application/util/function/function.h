@@ -0,0 +1,77 @@
+/*
+
+Copyright Igor Petrovic
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*/
+
+#pragma once
+
+#include <inttypes.h>
+#include <stddef.h>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace util
+{
+    template<typename Signature, size_t CAPACITY = sizeof(void*) * 2>
+    class Function;
+
+    /// Callable wrapper which, unlike std::function, never allocates memory.
+    /// Callable is stored inside the wrapper itself, so it must fit in CAPACITY bytes
+    /// and be trivially copyable - lambdas capturing few pointers (eg. this) are fine.
+    template<typename R, typename... Args, size_t CAPACITY>
+    class Function<R(Args...), CAPACITY>
+    {
+        public:
+        Function() = default;
+
+        Function(std::nullptr_t)
+        {}
+
+        template<typename F, typename = std::enable_if_t<!std::is_same_v<std::decay_t<F>, Function>>>
+        Function(F&& callable)
+        {
+            using callable_t = std::decay_t<F>;
+
+            static_assert(sizeof(callable_t) <= CAPACITY, "Callable doesn't fit in Function storage");
+            static_assert(alignof(callable_t) <= alignof(void*), "Unsupported callable alignment");
+            static_assert(std::is_trivially_copyable_v<callable_t>, "Callable must be trivially copyable");
+
+            new (_storage) callable_t(std::forward<F>(callable));
+
+            _invoke = [](const void* storage, Args... args) -> R
+            {
+                return (*static_cast<const callable_t*>(storage))(std::forward<Args>(args)...);
+            };
+        }
+
+        R operator()(Args... args) const
+        {
+            return _invoke(_storage, std::forward<Args>(args)...);
+        }
+
+        explicit operator bool() const
+        {
+            return _invoke != nullptr;
+        }
+
+        private:
+        using invoke_t = R (*)(const void* storage, Args... args);
+
+        alignas(void*) uint8_t _storage[CAPACITY] = {};
+        invoke_t _invoke                          = nullptr;
+    };
+}    // namespace util
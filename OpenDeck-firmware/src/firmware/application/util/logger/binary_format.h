@@ -0,0 +1,134 @@
+/*
+
+Copyright Igor Petrovic
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*/
+
+#pragma once
+
+#include <inttypes.h>
+#include <stddef.h>
+
+/// Binary log record format shared between firmware and host-side decoder.
+///
+/// Each record is laid out as:
+/// [size][level][id0][id1][id2][id3][argument 0]...[argument N]
+///
+/// Size covers the entire record, including the header. ID is a hash of the format string,
+/// stored in little endian. Each argument starts with a single byte describing its type,
+/// followed by its raw value in little endian. Strings are stored with length byte and
+/// without terminating zero.
+namespace util::binary_log
+{
+    enum class level_t : uint8_t
+    {
+        INF,
+        WRN,
+        ERR,
+        AMOUNT
+    };
+
+    enum class argType_t : uint8_t
+    {
+        INT32,
+        UINT32,
+        INT64,
+        UINT64,
+        FLOAT,
+        STRING,
+        AMOUNT
+    };
+
+    constexpr inline size_t HEADER_SIZE     = 6;
+    constexpr inline size_t MAX_RECORD_SIZE = 64;
+    constexpr inline size_t MAX_STRING_SIZE = 16;
+
+    /// Record with this ID is emitted by the logger itself once records have been dropped.
+    /// It holds a single UINT32 argument with the amount of dropped records.
+    constexpr inline uint32_t DROPPED_ID = 0;
+
+    /// Calculates format string ID using 32-bit FNV-1a hash.
+    constexpr uint32_t hash(const char* string)
+    {
+        uint32_t value = 2166136261UL;
+
+        while (*string)
+        {
+            value ^= static_cast<uint8_t>(*string++);
+            value *= 16777619UL;
+        }
+
+        // reserved
+        if (value == DROPPED_ID)
+        {
+            value = 1;
+        }
+
+        return value;
+    }
+
+    /// Returns the amount of bytes needed to store data of specified size using 7-bit encoding.
+    constexpr size_t packedSize(size_t size)
+    {
+        return size + ((size + 6) / 7);
+    }
+
+    /// Encodes 8-bit data into 7-bit data so that it can be sent using SysEx.
+    /// Each group of up to 7 bytes is prefixed with a byte holding their most significant bits.
+    /// param [in]: input   Data to encode.
+    /// param [in]: size    Amount of bytes to encode.
+    /// param [in]: output  Array in which encoded data is stored. Must be at least packedSize(size) bytes long.
+    /// returns: Amount of bytes written to output.
+    inline size_t pack7Bit(const uint8_t* input, size_t size, uint8_t* output)
+    {
+        size_t written = 0;
+
+        for (size_t i = 0; i < size; i += 7)
+        {
+            uint8_t& msb = output[written++];
+            msb          = 0;
+
+            for (size_t j = 0; (j < 7) && ((i + j) < size); j++)
+            {
+                msb |= static_cast<uint8_t>((input[i + j] >> 7) << j);
+                output[written++] = input[i + j] & 0x7F;
+            }
+        }
+
+        return written;
+    }
+
+    /// Decodes data encoded with pack7Bit.
+    /// param [in]: input   Data to decode.
+    /// param [in]: size    Amount of bytes to decode.
+    /// param [in]: output  Array in which decoded data is stored.
+    /// returns: Amount of bytes written to output.
+    inline size_t unpack7Bit(const uint8_t* input, size_t size, uint8_t* output)
+    {
+        size_t written = 0;
+
+        for (size_t i = 0; i < size; i += 8)
+        {
+            const uint8_t MSB = input[i];
+
+            for (size_t j = 0; (j < 7) && ((i + j + 1) < size); j++)
+            {
+                output[written++] = input[i + j + 1] | (((MSB >> j) & 0x01) << 7);
+            }
+        }
+
+        return written;
+    }
+}    // namespace util::binary_log
@@ -0,0 +1,225 @@
+/*
+
+Copyright Igor Petrovic
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*/
+
+#pragma once
+
+#include "binary_format.h"
+
+#include "core/mcu.h"
+
+#include <array>
+#include <string.h>
+#include <type_traits>
+
+namespace util
+{
+    /// Logger which stores compact binary records instead of formatted strings.
+    /// Formatting is done on host using logdecode tool, which resolves format strings
+    /// from their IDs by scanning the firmware sources.
+    /// Records can be written from both main loop and interrupts and are read from main
+    /// loop in complete records. If there is no space for new record, it's dropped and
+    /// the amount of dropped records is reported with the next read.
+    template<size_t SIZE>
+    class BinaryLogger
+    {
+        public:
+        BinaryLogger() = default;
+
+        static_assert(SIZE >= binary_log::MAX_RECORD_SIZE, "Binary logger must fit at least one record");
+
+        template<typename... Args>
+        void write(binary_log::level_t level, uint32_t id, Args... args)
+        {
+            std::array<uint8_t, binary_log::MAX_RECORD_SIZE> record;
+            size_t                                            size = binary_log::HEADER_SIZE;
+
+            (append(record.data(), size, args), ...);
+
+            header(record.data(), size, level, id);
+            push(record.data(), size);
+        }
+
+        /// Copies complete records to provided buffer.
+        /// param [in]: buffer  Buffer in which records are stored.
+        /// param [in]: maxSize Size of the buffer.
+        /// returns: Amount of bytes copied to buffer.
+        size_t read(uint8_t* buffer, size_t maxSize)
+        {
+            size_t written = 0;
+
+            CORE_MCU_ATOMIC_SECTION
+            {
+                if (_dropped && (maxSize >= DROPPED_RECORD_SIZE))
+                {
+                    size_t size = binary_log::HEADER_SIZE;
+
+                    append(buffer, size, _dropped);
+                    header(buffer, size, binary_log::level_t::WRN, binary_log::DROPPED_ID);
+
+                    written  = size;
+                    _dropped = 0;
+                }
+
+                while (_used)
+                {
+                    const size_t RECORD_SIZE = _buffer[_tail];
+
+                    if ((written + RECORD_SIZE) > maxSize)
+                    {
+                        break;
+                    }
+
+                    for (size_t i = 0; i < RECORD_SIZE; i++)
+                    {
+                        buffer[written++] = _buffer[_tail];
+                        _tail             = (_tail + 1) % SIZE;
+                    }
+
+                    _used -= RECORD_SIZE;
+                }
+            }
+
+            return written;
+        }
+
+        private:
+        static constexpr size_t DROPPED_RECORD_SIZE = binary_log::HEADER_SIZE + 1 + sizeof(uint32_t);
+
+        std::array<uint8_t, SIZE> _buffer  = {};
+        size_t                    _head    = 0;
+        size_t                    _tail    = 0;
+        size_t                    _used    = 0;
+        uint32_t                  _dropped = 0;
+
+        static void header(uint8_t* record, size_t size, binary_log::level_t level, uint32_t id)
+        {
+            record[0] = size;
+            record[1] = static_cast<uint8_t>(level);
+            record[2] = id & 0xFF;
+            record[3] = (id >> 8) & 0xFF;
+            record[4] = (id >> 16) & 0xFF;
+            record[5] = (id >> 24) & 0xFF;
+        }
+
+        template<typename T>
+        static void appendValue(uint8_t* record, size_t& size, binary_log::argType_t type, T value)
+        {
+            record[size++] = static_cast<uint8_t>(type);
+
+            for (size_t i = 0; i < sizeof(T); i++)
+            {
+                record[size++] = (static_cast<uint64_t>(value) >> (i * 8)) & 0xFF;
+            }
+        }
+
+        template<typename T>
+        static void append(uint8_t* record, size_t& size, T value)
+        {
+            using namespace binary_log;
+
+            using type_t = std::decay_t<T>;
+
+            // arguments which don't fit are skipped: decoder prints them as missing
+            if constexpr (std::is_same_v<type_t, const char*> || std::is_same_v<type_t, char*>)
+            {
+                const size_t LENGTH = value ? strnlen(value, MAX_STRING_SIZE) : 0;
+
+                if ((size + 2 + LENGTH) > MAX_RECORD_SIZE)
+                {
+                    return;
+                }
+
+                record[size++] = static_cast<uint8_t>(argType_t::STRING);
+                record[size++] = LENGTH;
+                memcpy(&record[size], value, LENGTH);
+                size += LENGTH;
+            }
+            else if constexpr (std::is_floating_point_v<type_t>)
+            {
+                if ((size + 1 + sizeof(float)) > MAX_RECORD_SIZE)
+                {
+                    return;
+                }
+
+                uint32_t raw        = 0;
+                float    floatValue = static_cast<float>(value);
+                memcpy(&raw, &floatValue, sizeof(raw));
+
+                appendValue(record, size, argType_t::FLOAT, raw);
+            }
+            else if constexpr (std::is_enum_v<type_t>)
+            {
+                append(record, size, static_cast<std::underlying_type_t<type_t>>(value));
+            }
+            else if constexpr (std::is_pointer_v<type_t>)
+            {
+                append(record, size, static_cast<uint32_t>(reinterpret_cast<uintptr_t>(value)));
+            }
+            else
+            {
+                static_assert(std::is_integral_v<type_t>, "Unsupported log argument type");
+
+                constexpr bool WIDE = sizeof(type_t) > sizeof(uint32_t);
+
+                if ((size + 1 + (WIDE ? sizeof(uint64_t) : sizeof(uint32_t))) > MAX_RECORD_SIZE)
+                {
+                    return;
+                }
+
+                if constexpr (WIDE)
+                {
+                    appendValue(record, size, std::is_signed_v<type_t> ? argType_t::INT64 : argType_t::UINT64, static_cast<uint64_t>(value));
+                }
+                else
+                {
+                    appendValue(record, size, std::is_signed_v<type_t> ? argType_t::INT32 : argType_t::UINT32, static_cast<uint32_t>(value));
+                }
+            }
+        }
+
+        void push(const uint8_t* record, size_t size)
+        {
+            CORE_MCU_ATOMIC_SECTION
+            {
+                if ((SIZE - _used) < size)
+                {
+                    _dropped++;
+                }
+                else
+                {
+                    for (size_t i = 0; i < size; i++)
+                    {
+                        _buffer[_head] = record[i];
+                        _head          = (_head + 1) % SIZE;
+                    }
+
+                    _used += size;
+                }
+            }
+        }
+    };
+}    // namespace util
+
+/// Records a log message.
+/// Format string must be a string literal so that its ID is calculated during compilation.
+#define UTIL_BINARY_LOG(logger, level, format, ...)                                         \
+    do                                                                                      \
+    {                                                                                       \
+        constexpr uint32_t UTIL_BINARY_LOG_ID = util::binary_log::hash(format);             \
+        logger.write(util::binary_log::level_t::level, UTIL_BINARY_LOG_ID, ##__VA_ARGS__); \
+    } while (0)
@@ -18,10 +18,11 @@ limitations under the License.
 
 #pragma once
 
-#include "core/util/logger.h"
-
 #ifdef OPENDECK_USE_LOGGER
 #ifdef OPENDECK_FW_APP
+#ifdef OPENDECK_TEST
+#include "core/util/logger.h"
+
 constexpr inline size_t APP_LOGGER_SIZE = 128;
 CORE_LOGGER_DECLARE(APP_LOGGER, APP_LOGGER_SIZE);
 
@@ -29,6 +30,19 @@ CORE_LOGGER_DECLARE(APP_LOGGER, APP_LOGGER_SIZE);
 #define LOG_WRN(...) CORE_LOG_WRN(APP_LOGGER, __VA_ARGS__)
 #define LOG_ERR(...) CORE_LOG_ERR(APP_LOGGER, __VA_ARGS__)
 #else
+// On device, only binary records are stored: formatting is done on host.
+#include "binary_logger.h"
+
+#define OPENDECK_BINARY_LOGGER
+
+constexpr inline size_t APP_LOGGER_SIZE = 512;
+extern util::BinaryLogger<APP_LOGGER_SIZE> APP_LOGGER;
+
+#define LOG_INF(format, ...) UTIL_BINARY_LOG(APP_LOGGER, INF, format, ##__VA_ARGS__)
+#define LOG_WRN(format, ...) UTIL_BINARY_LOG(APP_LOGGER, WRN, format, ##__VA_ARGS__)
+#define LOG_ERR(format, ...) UTIL_BINARY_LOG(APP_LOGGER, ERR, format, ##__VA_ARGS__)
+#endif
+#else
 #define LOG_INF(...)
 #define LOG_WRN(...)
 #define LOG_ERR(...)
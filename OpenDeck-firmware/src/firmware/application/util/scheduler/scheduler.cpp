@@ -22,58 +22,282 @@ limitations under the License.
 
 using namespace util;
 
-Scheduler::Scheduler()
+void Scheduler::update()
+{
+    const uint32_t now = core::mcu::timing::ms();
+
+    if (static_cast<int32_t>(now - _now) <= 0)
+    {
+        return;
+    }
+
+    uint32_t time = 0;
+
+    // jump straight from one occupied slot to another - empty ones are never visited
+    while (nextExpiry(time) && (static_cast<int32_t>(now - time) >= 0))
+    {
+        _now = time;
+        expire(now);
+    }
+
+    _now = now;
+}
+
+bool Scheduler::registerTask(handle_t& handle, uint32_t timeout, task_t task)
 {
-    init();
+    return add(handle, timeout, 0, task);
 }
 
-bool Scheduler::init()
+bool Scheduler::registerPeriodicTask(handle_t& handle, uint32_t period, task_t task)
 {
-    for (size_t i = 0; i < MAX_TASKS; i++)
+    if (!period)
     {
-        _tasks[i].function = nullptr;
-        _tasks[i].timeout  = 0;
+        cancel(handle);
+        return false;
     }
 
-    return true;
+    return add(handle, period, period, task);
 }
 
-void Scheduler::update()
+void Scheduler::cancel(handle_t& handle)
 {
-    for (size_t i = 0; i < MAX_TASKS; i++)
+    if (isRegistered(handle))
     {
-        if (_tasks[i].function != nullptr)
-        {
-            if (core::mcu::timing::ms() >= _tasks[i].timeout)
-            {
-                _tasks[i].function();
-                _tasks[i].function = nullptr;
-            }
-        }
+        const auto INDEX = static_cast<uint8_t>(handle & 0xFF);
+
+        unlink(INDEX);
+        release(INDEX);
     }
+
+    handle = INVALID_HANDLE;
 }
 
-bool Scheduler::registerTask(Task&& task)
+bool Scheduler::isRegistered(handle_t handle) const
 {
-    size_t index = MAX_TASKS;
+    const size_t INDEX = handle & 0xFF;
 
+    if ((handle == INVALID_HANDLE) || (INDEX >= MAX_TASKS))
+    {
+        return false;
+    }
+
+    // released task has no slot, and once reused, its generation differs from the one in old handle
+    return (_tasks[INDEX].slot != NONE) && (_tasks[INDEX].generation == (handle >> 8));
+}
+
+void Scheduler::clear()
+{
     for (size_t i = 0; i < MAX_TASKS; i++)
     {
-        // if the id is already registered, cancel its timeout and reassign
-        if (_tasks[i].function == nullptr || _tasks[i].id == task.id)
+        if (_tasks[i].slot != NONE)
         {
-            index = i;
-            break;
+            // invalidate the handles which are still held by the modules
+            _tasks[i].generation++;
         }
+
+        _tasks[i].function = nullptr;
+        _tasks[i].slot     = NONE;
+        _tasks[i].previous = NONE;
+        _tasks[i].next     = (i + 1) < MAX_TASKS ? static_cast<uint8_t>(i + 1) : NONE;
+    }
+
+    for (size_t level = 0; level < LEVELS; level++)
+    {
+        for (size_t slot = 0; slot < SLOTS; slot++)
+        {
+            _slots[level][slot] = NONE;
+        }
+
+        _occupied[level] = 0;
     }
 
-    if (index >= MAX_TASKS)
+    _free = 0;
+    _now  = core::mcu::timing::ms();
+}
+
+bool Scheduler::add(handle_t& handle, uint32_t timeout, uint32_t period, task_t& task)
+{
+    // if the handle is already registered, cancel its timeout and reassign
+    cancel(handle);
+
+    if (!task || (_free == NONE))
     {
         return false;
     }
 
-    _tasks[index].function = std::move(task.function);
-    _tasks[index].timeout  = core::mcu::timing::ms() + task.timeout;
+    const uint32_t NOW   = core::mcu::timing::ms();
+    const uint8_t  INDEX = _free;
+    auto&          entry = _tasks[INDEX];
+
+    _free            = entry.next;
+    entry.function   = task;
+    entry.period     = period;
+    entry.expires    = (static_cast<int32_t>(NOW - _now) > 0 ? NOW : _now) + (timeout ? timeout : 1);
+
+    link(INDEX);
+
+    handle = static_cast<handle_t>((entry.generation << 8) | INDEX);
 
     return true;
-}
\ No newline at end of file
+}
+
+void Scheduler::link(uint8_t index)
+{
+    auto&    entry = _tasks[index];
+    uint32_t delta = entry.expires - _now;
+
+    // tasks too far in the future are parked in the highest level and
+    // placed again once that slot is reached
+    if (delta > MAX_TIMEOUT)
+    {
+        delta = MAX_TIMEOUT;
+    }
+
+    size_t level = 0;
+
+    while ((level < (LEVELS - 1)) && (delta >= (1UL << (SLOT_BITS * (level + 1)))))
+    {
+        level++;
+    }
+
+    const auto SLOT = static_cast<uint8_t>(((_now + delta) >> (SLOT_BITS * level)) & (SLOTS - 1));
+
+    entry.slot     = static_cast<uint8_t>((level * SLOTS) + SLOT);
+    entry.previous = NONE;
+    entry.next     = _slots[level][SLOT];
+
+    if (entry.next != NONE)
+    {
+        _tasks[entry.next].previous = index;
+    }
+
+    _slots[level][SLOT] = index;
+    _occupied[level] |= (1UL << SLOT);
+}
+
+void Scheduler::unlink(uint8_t index)
+{
+    auto&        entry = _tasks[index];
+    const size_t LEVEL = entry.slot / SLOTS;
+    const size_t SLOT  = entry.slot % SLOTS;
+
+    if (entry.previous != NONE)
+    {
+        _tasks[entry.previous].next = entry.next;
+    }
+    else
+    {
+        _slots[LEVEL][SLOT] = entry.next;
+    }
+
+    if (entry.next != NONE)
+    {
+        _tasks[entry.next].previous = entry.previous;
+    }
+
+    if (_slots[LEVEL][SLOT] == NONE)
+    {
+        _occupied[LEVEL] &= ~(1UL << SLOT);
+    }
+
+    entry.slot     = NONE;
+    entry.previous = NONE;
+    entry.next     = NONE;
+}
+
+void Scheduler::release(uint8_t index)
+{
+    auto& entry = _tasks[index];
+
+    entry.function = nullptr;
+    entry.generation++;
+    entry.next = _free;
+    _free      = index;
+}
+
+bool Scheduler::nextExpiry(uint32_t& time) const
+{
+    bool     found    = false;
+    uint32_t distance = 0;
+
+    for (size_t level = 0; level < LEVELS; level++)
+    {
+        if (!_occupied[level])
+        {
+            continue;
+        }
+
+        // slot on each level is processed once the lower bits of time become zero
+        // and the bits of that level match the slot index
+        const size_t   SHIFT    = SLOT_BITS * level;
+        const uint32_t BASE     = _now >> SHIFT;
+        const size_t   NEXT     = (BASE + 1) & (SLOTS - 1);
+        const uint32_t ROTATED  = (_occupied[level] >> NEXT) | (_occupied[level] << ((SLOTS - NEXT) & (SLOTS - 1)));
+        const uint32_t EXPIRY   = (BASE + 1 + __builtin_ctz(ROTATED)) << SHIFT;
+        const uint32_t DISTANCE = EXPIRY - _now;
+
+        if (!found || (DISTANCE < distance))
+        {
+            found    = true;
+            distance = DISTANCE;
+            time     = EXPIRY;
+        }
+    }
+
+    return found;
+}
+
+void Scheduler::expire(uint32_t now)
+{
+    // move the tasks from higher levels closer to expiry first
+    for (size_t level = LEVELS - 1; level > 0; level--)
+    {
+        const size_t SHIFT = SLOT_BITS * level;
+
+        if (_now & ((1UL << SHIFT) - 1))
+        {
+            continue;
+        }
+
+        const size_t SLOT = (_now >> SHIFT) & (SLOTS - 1);
+
+        while (_slots[level][SLOT] != NONE)
+        {
+            const uint8_t INDEX = _slots[level][SLOT];
+
+            unlink(INDEX);
+            link(INDEX);
+        }
+    }
+
+    const size_t SLOT = _now & (SLOTS - 1);
+
+    // task can cancel other tasks, so take them one by one
+    while (_slots[0][SLOT] != NONE)
+    {
+        const uint8_t INDEX = _slots[0][SLOT];
+        auto&         entry = _tasks[INDEX];
+        const auto    TASK  = entry.function;
+
+        unlink(INDEX);
+
+        if (entry.period)
+        {
+            entry.expires += entry.period;
+
+            // skip the periods which have been missed
+            if (static_cast<int32_t>(now - entry.expires) >= 0)
+            {
+                entry.expires += (((now - entry.expires) / entry.period) + 1) * entry.period;
+            }
+
+            link(INDEX);
+        }
+        else
+        {
+            release(INDEX);
+        }
+
+        TASK();
+    }
+}
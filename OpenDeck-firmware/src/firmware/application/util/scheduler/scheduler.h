@@ -18,40 +18,105 @@ limitations under the License.
 
 #pragma once
 
+#include "application/util/function/function.h"
+
 #include <inttypes.h>
-#include <functional>
 #include <stddef.h>
 
 namespace util
 {
-    // a simple scheduler used to run one-off tasks specified time from now
+    /// Runs one-shot and periodic tasks at specified time from now.
+    /// Tasks are kept in hierarchical timing wheel: each level has SLOTS slots, with slot
+    /// on level N covering SLOTS^N milliseconds. Task is placed in the lowest level which
+    /// can hold its timeout and moved to lower levels as its timeout approaches, so both
+    /// registering and cancelling the task take constant time, and update() only visits
+    /// the slots whose time has come.
     class Scheduler
     {
         public:
-        Scheduler();
+        using task_t   = Function<void()>;
+        using handle_t = uint16_t;
 
-        struct Task
-        {
-            size_t                id       = 0;
-            uint32_t              timeout  = 0;
-            std::function<void()> function = nullptr;
+        /// Value of handle which doesn't refer to any task.
+        static constexpr handle_t INVALID_HANDLE = 0xFFFF;
 
-            Task() = default;
+        // Scheduler is shared by all application modules which need to run something later,
+        // hence the singleton approach.
 
-            Task(size_t id, uint32_t timeout, std::function<void()> function)
-                : id(id)
-                , timeout(timeout)
-                , function(std::move(function))
-            {}
-        };
+        static Scheduler& instance()
+        {
+            static Scheduler instance;
+            return instance;
+        }
 
-        bool init();
+        /// Runs all tasks whose timeout has expired since the last call.
         void update();
-        bool registerTask(Task&& task);
+
+        /// Registers task which runs once after specified time.
+        /// If the handle refers to already registered task, that task is cancelled first.
+        /// param [in,out]: handle  Handle of the task. Set to INVALID_HANDLE if the task can't be registered.
+        /// param [in]: timeout     Time in milliseconds after which the task runs.
+        /// param [in]: task        Task to run.
+        /// returns: True if the task has been registered, false otherwise.
+        bool registerTask(handle_t& handle, uint32_t timeout, task_t task);
+
+        /// Registers task which runs repeatedly with specified period until cancelled.
+        /// If the handle refers to already registered task, that task is cancelled first.
+        /// param [in,out]: handle  Handle of the task. Set to INVALID_HANDLE if the task can't be registered.
+        /// param [in]: period      Time in milliseconds between two runs of the task.
+        /// param [in]: task        Task to run.
+        /// returns: True if the task has been registered, false otherwise.
+        bool registerPeriodicTask(handle_t& handle, uint32_t period, task_t task);
+
+        /// Cancels the task if it is still registered and invalidates the handle.
+        void cancel(handle_t& handle);
+
+        /// Checks whether the task referred to by the handle will still run.
+        bool isRegistered(handle_t handle) const;
+
+        /// Removes all tasks.
+        void clear();
 
         private:
-        static constexpr size_t MAX_TASKS = 10;
+        Scheduler()
+        {
+            clear();
+        }
+
+        static constexpr size_t   MAX_TASKS   = 16;
+        static constexpr size_t   LEVELS      = 4;
+        static constexpr size_t   SLOT_BITS   = 5;
+        static constexpr size_t   SLOTS       = 1 << SLOT_BITS;
+        static constexpr uint32_t MAX_TIMEOUT = (1UL << (SLOT_BITS * LEVELS)) - 1;
+        static constexpr uint8_t  NONE        = 0xFF;
+
+        static_assert(SLOTS == 32, "Slot occupancy is kept in 32-bit mask");
+        static_assert(MAX_TASKS < NONE, "Task index doesn't fit in handle");
 
-        Task _tasks[MAX_TASKS] = {};
+        struct Task
+        {
+            task_t   function   = nullptr;
+            uint32_t expires    = 0;
+            uint32_t period     = 0;
+            uint8_t  slot       = NONE;    ///< Index of the slot in which the task is linked (level * SLOTS + slot).
+            uint8_t  previous   = NONE;
+            uint8_t  next       = NONE;
+            uint8_t  generation = 0;    ///< Incremented each time the task is released so that old handles can't refer to it.
+        };
+
+        Task     _tasks[MAX_TASKS]     = {};
+        uint8_t  _slots[LEVELS][SLOTS] = {};
+        uint32_t _occupied[LEVELS]     = {};
+        uint8_t  _free                 = NONE;
+        uint32_t _now                  = 0;    ///< Time up to which all the slots have been processed.
+
+        bool add(handle_t& handle, uint32_t timeout, uint32_t period, task_t& task);
+        void link(uint8_t index);
+        void unlink(uint8_t index);
+        void release(uint8_t index);
+        bool nextExpiry(uint32_t& time) const;
+        void expire(uint32_t now);
     };
 }    // namespace util
+
+#define TaskScheduler util::Scheduler::instance()
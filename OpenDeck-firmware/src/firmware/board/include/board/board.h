@@ -351,6 +351,29 @@ namespace board
             /// returns: True if there are new readings for specified digital input index.
             bool state(size_t index, Readings& readings);
 
+            /// Reports all digital inputs whose state has changed since the last call, so that only
+            /// those need to be read with state(). Inputs are packed in 32-bit words: bit N of word W
+            /// represents digital input (W * 32) + N.
+            /// param [in,out]: changed     Array in which changed inputs are marked.
+            /// param [in,out]: states      Array in which the newest state of each input is stored.
+            ///                             Can be nullptr if states aren't needed.
+            /// param [in]:     words       Amount of words in changed and states arrays.
+            /// returns: True if at least one digital input has changed.
+            bool changes(uint32_t* changed, uint32_t* states, size_t words);
+
+            /// Quadrature pulses decoded from A and B signals of single encoder while the inputs are scanned.
+            struct EncoderPulses
+            {
+                int8_t   pulses = 0;    ///< Signed amount of pulses since the last read. Positive values are counter-clockwise.
+                uint32_t time   = 0;    ///< Time in microseconds at which the last pulse has been decoded.
+            };
+
+            /// Returns all pulses of requested encoder decoded since the last call.
+            /// param [in]:     index   Index of the encoder.
+            /// param [in,out]: pulses  Reference to variable in which decoded pulses are stored.
+            /// returns: True if the encoder has moved since the last call.
+            bool encoderPulses(size_t index, EncoderPulses& pulses);
+
             /// Calculates encoder index based on provided digital input index.
             /// param [in]: index   Digital input index from which encoder is being calculated.
             /// returns: Calculated encoder index.
@@ -386,6 +409,16 @@ namespace board
             /// param [in]: brightnessLevel See ledBrightness_t enum.
             void writeLedState(size_t index, ledBrightness_t ledBrightness);
 
+            /// Amount of bit planes needed to store ledBrightness_t value of each LED.
+            constexpr size_t LED_BRIGHTNESS_PLANES = 3;
+
+            /// Used to change the state of multiple LEDs with a single call.
+            /// param [in]: changed Bitmask of LEDs whose state should be changed, one bit per LED index.
+            /// param [in]: planes  LED_BRIGHTNESS_PLANES bitmasks placed one after another. Plane n holds
+            ///                     bit n of ledBrightness_t value of each LED.
+            /// param [in]: words   Amount of 32-bit words in changed mask and in each plane.
+            void writeLedStates(const uint32_t* changed, const uint32_t* planes, size_t words);
+
             /// Calculates RGB LED index based on provided single-color LED index.
             /// param [in]: index   Index of single-color LED.
             /// returns: Calculated index of RGB LED.
@@ -521,6 +554,48 @@ namespace board
         }    // namespace midi
     }    // namespace ble
 
+#ifdef PROJECT_TARGET_LOW_POWER
+    namespace power
+    {
+        /// Rate at which inputs are scanned.
+        enum class scanRate_t : uint8_t
+        {
+            FULL,
+            IDLE
+        };
+
+        /// Sets the rate at which inputs are scanned. While inputs are scanned at idle rate,
+        /// board wakes the MCU less often. Board switches back to full rate by itself once
+        /// a change of digital inputs is detected.
+        void setScanRate(scanRate_t rate);
+
+        /// Returns the rate at which inputs are currently scanned.
+        scanRate_t scanRate();
+
+        /// Puts the MCU to sleep until the next interrupt: input scan, ADC, USB, UART or BLE event.
+        void waitForEvent();
+    }    // namespace power
+#endif
+
+#ifdef PROJECT_TARGET_DUAL_CORE
+    namespace multicore
+    {
+        /// Starts the second core which then runs the specified function.
+        /// Function must never return.
+        void launch(void (*entry)());
+
+        /// Returns index of the core from which the function is called (0 or 1).
+        uint8_t core();
+
+        /// Parks the other core in RAM so that flash can be erased or written.
+        /// Must be followed with release().
+        void lockout();
+
+        /// Resumes the core parked with lockout().
+        void release();
+    }    // namespace multicore
+#endif
+
     namespace bootloader
     {
         uint32_t magicBootValue();
@@ -536,6 +611,15 @@ namespace board
 #ifdef OPENDECK_FW_BOOT
         // don't allow this API from application
         uint8_t readFlash(uint32_t address);
+
+        /// Returns pointer through which flash can be read directly starting from specified address
+        /// or nullptr if flash isn't memory-mapped on the MCU in use.
+        const uint8_t* flashData(uint32_t address);
+
+        /// Value used to skip application verification on boot if the application hasn't changed
+        /// since it was verified. Location of this value is board-specific. Returns 0 if not supported.
+        uint32_t appVerificationMarker();
+        void     setAppVerificationMarker(uint32_t value);
 #endif
     }    // namespace bootloader
 }    // namespace board
\ No newline at end of file
@@ -0,0 +1,91 @@
+/*
+
+Copyright Igor Petrovic
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*/
+
+#pragma once
+
+#include <inttypes.h>
+#include <stddef.h>
+
+namespace board::util
+{
+    /// Lock-free queue with single producer and single consumer, used to hand off the data
+    /// between ISR and application or between two cores. Producer fills the slot returned by
+    /// back() and makes it visible to consumer with push(). When the queue is full, producer
+    /// gets no slot until consumer removes the oldest one - queued values are never overwritten.
+    /// Counters are single bytes so that they are read and written atomically on every
+    /// supported MCU.
+    template<typename T, size_t CAPACITY>
+    class SpscRing
+    {
+        public:
+        static_assert(CAPACITY && !(CAPACITY & (CAPACITY - 1)), "Capacity must be a power of two");
+        static_assert(CAPACITY <= 128, "Capacity must fit in counter");
+
+        /// Producer: returns slot which should be filled or nullptr if the ring is full.
+        T* back()
+        {
+            const uint8_t HEAD = __atomic_load_n(&_head, __ATOMIC_RELAXED);
+            const uint8_t TAIL = __atomic_load_n(&_tail, __ATOMIC_ACQUIRE);
+
+            if (static_cast<uint8_t>(HEAD - TAIL) >= CAPACITY)
+            {
+                return nullptr;
+            }
+
+            return &_values[HEAD & (CAPACITY - 1)];
+        }
+
+        /// Producer: makes the slot returned by back() available to consumer.
+        void push()
+        {
+            __atomic_store_n(&_head, static_cast<uint8_t>(_head + 1), __ATOMIC_RELEASE);
+        }
+
+        /// Consumer: returns the oldest value or nullptr if the ring is empty.
+        T* front()
+        {
+            const uint8_t TAIL = __atomic_load_n(&_tail, __ATOMIC_RELAXED);
+            const uint8_t HEAD = __atomic_load_n(&_head, __ATOMIC_ACQUIRE);
+
+            if (HEAD == TAIL)
+            {
+                return nullptr;
+            }
+
+            return &_values[TAIL & (CAPACITY - 1)];
+        }
+
+        /// Consumer: releases the slot returned by front() back to producer.
+        void pop()
+        {
+            __atomic_store_n(&_tail, static_cast<uint8_t>(_tail + 1), __ATOMIC_RELEASE);
+        }
+
+        /// Returns the amount of queued values. Exact only when called from producer or consumer
+        /// while the other side is idle.
+        size_t size() const
+        {
+            return static_cast<uint8_t>(__atomic_load_n(&_head, __ATOMIC_ACQUIRE) - __atomic_load_n(&_tail, __ATOMIC_ACQUIRE));
+        }
+
+        private:
+        T       _values[CAPACITY] = {};
+        uint8_t _head             = 0;
+        uint8_t _tail             = 0;
+    };
+}    // namespace board::util
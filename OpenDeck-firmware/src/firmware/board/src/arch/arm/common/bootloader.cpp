@@ -27,6 +27,9 @@ namespace
 {
     /// Variable used to specify whether to enter bootloader or application.
     uint32_t fwEntryType __attribute__((section(".noinit"))) __attribute__((used));
+
+    /// Kept in RAM which isn't cleared on reset: valid only across warm resets.
+    uint32_t appVerified __attribute__((section(".noinit"))) __attribute__((used));
 }    // namespace
 
 namespace board::bootloader
@@ -41,6 +44,22 @@ namespace board::bootloader
         fwEntryType = value;
     }
 
+    const uint8_t* flashData(uint32_t address)
+    {
+        // flash is memory-mapped on all supported ARM MCUs
+        return reinterpret_cast<const uint8_t*>(address);
+    }
+
+    uint32_t appVerificationMarker()
+    {
+        return appVerified;
+    }
+
+    void setAppVerificationMarker(uint32_t value)
+    {
+        appVerified = value;
+    }
+
     void runApplication()
     {
         core::mcu::deInit();
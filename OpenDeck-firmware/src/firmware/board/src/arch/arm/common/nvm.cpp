@@ -36,6 +36,39 @@ namespace
 
         bool erasePage(lib::emueeprom::page_t page) override
         {
+#ifdef PROJECT_TARGET_DUAL_CORE
+            // other core can't execute from flash while it's being erased
+            board::multicore::lockout();
+            const bool RESULT = erase(page);
+            board::multicore::release();
+
+            return RESULT;
+#else
+            return erase(page);
+#endif
+        }
+
+        bool write32(lib::emueeprom::page_t page, uint32_t offset, uint32_t data) override
+        {
+#ifdef PROJECT_TARGET_DUAL_CORE
+            board::multicore::lockout();
+            const bool RESULT = core::mcu::flash::write32(START_ADDRESS(page) + offset, data);
+            board::multicore::release();
+
+            return RESULT;
+#else
+            return core::mcu::flash::write32(START_ADDRESS(page) + offset, data);
+#endif
+        }
+
+        bool read32(lib::emueeprom::page_t page, uint32_t offset, uint32_t& data) override
+        {
+            return core::mcu::flash::read32(START_ADDRESS(page) + offset, data);
+        }
+
+        private:
+        bool erase(lib::emueeprom::page_t page)
+        {
             switch (page)
             {
             case lib::emueeprom::page_t::PAGE_FACTORY:
@@ -71,17 +104,6 @@ namespace
             }
         }
 
-        bool write32(lib::emueeprom::page_t page, uint32_t offset, uint32_t data) override
-        {
-            return core::mcu::flash::write32(START_ADDRESS(page) + offset, data);
-        }
-
-        bool read32(lib::emueeprom::page_t page, uint32_t offset, uint32_t& data) override
-        {
-            return core::mcu::flash::read32(START_ADDRESS(page) + offset, data);
-        }
-
-        private:
         static constexpr uint32_t START_ADDRESS(lib::emueeprom::page_t page)
         {
             switch (page)
@@ -0,0 +1,50 @@
+/*
+
+Copyright Igor Petrovic
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*/
+
+#ifdef PROJECT_TARGET_LOW_POWER
+
+#include "board/board.h"
+#include "internal.h"
+
+#include "nrfx.h"
+#include "nrf_sdm.h"
+#include "nrf_soc.h"
+
+namespace board::power
+{
+    void waitForEvent()
+    {
+        uint8_t softDeviceEnabled = 0;
+        sd_softdevice_is_enabled(&softDeviceEnabled);
+
+        if (softDeviceEnabled)
+        {
+            // application can't sleep on its own while SoftDevice is running
+            sd_app_evt_wait();
+        }
+        else
+        {
+            // clear the event register first so that only new events wake the MCU
+            __WFE();
+            __SEV();
+            __WFE();
+        }
+    }
+}    // namespace board::power
+
+#endif
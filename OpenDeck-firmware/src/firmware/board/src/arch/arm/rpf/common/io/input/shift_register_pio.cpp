@@ -0,0 +1,202 @@
+/*
+
+Copyright Igor Petrovic
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*/
+
+#ifdef PROJECT_TARGET_SUPPORT_DIGITAL_INPUTS
+#ifdef PROJECT_TARGET_DRIVER_DIGITAL_INPUT_SHIFT_REGISTER_PIO
+
+#include "board/board.h"
+#include "internal.h"
+#include "common/io/input/frames.h"
+#include <target.h>
+
+#include "core/mcu.h"
+#include "core/util/util.h"
+
+#include "hardware/clocks.h"
+#include "hardware/dma.h"
+#include "hardware/pio.h"
+#include "hardware/pio_instructions.h"
+
+using namespace board::io::digital_in;
+using namespace board::detail;
+using namespace board::detail::io::digital_in;
+
+// Shift register chain is clocked by PIO state machine continuously at PROJECT_TARGET_SR_IN_SCAN_RATE.
+// Each scan produces a single 32-bit frame which DMA moves from PIO RX FIFO into the frame ring
+// without any CPU involvement. Timer ISR only picks the most recent complete frame and passes it
+// to the application once per millisecond, the same way bit-banged driver does, so that the
+// debouncing in application remains unchanged.
+
+namespace
+{
+    constexpr uint32_t FRAME_BITS = PROJECT_TARGET_NR_OF_IN_SR * 8;
+
+    static_assert(FRAME_BITS <= 32, "Entire shift register chain must fit into single PIO frame");
+
+    // latch low, latch high, loop counter setup and two cycles per each bit
+    constexpr uint32_t CYCLES_PER_FRAME = 3 + (FRAME_BITS * 2);
+
+    // DMA wraps the write address on ring size boundary, so the ring must be aligned to its size
+    constexpr size_t FRAME_RING_SIZE      = 2;
+    constexpr size_t FRAME_RING_SIZE_BITS = 3;
+
+    static_assert((FRAME_RING_SIZE * sizeof(uint32_t)) == (1 << FRAME_RING_SIZE_BITS), "Invalid frame ring size");
+
+    // inputs are active low: initialize the frames as if nothing is pressed
+    alignas(FRAME_RING_SIZE * sizeof(uint32_t)) volatile uint32_t frameRing[FRAME_RING_SIZE] = { 0xFFFFFFFF, 0xFFFFFFFF };
+
+    Frames<PROJECT_TARGET_MAX_NR_OF_DIGITAL_INPUTS, MAX_READING_COUNT> digitalInFrames;
+
+    PIO  pio        = pio0;
+    uint sm         = 0;
+    uint dmaChannel = 0;
+
+    inline void storeDigitalIn()
+    {
+        // DMA transfer count is large enough for days of scanning, but re-arm it once it runs out
+        if (!dma_channel_is_busy(dmaChannel))
+        {
+            dma_channel_set_trans_count(dmaChannel, UINT32_MAX, true);
+        }
+
+        // DMA is currently writing to the slot after the last complete frame
+        auto     writeAddress = reinterpret_cast<uintptr_t>(dma_channel_hw_addr(dmaChannel)->write_addr);
+        size_t   nextFrame    = (writeAddress - reinterpret_cast<uintptr_t>(&frameRing[0])) / sizeof(uint32_t);
+        uint32_t frame        = frameRing[(nextFrame + FRAME_RING_SIZE - 1) % FRAME_RING_SIZE];
+
+        auto readings = digitalInFrames.back();
+
+        for (uint8_t shiftRegister = 0; shiftRegister < PROJECT_TARGET_NR_OF_IN_SR; shiftRegister++)
+        {
+            // register shifts out MSB first and first shifted bit ends up as MSB of the frame
+            auto state = static_cast<uint8_t>(~(frame >> (FRAME_BITS - 8 - (shiftRegister * 8))));
+
+            for (uint8_t input = 0; input < 8; input++)
+            {
+                readings->set((shiftRegister * 8) + input, (state >> input) & 0x01);
+            }
+        }
+
+        digitalInFrames.publish();
+    }
+}    // namespace
+
+namespace board::detail::io::digital_in
+{
+    void init()
+    {
+        // side-set pin is shift register clock, set pin is latch
+        const uint16_t INSTRUCTIONS[] = {
+            // load parallel inputs
+            static_cast<uint16_t>(pio_encode_set(pio_pins, 0) | pio_encode_sideset(1, 0)),
+            static_cast<uint16_t>(pio_encode_set(pio_pins, 1) | pio_encode_sideset(1, 0)),
+            static_cast<uint16_t>(pio_encode_set(pio_x, FRAME_BITS - 1) | pio_encode_sideset(1, 0)),
+
+            // sample the data while clock is low, shift next bit out on rising edge
+            static_cast<uint16_t>(pio_encode_in(pio_pins, 1) | pio_encode_sideset(1, 0)),
+            static_cast<uint16_t>(pio_encode_jmp_x_dec(3) | pio_encode_sideset(1, 1)),
+        };
+
+        const pio_program_t PROGRAM = {
+            .instructions = INSTRUCTIONS,
+            .length       = sizeof(INSTRUCTIONS) / sizeof(INSTRUCTIONS[0]),
+            .origin       = -1,
+        };
+
+        sm = pio_claim_unused_sm(pio, true);
+
+        uint offset = pio_add_program(pio, &PROGRAM);
+
+        pio_gpio_init(pio, PIN_INDEX_SR_IN_CLK);
+        pio_gpio_init(pio, PIN_INDEX_SR_IN_LATCH);
+        pio_gpio_init(pio, PIN_INDEX_SR_IN_DATA);
+
+        pio_sm_set_pins_with_mask(pio, sm, 1u << PIN_INDEX_SR_IN_LATCH, (1u << PIN_INDEX_SR_IN_LATCH) | (1u << PIN_INDEX_SR_IN_CLK));
+        pio_sm_set_consecutive_pindirs(pio, sm, PIN_INDEX_SR_IN_CLK, 1, true);
+        pio_sm_set_consecutive_pindirs(pio, sm, PIN_INDEX_SR_IN_LATCH, 1, true);
+        pio_sm_set_consecutive_pindirs(pio, sm, PIN_INDEX_SR_IN_DATA, 1, false);
+
+        pio_sm_config config = pio_get_default_sm_config();
+        sm_config_set_wrap(&config, offset, offset + PROGRAM.length - 1);
+        sm_config_set_sideset(&config, 1, false, false);
+        sm_config_set_sideset_pins(&config, PIN_INDEX_SR_IN_CLK);
+        sm_config_set_set_pins(&config, PIN_INDEX_SR_IN_LATCH, 1);
+        sm_config_set_in_pins(&config, PIN_INDEX_SR_IN_DATA);
+        sm_config_set_in_shift(&config, false, true, FRAME_BITS);
+        sm_config_set_fifo_join(&config, PIO_FIFO_JOIN_RX);
+        sm_config_set_clkdiv(&config,
+                             static_cast<float>(clock_get_hz(clk_sys)) / static_cast<float>(CYCLES_PER_FRAME * PROJECT_TARGET_SR_IN_SCAN_RATE));
+
+        pio_sm_init(pio, sm, offset, &config);
+
+        dmaChannel = dma_claim_unused_channel(true);
+
+        dma_channel_config dmaConfig = dma_channel_get_default_config(dmaChannel);
+        channel_config_set_transfer_data_size(&dmaConfig, DMA_SIZE_32);
+        channel_config_set_read_increment(&dmaConfig, false);
+        channel_config_set_write_increment(&dmaConfig, true);
+        channel_config_set_ring(&dmaConfig, true, FRAME_RING_SIZE_BITS);
+        channel_config_set_dreq(&dmaConfig, pio_get_dreq(pio, sm, false));
+
+        dma_channel_configure(dmaChannel,
+                              &dmaConfig,
+                              frameRing,
+                              &pio->rxf[sm],
+                              UINT32_MAX,
+                              true);
+
+        pio_sm_set_enabled(pio, sm, true);
+    }
+}    // namespace board::detail::io::digital_in
+
+namespace board::io::digital_in
+{
+    bool state(size_t index, Readings& readings)
+    {
+        if (index >= PROJECT_TARGET_MAX_NR_OF_DIGITAL_INPUTS)
+        {
+            return false;
+        }
+
+        index = detail::map::BUTTON_INDEX(index);
+
+        return digitalInFrames.state(index, readings);
+    }
+
+    size_t encoderFromInput(size_t index)
+    {
+        return index / 2;
+    }
+
+    size_t encoderComponentFromEncoder(size_t index, encoderComponent_t component)
+    {
+        index *= 2;
+
+        if (component == encoderComponent_t::A)
+        {
+            return index;
+        }
+
+        return index + 1;
+    }
+}    // namespace board::io::digital_in
+
+#include "common/io/input/common.cpp.include"
+
+#endif
+#endif
@@ -0,0 +1,69 @@
+/*
+
+Copyright Igor Petrovic
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*/
+
+#ifdef PROJECT_TARGET_DUAL_CORE
+
+#include "board/board.h"
+#include "internal.h"
+
+#include "pico/multicore.h"
+
+namespace
+{
+    void (*coreEntry)() = nullptr;
+
+    void core1Main()
+    {
+        // allow core 0 to park this core while flash is written
+        multicore_lockout_victim_init();
+        coreEntry();
+    }
+}    // namespace
+
+namespace board::multicore
+{
+    void launch(void (*entry)())
+    {
+        coreEntry = entry;
+        multicore_launch_core1(core1Main);
+    }
+
+    uint8_t core()
+    {
+        return get_core_num();
+    }
+
+    void lockout()
+    {
+        // nothing to park if the other core hasn't been started
+        if (coreEntry != nullptr)
+        {
+            multicore_lockout_start_blocking();
+        }
+    }
+
+    void release()
+    {
+        if (coreEntry != nullptr)
+        {
+            multicore_lockout_end_blocking();
+        }
+    }
+}    // namespace board::multicore
+
+#endif
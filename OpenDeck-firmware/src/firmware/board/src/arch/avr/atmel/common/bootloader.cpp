@@ -39,6 +39,21 @@ namespace board::bootloader
         eeprom_update_dword((uint32_t*)REBOOT_VALUE_EEPROM_LOCATION, value);
     }
 
+    const uint8_t* flashData(uint32_t address)
+    {
+        // flash is in separate address space
+        return nullptr;
+    }
+
+    uint32_t appVerificationMarker()
+    {
+        return 0;
+    }
+
+    void setAppVerificationMarker(uint32_t value)
+    {
+    }
+
     void runApplication()
     {
         __asm__ __volatile__(
@@ -21,10 +21,14 @@ limitations under the License.
 
 #include "board/board.h"
 #include "internal.h"
+#include "common/io/spsc.h"
+#include "common/io/analog/schedule.h"
 #include <target.h>
 
 #include "core/util/util.h"
 
+#include <string.h>
+
 using namespace board::io::analog;
 using namespace board::detail;
 using namespace board::detail::io::analog;
@@ -34,13 +38,17 @@ static_assert(PROJECT_MCU_ADC_SAMPLES > 0, "At least 1 ADC sample required");
 namespace
 {
     constexpr size_t  ANALOG_IN_BUFFER_SIZE = PROJECT_TARGET_MAX_NR_OF_ANALOG_INPUTS;
-    uint8_t           analogIndex;
-    volatile uint16_t analogBuffer[ANALOG_IN_BUFFER_SIZE];
     uint8_t           activeMux;
     uint8_t           activeMuxInput;
     volatile uint16_t sample;
     volatile uint8_t  sampleCounter;
 
+    Schedule<PROJECT_TARGET_ADC_SCHEDULE_SLOTS> schedule(map::ADC_SCHEDULE_INPUTS(), map::ADC_SCHEDULE_FRAME_END());
+
+    // latest samples of all inputs are passed to application once all slots in frame are sampled
+    Sample                                                     samples[ANALOG_IN_BUFFER_SIZE];
+    board::detail::io::Snapshot<Sample, ANALOG_IN_BUFFER_SIZE> analogFrames;
+
     /// Configures one of 16 inputs/outputs on 4067 multiplexer.
     inline void setMuxInput()
     {
@@ -51,6 +59,21 @@ namespace
         CORE_MCU_IO_SET_STATE(PIN_PORT_MUX_S3, PIN_INDEX_MUX_S3, core::util::BIT_READ(activeMuxInput, 3));
 #endif
     }
+
+    /// Configures the multiplexer and its input from which the provided analog input is read.
+    inline void selectInput(uint8_t input)
+    {
+        const uint8_t MUX = input / PROJECT_TARGET_NR_OF_MUX_INPUTS;
+
+        if (MUX != activeMux)
+        {
+            activeMux = MUX;
+            core::mcu::adc::setActivePin(map::ADC_PIN(activeMux));
+        }
+
+        activeMuxInput = input % PROJECT_TARGET_NR_OF_MUX_INPUTS;
+        setMuxInput();
+    }
 }    // namespace
 
 namespace board::detail::io::analog
@@ -103,13 +126,18 @@ namespace board::detail::io::analog
             core::mcu::adc::read(map::ADC_PIN(0));
         }
 
-        core::mcu::adc::setActivePin(map::ADC_PIN(0));
+        activeMux = schedule.input() / PROJECT_TARGET_NR_OF_MUX_INPUTS;
+        core::mcu::adc::setActivePin(map::ADC_PIN(activeMux));
+        selectInput(schedule.input());
+
         core::mcu::adc::enableIt(board::detail::io::analog::ISR_PRIORITY);
         core::mcu::adc::startItConversion();
     }
 
     void isr(uint16_t adcValue)
     {
+        bool start = true;
+
         if (adcValue <= CORE_MCU_ADC_MAX_VALUE)
         {
             // always ignore first sample
@@ -121,36 +149,30 @@ namespace board::detail::io::analog
             if (++sampleCounter == (PROJECT_MCU_ADC_SAMPLES + 1))
             {
                 sample /= PROJECT_MCU_ADC_SAMPLES;
-                analogBuffer[analogIndex] = sample;
-                analogBuffer[analogIndex] |= ADC_NEW_READING_FLAG;
+
+                auto& latest = samples[schedule.input()];
+                latest.value = sample;
+                latest.count++;
+
                 sample        = 0;
                 sampleCounter = 0;
-                analogIndex++;
-                activeMuxInput++;
-
-                bool switchMux = (activeMuxInput == PROJECT_TARGET_NR_OF_MUX_INPUTS);
 
-                if (switchMux)
+                if (schedule.next())
                 {
-                    activeMuxInput = 0;
-                    activeMux++;
-
-                    if (activeMux == PROJECT_TARGET_NR_OF_MUX)
-                    {
-                        activeMux   = 0;
-                        analogIndex = 0;
-                    }
-
-                    // switch to next mux once all mux inputs are read
-                    core::mcu::adc::setActivePin(map::ADC_PIN(activeMux));
+                    memcpy(analogFrames.back(), samples, sizeof(samples));
+                    analogFrames.publish();
+                    start = nextFrame();
                 }
 
                 // always switch to next read pin
-                setMuxInput();
+                selectInput(schedule.input());
             }
         }
 
-        core::mcu::adc::startItConversion();
+        if (start)
+        {
+            core::mcu::adc::startItConversion();
+        }
     }
 }    // namespace board::detail::io::analog
 
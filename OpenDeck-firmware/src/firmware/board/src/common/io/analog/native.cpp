@@ -21,10 +21,14 @@ limitations under the License.
 
 #include "board/board.h"
 #include "internal.h"
+#include "common/io/spsc.h"
+#include "common/io/analog/schedule.h"
 #include <target.h>
 
 #include "core/util/util.h"
 
+#include <string.h>
+
 using namespace board::io::analog;
 using namespace board::detail;
 using namespace board::detail::io::analog;
@@ -34,10 +38,14 @@ static_assert(PROJECT_MCU_ADC_SAMPLES > 0, "At least 1 ADC sample required");
 namespace
 {
     constexpr size_t  ANALOG_IN_BUFFER_SIZE = PROJECT_TARGET_MAX_NR_OF_ANALOG_INPUTS;
-    uint8_t           analogIndex;
-    volatile uint16_t analogBuffer[ANALOG_IN_BUFFER_SIZE];
     volatile uint16_t sample;
     volatile uint8_t  sampleCounter;
+
+    Schedule<PROJECT_TARGET_ADC_SCHEDULE_SLOTS> schedule(map::ADC_SCHEDULE_INPUTS(), map::ADC_SCHEDULE_FRAME_END());
+
+    // latest samples of all inputs are passed to application once all slots in frame are sampled
+    Sample                                                     samples[ANALOG_IN_BUFFER_SIZE];
+    board::detail::io::Snapshot<Sample, ANALOG_IN_BUFFER_SIZE> analogFrames;
 }    // namespace
 
 namespace board::detail::io::analog
@@ -69,13 +77,15 @@ namespace board::detail::io::analog
             core::mcu::adc::read(map::ADC_PIN(0));
         }
 
-        core::mcu::adc::setActivePin(map::ADC_PIN(0));
+        core::mcu::adc::setActivePin(map::ADC_PIN(schedule.input()));
         core::mcu::adc::enableIt(board::detail::io::analog::ISR_PRIORITY);
         core::mcu::adc::startItConversion();
     }
 
     void isr(uint16_t adcValue)
     {
+        bool start = true;
+
         if (adcValue <= CORE_MCU_ADC_MAX_VALUE)
         {
             // always ignore first sample
@@ -87,23 +97,30 @@ namespace board::detail::io::analog
             if (++sampleCounter == (PROJECT_MCU_ADC_SAMPLES + 1))
             {
                 sample /= PROJECT_MCU_ADC_SAMPLES;
-                analogBuffer[analogIndex] = sample;
-                analogBuffer[analogIndex] |= ADC_NEW_READING_FLAG;
+
+                auto& latest = samples[schedule.input()];
+                latest.value = sample;
+                latest.count++;
+
                 sample        = 0;
                 sampleCounter = 0;
-                analogIndex++;
 
-                if (analogIndex == PROJECT_TARGET_MAX_NR_OF_ANALOG_INPUTS)
+                if (schedule.next())
                 {
-                    analogIndex = 0;
+                    memcpy(analogFrames.back(), samples, sizeof(samples));
+                    analogFrames.publish();
+                    start = nextFrame();
                 }
 
                 // always switch to next read pin
-                core::mcu::adc::setActivePin(map::ADC_PIN(analogIndex));
+                core::mcu::adc::setActivePin(map::ADC_PIN(schedule.input()));
             }
         }
 
-        core::mcu::adc::startItConversion();
+        if (start)
+        {
+            core::mcu::adc::startItConversion();
+        }
     }
 }    // namespace board::detail::io::analog
 
@@ -0,0 +1,77 @@
+/*
+
+Copyright Igor Petrovic
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*/
+
+#pragma once
+
+#include <inttypes.h>
+#include <stddef.h>
+
+namespace board::detail::io::analog
+{
+    /// Latest value of analog input along with the amount of samples taken so far, used by
+    /// application to check if the input was sampled since it was last read.
+    struct Sample
+    {
+        uint16_t value = 0;
+        uint8_t  count = 0;
+    };
+
+    /// Walks through the sampling schedule of analog inputs.
+    /// Schedule is a table of slots, each holding the input which is sampled in it. Inputs which
+    /// need to be sampled more often occupy more slots. Slots are grouped in frames: values are
+    /// passed to application once all the slots in frame are sampled, so that frequently sampled
+    /// inputs don't have to wait until every other input is sampled as well.
+    template<size_t SLOTS>
+    class Schedule
+    {
+        public:
+        static_assert(SLOTS > 0, "At least one slot required");
+
+        /// param [in]: inputs      Input sampled in each slot.
+        /// param [in]: frameEnd    Set for the last slot in each frame.
+        constexpr Schedule(const uint8_t* inputs, const bool* frameEnd)
+            : _inputs(inputs)
+            , _frameEnd(frameEnd)
+        {}
+
+        /// Returns the input which should be sampled in current slot.
+        uint8_t input() const
+        {
+            return _inputs[_slot];
+        }
+
+        /// Moves to the next slot, starting from the first one once all the slots are sampled.
+        /// returns: True if the frame is complete, ie. the last sampled slot was the last one in frame.
+        bool next()
+        {
+            const bool FRAME_END = _frameEnd[_slot];
+
+            if (++_slot >= SLOTS)
+            {
+                _slot = 0;
+            }
+
+            return FRAME_END;
+        }
+
+        private:
+        const uint8_t* _inputs;
+        const bool*    _frameEnd;
+        size_t         _slot = 0;
+    };
+}    // namespace board::detail::io::analog
@@ -28,9 +28,14 @@ limitations under the License.
 
 namespace
 {
+    constexpr uint8_t  STARTUP_INDICATOR_FLASHES = 3;
+    constexpr uint16_t STARTUP_INDICATOR_TIMEOUT = 150;
+
     bool              factoryResetInProgress;
     volatile uint16_t factoryResetIndicatorTimeout;
     bool              factoryResetIndicatorState;
+    volatile uint8_t  startupIndicatorPhases;
+    uint16_t          startupIndicatorTimeout;
 }    // namespace
 
 namespace board::detail::io::indicators
@@ -42,22 +47,37 @@ namespace board::detail::io::indicators
 
     void indicateApplicationLoad()
     {
-        static constexpr size_t   TOTAL_FLASHES               = 3;
-        static constexpr uint32_t LED_INDICATOR_STARTUP_DELAY = 150;
+        // flashes are played from update() so that the application doesn't wait for them
+        startupIndicatorTimeout = 0;
+        startupIndicatorPhases  = STARTUP_INDICATOR_FLASHES * 2;
 
-        for (size_t flash = 0; flash < TOTAL_FLASHES; flash++)
-        {
-            ALL_INDICATORS_ON();
-            core::mcu::timing::waitMs(LED_INDICATOR_STARTUP_DELAY);
-            ALL_INDICATORS_OFF();
-            core::mcu::timing::waitMs(LED_INDICATOR_STARTUP_DELAY);
-        }
+        ALL_INDICATORS_ON();
     }
 
     void update()
     {
         using namespace board::io::indicators;
 
+        if (startupIndicatorPhases)
+        {
+            if (++startupIndicatorTimeout == STARTUP_INDICATOR_TIMEOUT)
+            {
+                startupIndicatorTimeout = 0;
+
+                // each flash consists of on and off phase
+                if (--startupIndicatorPhases % 2)
+                {
+                    ALL_INDICATORS_OFF();
+                }
+                else if (startupIndicatorPhases)
+                {
+                    ALL_INDICATORS_ON();
+                }
+            }
+
+            return;
+        }
+
         if (!factoryResetInProgress)
         {
             UPDATE_USB_INDICATOR();
@@ -117,6 +137,7 @@ namespace board::io::indicators
 
     void indicateFactoryReset()
     {
+        startupIndicatorPhases = 0;
         ALL_INDICATORS_OFF();
         factoryResetInProgress = true;
     }
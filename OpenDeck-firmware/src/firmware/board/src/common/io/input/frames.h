@@ -0,0 +1,264 @@
+/*
+
+Copyright Igor Petrovic
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*/
+
+#pragma once
+
+#include "board/board.h"
+#include "internal.h"
+#include "common/io/spsc.h"
+#include "common/io/input/quadrature.h"
+#include <target.h>
+
+#include <inttypes.h>
+#include <stddef.h>
+#include <string.h>
+
+namespace board::detail::io::digital_in
+{
+    /// Returns the amount of 32-bit words needed to store a single bit for each input.
+    constexpr size_t maskWords(size_t inputs)
+    {
+        return (inputs + 31) / 32;
+    }
+
+    /// Fills the masks requested with board::io::digital_in::changes() from the masks of
+    /// physical inputs, translating physical indexes to the ones used in application.
+    /// returns: True if at least one input has changed.
+    inline bool reportChanges(const uint32_t* physicalChanged,
+                              const uint32_t* physicalStates,
+                              uint32_t*       changed,
+                              uint32_t*       states,
+                              size_t          words)
+    {
+        constexpr size_t WORDS = maskWords(PROJECT_TARGET_MAX_NR_OF_DIGITAL_INPUTS);
+
+        if (words > WORDS)
+        {
+            memset(&changed[WORDS], 0, (words - WORDS) * sizeof(uint32_t));
+
+            if (states != nullptr)
+            {
+                memset(&states[WORDS], 0, (words - WORDS) * sizeof(uint32_t));
+            }
+
+            words = WORDS;
+        }
+
+#ifndef PROJECT_TARGET_INDEXING_BUTTONS
+        memcpy(changed, physicalChanged, words * sizeof(uint32_t));
+
+        if (states != nullptr)
+        {
+            memcpy(states, physicalStates, words * sizeof(uint32_t));
+        }
+#else
+        memset(changed, 0, words * sizeof(uint32_t));
+
+        if (states != nullptr)
+        {
+            memset(states, 0, words * sizeof(uint32_t));
+        }
+
+        for (size_t i = 0; (i < PROJECT_TARGET_MAX_NR_OF_DIGITAL_INPUTS) && ((i / 32) < words); i++)
+        {
+            const size_t PHYSICAL = map::BUTTON_INDEX(i);
+            const size_t WORD     = PHYSICAL / 32;
+            const size_t BIT      = PHYSICAL % 32;
+
+            changed[i / 32] |= ((physicalChanged[WORD] >> BIT) & 0x01) << (i % 32);
+
+            if (states != nullptr)
+            {
+                states[i / 32] |= ((physicalStates[WORD] >> BIT) & 0x01) << (i % 32);
+            }
+        }
+#endif
+
+        for (size_t i = 0; i < words; i++)
+        {
+            if (changed[i])
+            {
+#ifdef PROJECT_TARGET_LOW_POWER
+                // first change ends idle scanning so that debouncing runs at full rate
+                board::power::setScanRate(board::power::scanRate_t::FULL);
+#endif
+
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    /// Passes complete scans of all digital inputs from the scanning ISR to the application.
+    /// ISR only stores the state of each input in a frame, while reading history of each
+    /// input is updated in application context once the frame is read, so no state is
+    /// shared between ISR and application apart from the frame queue.
+    /// Encoders are decoded from each scan in ISR instead, so that their pulses aren't lost
+    /// when the queue is full.
+    template<size_t INPUTS, size_t MAX_READINGS, size_t CAPACITY = 8>
+    class Frames
+    {
+        public:
+        static constexpr size_t WORDS    = maskWords(INPUTS);
+        static constexpr size_t ENCODERS = PROJECT_TARGET_SUPPORTED_NR_OF_ENCODERS;
+
+        Frames()
+        {
+            for (size_t i = 0; i < ENCODERS; i++)
+            {
+                _quadrature.init(i,
+                                 map::BUTTON_INDEX(board::io::digital_in::encoderComponentFromEncoder(i, board::io::digital_in::encoderComponent_t::A)),
+                                 map::BUTTON_INDEX(board::io::digital_in::encoderComponentFromEncoder(i, board::io::digital_in::encoderComponent_t::B)));
+            }
+        }
+
+        /// Single scan of all digital inputs.
+        class Frame
+        {
+            public:
+            void set(size_t index, bool state)
+            {
+                if (state)
+                {
+                    _bits[index / 32] |= (1UL << (index % 32));
+                }
+                else
+                {
+                    _bits[index / 32] &= ~(1UL << (index % 32));
+                }
+            }
+
+            bool state(size_t index) const
+            {
+                return (_bits[index / 32] >> (index % 32)) & 0x01;
+            }
+
+            uint32_t word(size_t index) const
+            {
+                return _bits[index];
+            }
+
+            private:
+            uint32_t _bits[WORDS] = {};
+        };
+
+        /// ISR: returns frame in which the states of all inputs should be stored.
+        /// If application hasn't read enough of the previous frames, scratch frame is returned
+        /// which is used only to decode the encoders.
+        Frame* back()
+        {
+            _back = _ring.back();
+            return _back != nullptr ? _back : &_scratch;
+        }
+
+        /// ISR: decodes the encoders from the frame returned by back() and makes the frame
+        /// available to application.
+        void publish()
+        {
+            auto frame = _back != nullptr ? _back : &_scratch;
+
+            _quadrature.decode([frame](size_t index)
+                               {
+                                   return frame->state(index);
+                               },
+                               scanTime());
+
+            if (_back != nullptr)
+            {
+                _ring.push();
+            }
+        }
+
+        /// Application: returns the pulses of encoder decoded since the last call.
+        bool encoderPulses(size_t index, board::io::digital_in::EncoderPulses& pulses)
+        {
+            return _quadrature.read(index, pulses);
+        }
+
+        /// Application: returns the readings of digital input made since the last call.
+        bool state(size_t index, board::io::digital_in::Readings& readings)
+        {
+            update();
+
+            readings               = _readings[index];
+            _readings[index].count = 0;
+
+            return readings.count > 0;
+        }
+
+        /// Application: passes the masks of inputs whose state has changed since the last call
+        /// and of the newest state of each input to reportChanges(). Changes are cleared afterwards.
+        bool changes(uint32_t* changed, uint32_t* states, size_t words)
+        {
+            update();
+
+            auto result = reportChanges(_changed, _states, changed, states, words);
+            memset(_changed, 0, sizeof(_changed));
+
+            return result;
+        }
+
+        /// Application: removes all readings.
+        void flush()
+        {
+            update();
+
+            for (size_t i = 0; i < INPUTS; i++)
+            {
+                _readings[i].count = 0;
+            }
+
+            memset(_changed, 0, sizeof(_changed));
+        }
+
+        private:
+        SpscRing<Frame, CAPACITY>        _ring;
+        Frame                           _scratch;
+        Frame*                          _back = nullptr;
+        Quadrature<ENCODERS>            _quadrature;
+        board::io::digital_in::Readings _readings[INPUTS] = {};
+        uint32_t                        _changed[WORDS]   = {};
+        uint32_t                        _states[WORDS]    = {};
+
+        void update()
+        {
+            while (auto frame = _ring.front())
+            {
+                for (size_t i = 0; i < INPUTS; i++)
+                {
+                    _readings[i].readings <<= 1;
+                    _readings[i].readings |= frame->state(i);
+
+                    if (++_readings[i].count > MAX_READINGS)
+                    {
+                        _readings[i].count = MAX_READINGS;
+                    }
+                }
+
+                for (size_t i = 0; i < WORDS; i++)
+                {
+                    _changed[i] |= frame->word(i) ^ _states[i];
+                    _states[i] = frame->word(i);
+                }
+
+                _ring.pop();
+            }
+        }
+    };
+}    // namespace board::detail::io::digital_in
@@ -21,6 +21,7 @@ limitations under the License.
 
 #include "board/board.h"
 #include "internal.h"
+#include "common/io/input/frames.h"
 #include <target.h>
 
 #include "core/util/util.h"
@@ -36,8 +37,8 @@ using namespace board::detail::io::digital_in;
 
 namespace
 {
-    volatile Readings digitalInBuffer[PROJECT_TARGET_MAX_NR_OF_DIGITAL_INPUTS];
-    volatile uint8_t  activeInColumn;
+    Frames<PROJECT_TARGET_MAX_NR_OF_DIGITAL_INPUTS, MAX_READING_COUNT> digitalInFrames;
+    uint8_t                                                            activeInColumn;
 
     inline void activateInputColumn()
     {
@@ -53,6 +54,8 @@ namespace
 
     inline void storeDigitalIn()
     {
+        auto frame = digitalInFrames.back();
+
         for (uint8_t column = 0; column < PROJECT_TARGET_NR_OF_BUTTON_COLUMNS; column++)
         {
             activateInputColumn();
@@ -71,17 +74,13 @@ namespace
                 CORE_MCU_IO_SET_LOW(PIN_PORT_SR_IN_CLK, PIN_INDEX_SR_IN_CLK);
                 io::spiWait();
 
-                digitalInBuffer[index].readings <<= 1;
-                digitalInBuffer[index].readings |= !CORE_MCU_IO_READ(PIN_PORT_SR_IN_DATA, PIN_INDEX_SR_IN_DATA);
-
-                if (++digitalInBuffer[index].count > MAX_READING_COUNT)
-                {
-                    digitalInBuffer[index].count = MAX_READING_COUNT;
-                }
+                frame->set(index, !CORE_MCU_IO_READ(PIN_PORT_SR_IN_DATA, PIN_INDEX_SR_IN_DATA));
 
                 CORE_MCU_IO_SET_HIGH(PIN_PORT_SR_IN_CLK, PIN_INDEX_SR_IN_CLK);
             }
         }
+
+        digitalInFrames.publish();
     }
 }    // namespace
 
@@ -136,14 +135,7 @@ namespace board::io::digital_in
 
         index = map::BUTTON_INDEX(index);
 
-        CORE_MCU_ATOMIC_SECTION
-        {
-            readings.count               = digitalInBuffer[index].count;
-            readings.readings            = digitalInBuffer[index].readings;
-            digitalInBuffer[index].count = 0;
-        }
-
-        return readings.count > 0;
+        return digitalInFrames.state(index, readings);
     }
 
     size_t encoderFromInput(size_t index)
@@ -21,6 +21,8 @@ limitations under the License.
 
 #include "board/board.h"
 #include "internal.h"
+#include "common/io/input/frames.h"
+#include "common/io/input/quadrature.h"
 #include <target.h>
 
 #include "core/util/util.h"
@@ -29,6 +31,7 @@ limitations under the License.
 #include <math.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 
 using namespace board::io::digital_in;
 using namespace board::detail;
@@ -36,24 +39,39 @@ using namespace board::detail::io::digital_in;
 
 namespace
 {
-    volatile Readings                                                     digitalInBuffer[PROJECT_TARGET_MAX_NR_OF_DIGITAL_INPUTS];
+    // port readings are passed from ISR through lock-free ring buffers: readings
+    // of individual inputs are only accessed from application
+    Readings                                                              digitalInBuffer[PROJECT_TARGET_MAX_NR_OF_DIGITAL_INPUTS];
     core::util::RingBuffer<core::mcu::io::portWidth_t, MAX_READING_COUNT> portBuffer[PROJECT_TARGET_NR_OF_DIGITAL_INPUT_PORTS];
 
+    constexpr size_t MASK_WORDS = maskWords(PROJECT_TARGET_MAX_NR_OF_DIGITAL_INPUTS);
+    uint32_t         digitalInChanged[MASK_WORDS];
+    uint32_t         digitalInStates[MASK_WORDS];
+
+    // encoders are decoded from each port reading so that no pulse is lost once port buffers are full
+    Quadrature<PROJECT_TARGET_SUPPORTED_NR_OF_ENCODERS> quadrature;
+
     inline void storeDigitalIn()
     {
+        core::mcu::io::portWidth_t portValue[PROJECT_TARGET_NR_OF_DIGITAL_INPUT_PORTS];
+
         // read all input ports instead of reading pin by pin to reduce the time spent in ISR
         for (uint8_t portIndex = 0; portIndex < PROJECT_TARGET_NR_OF_DIGITAL_INPUT_PORTS; portIndex++)
         {
-            portBuffer[portIndex].insert(CORE_MCU_IO_READ_IN_PORT(map::DIGITAL_IN_PORT(portIndex)));
+            portValue[portIndex] = CORE_MCU_IO_READ_IN_PORT(map::DIGITAL_IN_PORT(portIndex));
+            portBuffer[portIndex].insert(portValue[portIndex]);
         }
+
+        quadrature.decode([&portValue](size_t index)
+                          {
+                              return !core::util::BIT_READ(portValue[map::BUTTON_PORT_INDEX(index)], map::BUTTON_PIN_INDEX(index));
+                          },
+                          scanTime());
     }
 
-    inline void fillBuffer(size_t digitalInIndex)
+    /// Updates all buttons located on provided port with the port readings made so far.
+    inline void fillBuffer(size_t portIndex)
     {
-        // for provided button index, retrieve its port index
-        // upon reading update all buttons located on that port
-
-        auto                       portIndex = map::BUTTON_PORT_INDEX(digitalInIndex);
         core::mcu::io::portWidth_t portValue = 0;
 
         while (portBuffer[portIndex].remove(portValue))
@@ -62,8 +80,16 @@ namespace
             {
                 if (map::BUTTON_PORT_INDEX(i) == portIndex)
                 {
+                    bool reading = !core::util::BIT_READ(portValue, map::BUTTON_PIN_INDEX(i));
+
                     digitalInBuffer[i].readings <<= 1;
-                    digitalInBuffer[i].readings |= !core::util::BIT_READ(portValue, map::BUTTON_PIN_INDEX(i));
+                    digitalInBuffer[i].readings |= reading;
+
+                    if (reading != core::util::BIT_READ(digitalInStates[i / 32], i % 32))
+                    {
+                        core::util::BIT_WRITE(digitalInChanged[i / 32], i % 32, true);
+                        core::util::BIT_WRITE(digitalInStates[i / 32], i % 32, reading);
+                    }
 
                     if (++digitalInBuffer[i].count > MAX_READING_COUNT)
                     {
@@ -95,6 +121,13 @@ namespace board::detail::io::digital_in
                              core::mcu::io::pullMode_t::NONE);
 #endif
         }
+
+        for (size_t i = 0; i < PROJECT_TARGET_SUPPORTED_NR_OF_ENCODERS; i++)
+        {
+            quadrature.init(i,
+                            map::BUTTON_INDEX(encoderComponentFromEncoder(i, encoderComponent_t::A)),
+                            map::BUTTON_INDEX(encoderComponentFromEncoder(i, encoderComponent_t::B)));
+        }
     }
 }    // namespace board::detail::io::digital_in
 
@@ -107,7 +140,9 @@ namespace board::io::digital_in
             return false;
         }
 
-        fillBuffer(index);
+        // for provided button index, retrieve its port index
+        // upon reading update all buttons located on that port
+        fillBuffer(map::BUTTON_PORT_INDEX(index));
 
         index                        = map::BUTTON_INDEX(index);
         readings.count               = digitalInBuffer[index].count;
@@ -117,6 +152,29 @@ namespace board::io::digital_in
         return readings.count > 0;
     }
 
+    bool changes(uint32_t* changed, uint32_t* states, size_t words)
+    {
+        for (size_t i = 0; i < PROJECT_TARGET_NR_OF_DIGITAL_INPUT_PORTS; i++)
+        {
+            fillBuffer(i);
+        }
+
+        auto result = reportChanges(digitalInChanged, digitalInStates, changed, states, words);
+        memset(digitalInChanged, 0, sizeof(digitalInChanged));
+
+        return result;
+    }
+
+    bool encoderPulses(size_t index, EncoderPulses& pulses)
+    {
+        if (index >= PROJECT_TARGET_SUPPORTED_NR_OF_ENCODERS)
+        {
+            return false;
+        }
+
+        return quadrature.read(index, pulses);
+    }
+
     size_t encoderFromInput(size_t index)
     {
         return index / 2;
@@ -135,7 +193,33 @@ namespace board::io::digital_in
     }
 }    // namespace board::io::digital_in
 
-#include "common.cpp.include"
+namespace board::detail::io::digital_in
+{
+    void update()
+    {
+        storeDigitalIn();
+    }
+
+    void flush()
+    {
+        core::mcu::io::portWidth_t portValue = 0;
+
+        for (size_t i = 0; i < PROJECT_TARGET_NR_OF_DIGITAL_INPUT_PORTS; i++)
+        {
+            // discard port readings which haven't been processed yet
+            while (portBuffer[i].remove(portValue))
+            {
+            }
+        }
+
+        for (size_t i = 0; i < PROJECT_TARGET_MAX_NR_OF_DIGITAL_INPUTS; i++)
+        {
+            digitalInBuffer[i].count = 0;
+        }
+
+        memset(digitalInChanged, 0, sizeof(digitalInChanged));
+    }
+}    // namespace board::detail::io::digital_in
 
 #endif
 #endif
\ No newline at end of file
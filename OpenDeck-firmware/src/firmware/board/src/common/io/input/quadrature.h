@@ -0,0 +1,146 @@
+/*
+
+Copyright Igor Petrovic
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*/
+
+#pragma once
+
+#include "board/board.h"
+
+#include <inttypes.h>
+#include <stddef.h>
+
+namespace board::detail::io::digital_in
+{
+    /// Decodes A and B signals of encoders into quadrature pulses while the inputs are scanned,
+    /// so that no transition is lost when application reads the encoders less often than
+    /// the inputs are scanned.
+    /// ISR only increments running count of pulses for each encoder, and application remembers
+    /// the count it has read last, so no state is written from both sides. Counts are single
+    /// bytes so that they are read and written atomically on every supported MCU.
+    template<size_t ENCODERS>
+    class Quadrature
+    {
+        public:
+        /// Sets the digital inputs to which A and B signals of the encoder are connected.
+        void init(size_t index, size_t inputA, size_t inputB)
+        {
+            _encoders[index].inputA = inputA;
+            _encoders[index].inputB = inputB;
+        }
+
+        /// ISR: decodes new state of all encoders.
+        /// param [in]: state   Callable returning the state of digital input with provided index.
+        /// param [in]: time    Time of the scan in microseconds.
+        template<typename State>
+        void decode(State&& state, uint32_t time)
+        {
+            for (size_t i = 0; i < ENCODERS; i++)
+            {
+                auto& encoder = _encoders[i];
+
+                const bool PRIMED = encoder.history & PRIMED_BIT;
+
+                encoder.history = static_cast<uint8_t>(((encoder.history << 2) |
+                                                        (static_cast<uint8_t>(state(encoder.inputA)) << 1) |
+                                                        static_cast<uint8_t>(state(encoder.inputB))) &
+                                                       0x0F) |
+                                  PRIMED_BIT;
+
+                // the first reading is only stored as previous one
+                if (!PRIMED)
+                {
+                    continue;
+                }
+
+                const int8_t PULSE = LOOK_UP_TABLE[encoder.history & 0x0F];
+
+                if (!PULSE)
+                {
+                    continue;
+                }
+
+                encoder.time = time;
+
+                // time of the pulse must be visible before the count
+                __atomic_store_n(&encoder.produced, static_cast<uint8_t>(encoder.produced + PULSE), __ATOMIC_RELEASE);
+            }
+        }
+
+        /// Application: returns all pulses decoded since the last call.
+        /// Amount of pulses can't exceed the range of int8_t between two calls.
+        bool read(size_t index, board::io::digital_in::EncoderPulses& pulses)
+        {
+            auto&    encoder = _encoders[index];
+            uint8_t  before  = 0;
+            uint8_t  after   = 0;
+            uint32_t time    = 0;
+
+            // repeat if the ISR has decoded another pulse while reading
+            do
+            {
+                before = __atomic_load_n(&encoder.produced, __ATOMIC_ACQUIRE);
+                time   = encoder.time;
+
+                __atomic_thread_fence(__ATOMIC_ACQUIRE);
+
+                after = __atomic_load_n(&encoder.produced, __ATOMIC_RELAXED);
+            } while (before != after);
+
+            pulses.pulses    = static_cast<int8_t>(static_cast<uint8_t>(before - encoder.consumed));
+            pulses.time      = time;
+            encoder.consumed = before;
+
+            return pulses.pulses != 0;
+        }
+
+        private:
+        static constexpr uint8_t PRIMED_BIT = 0x80;
+
+        /// Lookup table used to convert two successive readings of A and B signals to pulses.
+        static constexpr int8_t LOOK_UP_TABLE[16] = {
+            0,     // 0000
+            1,     // 0001
+            -1,    // 0010
+            0,     // 0011
+            -1,    // 0100
+            0,     // 0101
+            0,     // 0110
+            1,     // 0111
+            1,     // 1000
+            0,     // 1001
+            0,     // 1010
+            -1,    // 1011
+            0,     // 1100
+            -1,    // 1101
+            1,     // 1110
+            0      // 1111
+        };
+
+        struct Encoder
+        {
+            size_t            inputA   = 0;
+            size_t            inputB   = 0;
+            uint8_t           history  = 0;    ///< ISR: last two readings of A and B signals.
+            uint8_t           produced = 0;    ///< ISR: running count of decoded pulses.
+            volatile uint32_t time     = 0;    ///< ISR: time of the last decoded pulse.
+            uint8_t           consumed = 0;    ///< Application: running count of pulses already read.
+        };
+
+        // targets without encoders still get single unused entry
+        Encoder _encoders[ENCODERS ? ENCODERS : 1] = {};
+    };
+}    // namespace board::detail::io::digital_in
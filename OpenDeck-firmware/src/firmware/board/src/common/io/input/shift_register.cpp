@@ -21,6 +21,7 @@ limitations under the License.
 
 #include "board/board.h"
 #include "internal.h"
+#include "common/io/input/frames.h"
 #include <target.h>
 
 #include "core/util/util.h"
@@ -36,10 +37,12 @@ using namespace board::detail::io::digital_in;
 
 namespace
 {
-    volatile Readings digitalInBuffer[PROJECT_TARGET_MAX_NR_OF_DIGITAL_INPUTS];
+    Frames<PROJECT_TARGET_MAX_NR_OF_DIGITAL_INPUTS, MAX_READING_COUNT> digitalInFrames;
 
     inline void storeDigitalIn()
     {
+        auto frame = digitalInFrames.back();
+
         CORE_MCU_IO_SET_LOW(PIN_PORT_SR_IN_CLK, PIN_INDEX_SR_IN_CLK);
         CORE_MCU_IO_SET_LOW(PIN_PORT_SR_IN_LATCH, PIN_INDEX_SR_IN_LATCH);
         io::spiWait();
@@ -55,17 +58,13 @@ namespace
                 CORE_MCU_IO_SET_LOW(PIN_PORT_SR_IN_CLK, PIN_INDEX_SR_IN_CLK);
                 io::spiWait();
 
-                digitalInBuffer[index].readings <<= 1;
-                digitalInBuffer[index].readings |= !CORE_MCU_IO_READ(PIN_PORT_SR_IN_DATA, PIN_INDEX_SR_IN_DATA);
-
-                if (++digitalInBuffer[index].count > MAX_READING_COUNT)
-                {
-                    digitalInBuffer[index].count = MAX_READING_COUNT;
-                }
+                frame->set(index, !CORE_MCU_IO_READ(PIN_PORT_SR_IN_DATA, PIN_INDEX_SR_IN_DATA));
 
                 CORE_MCU_IO_SET_HIGH(PIN_PORT_SR_IN_CLK, PIN_INDEX_SR_IN_CLK);
             }
         }
+
+        digitalInFrames.publish();
     }
 }    // namespace
 
@@ -101,14 +100,7 @@ namespace board::io::digital_in
 
         index = detail::map::BUTTON_INDEX(index);
 
-        CORE_MCU_ATOMIC_SECTION
-        {
-            readings.count               = digitalInBuffer[index].count;
-            readings.readings            = digitalInBuffer[index].readings;
-            digitalInBuffer[index].count = 0;
-        }
-
-        return readings.count > 0;
+        return digitalInFrames.state(index, readings);
     }
 
     size_t encoderFromInput(size_t index)
@@ -0,0 +1,178 @@
+/*
+
+Copyright Igor Petrovic
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*/
+
+#pragma once
+
+#include "board/board.h"
+
+#include <inttypes.h>
+#include <stddef.h>
+
+namespace board::detail::io::digital_out
+{
+    /// Binary code modulation of LED brightness.
+    /// Brightness of each LED is converted to a code in which bit n is shown for 2^n refresh
+    /// time units, so outputs are refreshed only once per code bit in each period instead of
+    /// once per time unit. Outputs are stored in one plane per code bit, in words of type T
+    /// (eg. shift register or port). Planes are written only in application context and only
+    /// read in ISR, so no atomic sections are needed - ISR can at worst show an LED with
+    /// partially written code for a single period.
+    /// Binary code is used only with fast soft PWM timer. When outputs are refreshed from main
+    /// timer, time unit is a whole millisecond and binary code would make the period too long:
+    /// each plane is then shown for a single time unit and LED is on in as many planes as its
+    /// brightness level, which keeps the period at one unit per level.
+    template<typename T, size_t WORDS>
+    class Bcm
+    {
+        public:
+        using ledBrightness_t = board::io::digital_out::ledBrightness_t;
+
+#ifdef BOARD_USE_FAST_SOFT_PWM_TIMER
+        static constexpr size_t BITS = 4;
+#else
+        static constexpr size_t BITS = static_cast<size_t>(ledBrightness_t::B100);
+#endif
+
+        /// Returns the code shown for provided brightness, rounded to the nearest one.
+        static constexpr uint8_t code(ledBrightness_t brightness)
+        {
+#ifdef BOARD_USE_FAST_SOFT_PWM_TIMER
+            constexpr uint8_t MAX_CODE  = (1 << BITS) - 1;
+            constexpr uint8_t MAX_LEVEL = static_cast<uint8_t>(ledBrightness_t::B100);
+
+            return ((static_cast<uint8_t>(brightness) * MAX_CODE) + (MAX_LEVEL / 2)) / MAX_LEVEL;
+#else
+            return (1 << static_cast<uint8_t>(brightness)) - 1;
+#endif
+        }
+
+        /// Returns the amount of refresh time units for which provided code bit is shown.
+        static constexpr uint8_t weight(size_t bit)
+        {
+#ifdef BOARD_USE_FAST_SOFT_PWM_TIMER
+            return 1 << bit;
+#else
+            return 1;
+#endif
+        }
+
+        /// Returns the amount of refresh time units in a period for which LED with provided brightness is on.
+        static constexpr uint8_t duty(ledBrightness_t brightness)
+        {
+            const auto CODE = code(brightness);
+            uint8_t    time = 0;
+
+            for (size_t bit = 0; bit < BITS; bit++)
+            {
+                if ((CODE >> bit) & 0x01)
+                {
+                    time += weight(bit);
+                }
+            }
+
+            return time;
+        }
+
+        /// Returns the amount of refresh time units in which all planes are shown once.
+        static constexpr uint8_t period()
+        {
+            return duty(ledBrightness_t::B100);
+        }
+
+        /// Application: collects the outputs of multiple LEDs so that each word of every plane
+        /// is written only once.
+        class Staging
+        {
+            public:
+            /// param [in]: bcm         Planes to which the outputs are written.
+            /// param [in]: activeHigh  Set to false if the LEDs are turned on with low output.
+            Staging(Bcm& bcm, bool activeHigh = true)
+                : _bcm(bcm)
+                , ACTIVE_HIGH(activeHigh)
+            {}
+
+            /// Stores the output to be written with the next call to write().
+            /// param [in]: word        Word in which the output is stored.
+            /// param [in]: bit         Bit of the output in word.
+            /// param [in]: brightness  Brightness of the LED.
+            void stage(size_t word, uint8_t bit, ledBrightness_t brightness)
+            {
+                const auto CODE = code(brightness);
+                const T    MASK = static_cast<T>(1) << bit;
+
+                _mask[word] |= MASK;
+
+                for (size_t plane = 0; plane < BITS; plane++)
+                {
+                    if (((CODE >> plane) & 0x01) == ACTIVE_HIGH)
+                    {
+                        _values[plane][word] |= MASK;
+                    }
+                    else
+                    {
+                        _values[plane][word] &= static_cast<T>(~MASK);
+                    }
+                }
+            }
+
+            /// Writes all staged outputs to the planes.
+            void write()
+            {
+                for (size_t word = 0; word < WORDS; word++)
+                {
+                    if (!_mask[word])
+                    {
+                        continue;
+                    }
+
+                    for (size_t plane = 0; plane < BITS; plane++)
+                    {
+                        _bcm._planes[plane][word] = static_cast<T>((_bcm._planes[plane][word] & static_cast<T>(~_mask[word])) | _values[plane][word]);
+                    }
+                }
+            }
+
+            private:
+            Bcm&       _bcm;
+            const bool ACTIVE_HIGH;
+            T          _mask[WORDS]         = {};
+            T          _values[BITS][WORDS] = {};
+        };
+
+        /// Application: writes the output to all planes.
+        /// param [in]: word        Word in which the output is stored.
+        /// param [in]: bit         Bit of the output in word.
+        /// param [in]: brightness  Brightness of the LED.
+        /// param [in]: activeHigh  Set to false if the LED is turned on with low output.
+        void write(size_t word, uint8_t bit, ledBrightness_t brightness, bool activeHigh = true)
+        {
+            Staging staging(*this, activeHigh);
+            staging.stage(word, bit, brightness);
+            staging.write();
+        }
+
+        /// ISR: returns the word of plane in which the code bit of outputs is stored.
+        T word(size_t plane, size_t word) const
+        {
+            return _planes[plane][word];
+        }
+
+        private:
+        volatile T _planes[BITS][WORDS] = {};
+    };
+}    // namespace board::detail::io::digital_out
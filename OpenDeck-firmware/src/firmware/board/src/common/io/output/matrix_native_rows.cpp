@@ -22,6 +22,7 @@ limitations under the License.
 #include "board/board.h"
 #include "helpers.h"
 #include "internal.h"
+#include "common/io/output/bcm.h"
 #include <target.h>
 
 #include "core/util/util.h"
@@ -32,17 +33,14 @@ using namespace board::detail::io::digital_out;
 
 namespace
 {
-    enum class switchState_t : uint8_t
-    {
-        NONE,
-        ROWS_OFF,
-        COLUMNS
-    };
+    using LedPlanes = Bcm<uint8_t, (PROJECT_TARGET_MAX_NR_OF_DIGITAL_OUTPUTS / 8) + 1>;
 
-    uint8_t          pwmCounter;
-    volatile uint8_t ledState[(PROJECT_TARGET_MAX_NR_OF_DIGITAL_OUTPUTS / 8) + 1][static_cast<uint8_t>(ledBrightness_t::B100)];
+    /// Code bit of LED brightness shown with the next refresh of active column.
+    uint8_t   plane;
+    LedPlanes ledPlanes;
 
-    switchState_t switchState;
+    /// Set once all the planes of active column are shown and the rows are turned off.
+    bool rowsOff;
 
     /// Holds value of currently active output matrix column.
     volatile uint8_t activeOutColumn;
@@ -59,6 +57,30 @@ namespace
         auto pin = map::LED_PIN(row);
         EXT_LED_ON(pin.port, pin.index);
     }
+
+    /// Collects LED states so that each byte of outputs is written only once.
+    class LedBanks
+    {
+        public:
+        void stage(size_t index, ledBrightness_t ledBrightness)
+        {
+            if (index >= PROJECT_TARGET_MAX_NR_OF_DIGITAL_OUTPUTS)
+            {
+                return;
+            }
+
+            index = detail::map::LED_INDEX(index);
+            _staging.stage(index / 8, index % 8, ledBrightness);
+        }
+
+        void write()
+        {
+            _staging.write();
+        }
+
+        private:
+        LedPlanes::Staging _staging = LedPlanes::Staging(ledPlanes);
+    };
 }    // namespace
 
 namespace board::detail::io::digital_out
@@ -98,37 +120,23 @@ namespace board::detail::io::digital_out
         }
     }
 
-    void update()
+    uint8_t update()
     {
-        switch (switchState)
-        {
-        case switchState_t::NONE:
+        if (plane >= LedPlanes::BITS)
         {
-            if (++pwmCounter >= (static_cast<uint8_t>(ledBrightness_t::B100) - 1))
+            if (!rowsOff)
             {
-                switchState = switchState_t::ROWS_OFF;
-            }
-        }
-        break;
+                for (uint8_t i = 0; i < PROJECT_TARGET_NR_OF_LED_ROWS; i++)
+                {
+                    ledRowOff(i);
+                }
 
-        case switchState_t::ROWS_OFF:
-        {
-            pwmCounter = 0;
+                rowsOff = true;
 
-            for (uint8_t i = 0; i < PROJECT_TARGET_NR_OF_LED_ROWS; i++)
-            {
-                ledRowOff(i);
+                // allow some settle time to avoid near LEDs being slighty lit
+                return 1;
             }
 
-            switchState = switchState_t::COLUMNS;
-
-            // allow some settle time to avoid near LEDs being slighty lit
-            return;
-        }
-        break;
-
-        case switchState_t::COLUMNS:
-        {
             if (++activeOutColumn >= PROJECT_TARGET_NR_OF_LED_COLUMNS)
             {
                 activeOutColumn = 0;
@@ -138,45 +146,23 @@ namespace board::detail::io::digital_out
             CORE_MCU_IO_SET_STATE(PIN_PORT_DEC_LM_A1, PIN_INDEX_DEC_LM_A1, core::util::BIT_READ(activeOutColumn, 1));
             CORE_MCU_IO_SET_STATE(PIN_PORT_DEC_LM_A2, PIN_INDEX_DEC_LM_A2, core::util::BIT_READ(activeOutColumn, 2));
 
-            switchState = switchState_t::NONE;
-        }
-        break;
+            plane   = 0;
+            rowsOff = false;
         }
 
         for (uint8_t i = 0; i < PROJECT_TARGET_NR_OF_LED_ROWS; i++)
         {
-            size_t  index      = activeOutColumn + i * PROJECT_TARGET_NR_OF_LED_COLUMNS;
-            uint8_t arrayIndex = index / 8;
-            uint8_t bit        = index - 8 * arrayIndex;
+            size_t index = activeOutColumn + i * PROJECT_TARGET_NR_OF_LED_COLUMNS;
 
-            core::util::BIT_READ(ledState[arrayIndex][pwmCounter], bit) ? ledRowOn(i) : ledRowOff(i);
+            core::util::BIT_READ(ledPlanes.word(plane, index / 8), index % 8) ? ledRowOn(i) : ledRowOff(i);
         }
+
+        return LedPlanes::weight(plane++);
     }
 }    // namespace board::detail::io::digital_out
 
 namespace board::io::digital_out
 {
-    void writeLedState(size_t index, ledBrightness_t ledBrightness)
-    {
-        if (index >= PROJECT_TARGET_MAX_NR_OF_DIGITAL_OUTPUTS)
-        {
-            return;
-        }
-
-        index = detail::map::LED_INDEX(index);
-
-        CORE_MCU_ATOMIC_SECTION
-        {
-            for (uint8_t i = 0; i < static_cast<int>(ledBrightness_t::B100); i++)
-            {
-                uint8_t arrayIndex = index / 8;
-                uint8_t bit        = index - 8 * arrayIndex;
-
-                core::util::BIT_WRITE(ledState[arrayIndex][i], bit, i < static_cast<int>(ledBrightness) ? 1 : 0);
-            }
-        }
-    }
-
     size_t rgbFromOutput(size_t index)
     {
         uint8_t row = index / PROJECT_TARGET_NR_OF_LED_COLUMNS;
@@ -218,5 +204,7 @@ namespace board::io::digital_out
     }
 }    // namespace board::io::digital_out
 
+#include "common.cpp.include"
+
 #endif
 #endif
\ No newline at end of file
@@ -65,6 +65,36 @@ namespace
             CORE_MCU_IO_SET_HIGH(PIN_PORT_MAX7219_LATCH, PIN_INDEX_MAX7219_LATCH);
         }
     }
+
+    /// Collects LED states so that each column is sent only once.
+    class LedBanks
+    {
+        public:
+        void stage(size_t index, ledBrightness_t ledBrightness)
+        {
+            index          = map::LED_INDEX(index);
+            uint8_t column = index % 8;
+            uint8_t row    = index / 8;
+
+            core::util::BIT_WRITE(columns[column], row, ledBrightness != ledBrightness_t::OFF);
+            core::util::BIT_WRITE(_changed, column, true);
+        }
+
+        void write()
+        {
+            // update only the changed columns
+            for (uint8_t column = 0; column < 8; column++)
+            {
+                if (core::util::BIT_READ(_changed, column))
+                {
+                    sendCommand(column + 1, columns[column]);
+                }
+            }
+        }
+
+        private:
+        uint8_t _changed = 0;
+    };
 }    // namespace
 
 namespace board::detail::io::digital_out
@@ -111,18 +141,6 @@ namespace board::detail::io::digital_out
 
 namespace board::io::digital_out
 {
-    void writeLedState(size_t index, ledBrightness_t ledBrightness)
-    {
-        index          = map::LED_INDEX(index);
-        uint8_t column = index % 8;
-        uint8_t row    = index / 8;
-
-        core::util::BIT_WRITE(columns[column], row, ledBrightness != ledBrightness_t::OFF);
-
-        // update only the changed column
-        sendCommand(column + 1, columns[column]);
-    }
-
     size_t rgbFromOutput(size_t index)
     {
         uint8_t row = index / 8;
@@ -164,5 +182,7 @@ namespace board::io::digital_out
     }
 }    // namespace board::io::digital_out
 
+#include "common.cpp.include"
+
 #endif
 #endif
\ No newline at end of file
@@ -22,6 +22,7 @@ limitations under the License.
 #include "board/board.h"
 #include "helpers.h"
 #include "internal.h"
+#include "common/io/output/bcm.h"
 #include <target.h>
 
 #include "core/util/util.h"
@@ -32,8 +33,41 @@ using namespace board::detail::io::digital_out;
 
 namespace
 {
-    uint8_t                    pwmCounter;
-    core::mcu::io::portWidth_t portState[PROJECT_TARGET_NR_OF_DIGITAL_OUTPUT_PORTS][static_cast<uint8_t>(ledBrightness_t::B100)];
+    using LedPlanes = Bcm<core::mcu::io::portWidth_t, PROJECT_TARGET_NR_OF_DIGITAL_OUTPUT_PORTS>;
+
+#ifndef PROJECT_TARGET_LEDS_EXT_INVERT
+    constexpr bool LED_ACTIVE_HIGH = true;
+#else
+    constexpr bool LED_ACTIVE_HIGH = false;
+#endif
+
+    /// Code bit of LED brightness shown with the next refresh.
+    uint8_t   plane;
+    LedPlanes ledPlanes;
+
+    /// Collects LED states so that each port is written only once.
+    class LedBanks
+    {
+        public:
+        void stage(size_t index, ledBrightness_t ledBrightness)
+        {
+            if (index >= PROJECT_TARGET_MAX_NR_OF_DIGITAL_OUTPUTS)
+            {
+                return;
+            }
+
+            index = map::LED_INDEX(index);
+            _staging.stage(map::LED_PORT_INDEX(index), map::LED_PIN_INDEX(index), ledBrightness);
+        }
+
+        void write()
+        {
+            _staging.write();
+        }
+
+        private:
+        LedPlanes::Staging _staging = LedPlanes::Staging(ledPlanes, LED_ACTIVE_HIGH);
+    };
 }    // namespace
 
 namespace board::detail::io::digital_out
@@ -53,56 +87,29 @@ namespace board::detail::io::digital_out
         }
     }
 
-    void update()
+    uint8_t update()
     {
+        const uint8_t SHOWN = plane;
+
         for (size_t port = 0; port < PROJECT_TARGET_NR_OF_DIGITAL_OUTPUT_PORTS; port++)
         {
             core::mcu::io::portWidth_t updatedPortState = CORE_MCU_IO_READ_OUT_PORT(map::DIGITAL_OUT_PORT(port));
             updatedPortState &= detail::map::DIGITAL_OUT_PORT_CLEAR_MASK(port);
-            updatedPortState |= portState[port][pwmCounter];
+            updatedPortState |= ledPlanes.word(SHOWN, port);
             CORE_MCU_IO_SET_PORT_STATE(detail::map::DIGITAL_OUT_PORT(port), updatedPortState);
         }
 
-        if (++pwmCounter >= static_cast<uint8_t>(ledBrightness_t::B100))
+        if (++plane >= LedPlanes::BITS)
         {
-            pwmCounter = 0;
+            plane = 0;
         }
+
+        return LedPlanes::weight(SHOWN);
     }
 }    // namespace board::detail::io::digital_out
 
 namespace board::io::digital_out
 {
-    void writeLedState(size_t index, ledBrightness_t ledBrightness)
-    {
-        if (index >= PROJECT_TARGET_MAX_NR_OF_DIGITAL_OUTPUTS)
-        {
-            return;
-        }
-
-        index = map::LED_INDEX(index);
-
-        CORE_MCU_ATOMIC_SECTION
-        {
-            for (uint8_t i = 0; i < static_cast<int>(ledBrightness_t::B100); i++)
-            {
-                core::util::BIT_WRITE(portState[map::LED_PORT_INDEX(index)][i], map::LED_PIN_INDEX(index), i < static_cast<int>(ledBrightness) ?
-#ifndef PROJECT_TARGET_LEDS_EXT_INVERT
-                                                                                                                                               1
-#else
-                                                                                                                                               0
-#endif
-                                                                                                                                               :
-#ifndef PROJECT_TARGET_LEDS_EXT_INVERT
-                                                                                                                                               0
-#else
-                                                                                                                                               1
-#endif
-
-                );
-            }
-        }
-    }
-
     size_t rgbFromOutput(size_t index)
     {
         uint8_t result = index / 3;
@@ -121,5 +128,7 @@ namespace board::io::digital_out
     }
 }    // namespace board::io::digital_out
 
+#include "common.cpp.include"
+
 #endif
 #endif
\ No newline at end of file
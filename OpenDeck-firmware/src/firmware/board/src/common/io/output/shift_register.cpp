@@ -22,6 +22,7 @@ limitations under the License.
 #include "board/board.h"
 #include "helpers.h"
 #include "internal.h"
+#include "common/io/output/bcm.h"
 #include <target.h>
 
 #include "core/util/util.h"
@@ -32,8 +33,35 @@ using namespace board::detail::io::digital_out;
 
 namespace
 {
-    uint8_t          pwmCounter;
-    volatile uint8_t ledState[(PROJECT_TARGET_MAX_NR_OF_DIGITAL_OUTPUTS / 8) + 1][static_cast<uint8_t>(ledBrightness_t::B100)];
+    using LedPlanes = Bcm<uint8_t, PROJECT_TARGET_NR_OF_OUT_SR>;
+
+    /// Code bit of LED brightness shown with the next refresh.
+    uint8_t   plane;
+    LedPlanes ledPlanes;
+
+    /// Collects LED states so that each shift register is written only once.
+    class LedBanks
+    {
+        public:
+        void stage(size_t index, ledBrightness_t ledBrightness)
+        {
+            if (index >= PROJECT_TARGET_MAX_NR_OF_DIGITAL_OUTPUTS)
+            {
+                return;
+            }
+
+            index = map::LED_INDEX(index);
+            _staging.stage(index / 8, index % 8, ledBrightness);
+        }
+
+        void write()
+        {
+            _staging.write();
+        }
+
+        private:
+        LedPlanes::Staging _staging = LedPlanes::Staging(ledPlanes);
+    };
 }    // namespace
 
 namespace board::detail::io::digital_out
@@ -65,22 +93,22 @@ namespace board::detail::io::digital_out
         // this will init all outputs to their default state (off)
         update();
 
-        pwmCounter = 0;
+        plane = 0;
     }
 
-    void update()
+    uint8_t update()
     {
+        const uint8_t SHOWN = plane;
+
         CORE_MCU_IO_SET_LOW(PIN_PORT_SR_OUT_LATCH, PIN_INDEX_SR_OUT_LATCH);
 
         for (uint8_t shiftRegister = 0; shiftRegister < PROJECT_TARGET_NR_OF_OUT_SR; shiftRegister++)
         {
+            const uint8_t STATE = ledPlanes.word(SHOWN, shiftRegister);
+
             for (uint8_t output = 0; output < 8; output++)
             {
-                size_t  index      = output + shiftRegister * 8;
-                uint8_t arrayIndex = index / 8;
-                uint8_t bit        = index - 8 * arrayIndex;
-
-                core::util::BIT_READ(ledState[arrayIndex][pwmCounter], bit)
+                core::util::BIT_READ(STATE, output)
                     ? EXT_LED_ON(PIN_PORT_SR_OUT_DATA, PIN_INDEX_SR_OUT_DATA)
                     : EXT_LED_OFF(PIN_PORT_SR_OUT_DATA, PIN_INDEX_SR_OUT_DATA);
 
@@ -92,36 +120,17 @@ namespace board::detail::io::digital_out
 
         CORE_MCU_IO_SET_HIGH(PIN_PORT_SR_OUT_LATCH, PIN_INDEX_SR_OUT_LATCH);
 
-        if (++pwmCounter >= static_cast<uint8_t>(ledBrightness_t::B100))
+        if (++plane >= LedPlanes::BITS)
         {
-            pwmCounter = 0;
+            plane = 0;
         }
+
+        return LedPlanes::weight(SHOWN);
     }
 }    // namespace board::detail::io::digital_out
 
 namespace board::io::digital_out
 {
-    void writeLedState(size_t index, ledBrightness_t ledBrightness)
-    {
-        if (index >= PROJECT_TARGET_MAX_NR_OF_DIGITAL_OUTPUTS)
-        {
-            return;
-        }
-
-        index = map::LED_INDEX(index);
-
-        CORE_MCU_ATOMIC_SECTION
-        {
-            for (uint8_t i = 0; i < static_cast<int>(ledBrightness_t::B100); i++)
-            {
-                uint8_t arrayIndex = index / 8;
-                uint8_t bit        = index - 8 * arrayIndex;
-
-                core::util::BIT_WRITE(ledState[arrayIndex][i], bit, i < static_cast<int>(ledBrightness) ? 1 : 0);
-            }
-        }
-    }
-
     size_t rgbFromOutput(size_t index)
     {
         uint8_t result = index / 3;
@@ -140,5 +149,7 @@ namespace board::io::digital_out
     }
 }    // namespace board::io::digital_out
 
+#include "common.cpp.include"
+
 #endif
 #endif
\ No newline at end of file
@@ -0,0 +1,88 @@
+/*
+
+Copyright Igor Petrovic
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*/
+
+#pragma once
+
+#include "board/spsc.h"
+
+#include <inttypes.h>
+#include <stddef.h>
+
+// Primitives used to hand off the data from the code which reads the inputs (ISR, producer)
+// to the application (consumer) without disabling the interrupts. Both assume single
+// producer and single consumer. Counters are single bytes by default so that they are
+// read and written atomically on every supported MCU.
+
+namespace board::detail::io
+{
+    using ::board::util::SpscRing;
+
+    /// Latest complete frame of SIZE values. Producer fills the back buffer and publishes it
+    /// as a whole. Consumer always reads from the last published frame: if the producer
+    /// publishes while the consumer is reading, the read is repeated, so the consumer can't
+    /// see a value from a partially written frame.
+    /// Torn read would go unnoticed only if exact multiple of 2^(8 * sizeof(Sequence)) frames
+    /// were published during a single read.
+    template<typename T, size_t SIZE, typename Sequence = uint8_t>
+    class Snapshot
+    {
+        public:
+        /// Producer: returns the frame which is being filled.
+        T* back()
+        {
+            return _frames[(__atomic_load_n(&_sequence, __ATOMIC_RELAXED) + 1) & 0x01];
+        }
+
+        /// Producer: makes the frame returned by back() the latest one.
+        /// Frame returned by back() afterwards is the one published before.
+        void publish()
+        {
+            __atomic_store_n(&_sequence, static_cast<Sequence>(_sequence + 1), __ATOMIC_RELEASE);
+
+            // writes to the next frame must not be visible before the new sequence
+            __atomic_thread_fence(__ATOMIC_RELEASE);
+        }
+
+        /// Consumer: reads single value from the latest published frame.
+        /// param [in]: index   Index of the value in frame.
+        /// param [out]: value  Read value.
+        /// returns: Sequence number of the frame from which the value was read. Increases by one
+        ///          with each published frame, starting from 0 (nothing published yet).
+        Sequence read(size_t index, T& value) const
+        {
+            Sequence before = 0;
+            Sequence after  = 0;
+
+            do
+            {
+                before = __atomic_load_n(&_sequence, __ATOMIC_ACQUIRE);
+                value  = _frames[before & 0x01][index];
+
+                __atomic_thread_fence(__ATOMIC_ACQUIRE);
+
+                after = __atomic_load_n(&_sequence, __ATOMIC_RELAXED);
+            } while (before != after);
+
+            return before;
+        }
+
+        private:
+        T        _frames[2][SIZE] = {};
+        Sequence _sequence        = 0;
+    };
+}    // namespace board::detail::io
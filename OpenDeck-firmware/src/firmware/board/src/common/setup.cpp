@@ -26,10 +26,57 @@ namespace
     constexpr uint32_t MAIN_TIMER_TIMEOUT_US = 1000;
 #ifdef OPENDECK_FW_APP
 #if defined(BOARD_USE_FAST_SOFT_PWM_TIMER) && defined(PROJECT_TARGET_SUPPORT_SOFT_PWM)
-    constexpr uint32_t SOFT_PWM_TIMER_TIMEOUT_US = 200;
+    /// Shortest time for which the state of digital outputs is shown. Timer runs with this period
+    /// and outputs are refreshed once the amount of periods they requested has passed, so that the
+    /// timer doesn't need to be reprogrammed from its own interrupt.
+    constexpr uint32_t SOFT_PWM_TIMER_TIMEOUT_US = 50;
+
+    size_t pwmTimerIndex;
+
+    /// Soft PWM timer ticks left until the digital outputs are refreshed again.
+    uint8_t pwmTicks = 1;
+#elif !defined(BOARD_USE_FAST_SOFT_PWM_TIMER) && (PROJECT_TARGET_MAX_NR_OF_DIGITAL_OUTPUTS > 0)
+    /// Main timer ticks left until the digital outputs are refreshed again.
+    uint8_t outputTicks = 1;
 #endif
 #endif
 
+#ifdef PROJECT_TARGET_LOW_POWER
+    /// Inputs are scanned once in this many milliseconds while idle.
+    constexpr uint32_t IDLE_SCAN_PERIOD_MS = 8;
+
+#if (PROJECT_TARGET_MAX_NR_OF_DIGITAL_OUTPUTS > 0) && !defined(BOARD_USE_FAST_SOFT_PWM_TIMER)
+    // outputs are refreshed from main timer: keep its rate and skip the scans instead
+    constexpr bool IDLE_SLOW_TIMER = false;
+#else
+    // nothing else needs main timer while idle: slow it down so that MCU wakes up less often
+    constexpr bool IDLE_SLOW_TIMER = true;
+#endif
+
+    size_t                   mainTimerIndex;
+    board::power::scanRate_t currentScanRate;
+    volatile uint32_t        msPerTick = 1;
+    volatile uint32_t        msPerScan = 1;
+    uint32_t                 msSinceScan;
+
+    /// Called from main timer: returns true if inputs should be scanned in this tick.
+    bool scanDue()
+    {
+        msSinceScan += msPerTick;
+
+        if (msSinceScan < msPerScan)
+        {
+            return false;
+        }
+
+        msSinceScan = 0;
+        return true;
+    }
+#endif
+
+    /// Time in microseconds counted with main timer ticks.
+    uint32_t scanTimeUs;
+
     bool usbInitialized;
 }    // namespace
 
@@ -40,16 +87,41 @@ namespace board
 #if defined(OPENDECK_FW_APP)
         detail::setup::application();
 
+#ifndef PROJECT_TARGET_LOW_POWER
         size_t mainTimerIndex = 0;
+#endif
 
         core::mcu::timers::allocate(mainTimerIndex, []()
                                     {
+#ifdef PROJECT_TARGET_LOW_POWER
+                                        scanTimeUs += msPerTick * MAIN_TIMER_TIMEOUT_US;
+
+                                        // indicator timeouts are counted in milliseconds
+                                        for (uint32_t i = 0; i < msPerTick; i++)
+                                        {
+                                            detail::io::indicators::update();
+                                        }
+#else
+                                        scanTimeUs += MAIN_TIMER_TIMEOUT_US;
+
                                         detail::io::indicators::update();
+#endif
 #ifndef PROJECT_TARGET_USB_OVER_SERIAL_HOST
+#ifdef PROJECT_TARGET_LOW_POWER
+                                        if (scanDue())
+                                        {
+                                            detail::io::digital_in::update();
+                                            detail::io::analog::resume();
+                                        }
+#else
                                         detail::io::digital_in::update();
+#endif
 #ifndef BOARD_USE_FAST_SOFT_PWM_TIMER
 #if PROJECT_TARGET_MAX_NR_OF_DIGITAL_OUTPUTS > 0
-                                        detail::io::digital_out::update();
+                                        if (!--outputTicks)
+                                        {
+                                            outputTicks = detail::io::digital_out::update();
+                                        }
 #endif
 #endif
 #endif
@@ -59,14 +131,15 @@ namespace board
         core::mcu::timers::start(mainTimerIndex);
 
 #if defined(BOARD_USE_FAST_SOFT_PWM_TIMER) && defined(PROJECT_TARGET_SUPPORT_SOFT_PWM)
-        size_t pwmTimerIndex = 0;
-
         core::mcu::timers::allocate(pwmTimerIndex, []()
                                     {
 #ifdef OPENDECK_FW_APP
 #ifndef PROJECT_TARGET_USB_OVER_SERIAL_HOST
 #if PROJECT_TARGET_MAX_NR_OF_DIGITAL_OUTPUTS > 0
-                                        detail::io::digital_out::update();
+                                        if (!--pwmTicks)
+                                        {
+                                            pwmTicks = detail::io::digital_out::update();
+                                        }
 #endif
 #endif
 #endif
@@ -90,6 +163,51 @@ namespace board
 #endif
     }
 
+#ifdef PROJECT_TARGET_LOW_POWER
+    namespace power
+    {
+        void setScanRate(scanRate_t rate)
+        {
+            if (rate == currentScanRate)
+            {
+                return;
+            }
+
+            currentScanRate = rate;
+
+            const bool     IDLE   = rate == scanRate_t::IDLE;
+            const uint32_t PERIOD = IDLE ? IDLE_SCAN_PERIOD_MS : 1;
+
+            // analog frames are started from main timer as well while idle
+            detail::io::analog::pace(IDLE);
+
+            if (IDLE_SLOW_TIMER)
+            {
+                msPerTick = PERIOD;
+                msPerScan = PERIOD;
+                core::mcu::timers::setPeriod(mainTimerIndex, PERIOD * MAIN_TIMER_TIMEOUT_US);
+            }
+            else
+            {
+                msPerScan = PERIOD;
+            }
+        }
+
+        scanRate_t scanRate()
+        {
+            return currentScanRate;
+        }
+    }    // namespace power
+#endif
+
+    namespace detail::io::digital_in
+    {
+        uint32_t scanTime()
+        {
+            return scanTimeUs;
+        }
+    }    // namespace detail::io::digital_in
+
     namespace usb
     {
         initStatus_t init()
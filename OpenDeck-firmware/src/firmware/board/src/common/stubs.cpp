@@ -37,6 +37,16 @@ namespace board
                 return false;
             }
 
+            __attribute__((weak)) bool changes(uint32_t* changed, uint32_t* states, size_t words)
+            {
+                return false;
+            }
+
+            __attribute__((weak)) bool encoderPulses(size_t index, EncoderPulses& pulses)
+            {
+                return false;
+            }
+
             __attribute__((weak)) size_t encoderFromInput(size_t index)
             {
                 return 0;
@@ -54,6 +64,10 @@ namespace board
             {
             }
 
+            __attribute__((weak)) void writeLedStates(const uint32_t* changed, const uint32_t* planes, size_t words)
+            {
+            }
+
             __attribute__((weak)) size_t rgbFromOutput(size_t index)
             {
                 return 0;
@@ -116,8 +130,9 @@ namespace board
             {
             }
 
-            __attribute__((weak)) void update()
+            __attribute__((weak)) uint8_t update()
             {
+                return 1;
             }
         }    // namespace digital_out
 
@@ -126,6 +141,19 @@ namespace board
             __attribute__((weak)) void init()
             {
             }
+
+            __attribute__((weak)) bool nextFrame()
+            {
+                return true;
+            }
+
+            __attribute__((weak)) void pace(bool state)
+            {
+            }
+
+            __attribute__((weak)) void resume()
+            {
+            }
         }    // namespace analog
 
         namespace indicators
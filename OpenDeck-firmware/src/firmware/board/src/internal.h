@@ -96,24 +96,38 @@ namespace board::detail
 
             /// Removes all readings from digital inputs.
             void flush();
+
+            /// Returns time in microseconds at which the current scan of digital inputs has started.
+            /// Advances with each tick of the main timer, so it is valid only from within update().
+            uint32_t scanTime();
         }    // namespace digital_in
 
         namespace digital_out
         {
             void init();
 
-            /// Checks if digital outputs need to be updated.
-            void update();
+            /// Refreshes the digital outputs.
+            /// returns: Amount of refresh time units after which the outputs should be refreshed again.
+            ///          Time unit is a single period of the timer from which the outputs are refreshed.
+            uint8_t update();
         }    // namespace digital_out
 
         namespace analog
         {
-            /// Used to indicate that the new analog reading has been made
-            constexpr inline uint16_t ADC_NEW_READING_FLAG = 0x8000;
-
             constexpr inline uint8_t ISR_PRIORITY = 5;
 
             void init();
+
+            /// Called from ADC ISR once all inputs are read.
+            /// returns: True if the next frame should be started right away. While paced, conversions
+            ///          are stopped after each frame and the next one is started with resume().
+            bool nextFrame();
+
+            /// Stops or continues the conversions after each frame.
+            void pace(bool state);
+
+            /// Starts the next frame if conversions were stopped after the last one.
+            void resume();
         }    // namespace analog
 
         namespace indicators
@@ -124,6 +138,7 @@ namespace board::detail
             void update();
 
             /// Flashes integrated LEDs on board on startup to indicate that application is about to be loaded.
+            /// Returns immediately: flashing is done from update() while application is already running.
             void indicateApplicationLoad();
 
             /// Flashes integrated LEDs on board on startup to indicate that bootloader is about to be loaded.
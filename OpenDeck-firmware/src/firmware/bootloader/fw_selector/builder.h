@@ -18,4 +18,8 @@ limitations under the License.
 
 #pragma once
 
-#include "bootloader/fw_selector/builder_hw.h"
\ No newline at end of file
+#ifdef OPENDECK_TEST
+#include "bootloader/fw_selector/builder_test.h"
+#else
+#include "bootloader/fw_selector/builder_hw.h"
+#endif
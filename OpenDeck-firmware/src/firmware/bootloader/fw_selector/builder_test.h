@@ -0,0 +1,39 @@
+/*
+
+Copyright Igor Petrovic
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*/
+
+#pragma once
+
+#include "fw_selector.h"
+#include "hwa_test.h"
+
+namespace fw_selector
+{
+    class Builder
+    {
+        public:
+        Builder() = default;
+
+        FwSelector& instance()
+        {
+            return _instance;
+        }
+
+        HwaTest    _hwa;
+        FwSelector _instance = FwSelector(_hwa);
+    };
+}    // namespace fw_selector
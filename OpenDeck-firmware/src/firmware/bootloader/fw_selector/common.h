@@ -30,4 +30,8 @@ namespace fw_selector
         APPLICATION = 0xFFFFFFFF,
         BOOTLOADER  = 0x47474747
     };
+
+    /// Combined with the application boundary and CRC into the value stored once the
+    /// application is verified. Application isn't verified again while the stored value matches.
+    constexpr inline uint32_t APP_VERIFIED_MAGIC = 0x56455249;
 }    // namespace fw_selector
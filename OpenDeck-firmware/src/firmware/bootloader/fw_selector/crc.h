@@ -0,0 +1,118 @@
+/*
+
+Copyright Igor Petrovic
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*/
+
+#pragma once
+
+#include <array>
+#include <inttypes.h>
+#include <stddef.h>
+#include <string.h>
+
+namespace fw_selector
+{
+    namespace detail
+    {
+        constexpr size_t CRC16_XMODEM_SLICES = 4;
+
+        using crc16Table_t = std::array<std::array<uint16_t, 256>, CRC16_XMODEM_SLICES>;
+
+        constexpr crc16Table_t generateCrc16XmodemTable()
+        {
+            crc16Table_t table = {};
+
+            for (size_t i = 0; i < 256; i++)
+            {
+                uint16_t crc = static_cast<uint16_t>(i << 8);
+
+                for (size_t bit = 0; bit < 8; bit++)
+                {
+                    crc = (crc & 0x8000) ? static_cast<uint16_t>((crc << 1) ^ 0x1021) : static_cast<uint16_t>(crc << 1);
+                }
+
+                table[0][i] = crc;
+            }
+
+            // each next table gives the CRC of the byte followed by one more zero byte
+            for (size_t slice = 1; slice < CRC16_XMODEM_SLICES; slice++)
+            {
+                for (size_t i = 0; i < 256; i++)
+                {
+                    auto previous   = table[slice - 1][i];
+                    table[slice][i] = static_cast<uint16_t>((previous << 8) ^ table[0][previous >> 8]);
+                }
+            }
+
+            return table;
+        }
+
+        constexpr inline crc16Table_t CRC16_XMODEM_TABLE = generateCrc16XmodemTable();
+    }    // namespace detail
+
+    /// CRC16 XMODEM (polynomial 0x1021, initial value 0x0000) calculated with slice-by-4
+    /// lookup tables: four bytes are processed per step using single aligned word read.
+    /// Yields the same result as core::util::XMODEM applied on each byte.
+    class Crc16Xmodem
+    {
+        public:
+        /// Updates the CRC with the specified amount of bytes.
+        /// param [in]: crc     Previously calculated CRC (0 for the first call).
+        /// param [in]: data    Pointer to the data.
+        /// param [in]: size    Amount of bytes to process.
+        /// returns: Updated CRC.
+        static uint16_t update(uint16_t crc, const uint8_t* data, size_t size)
+        {
+            // process single bytes until the data is word-aligned
+            while (size && (reinterpret_cast<uintptr_t>(data) & (sizeof(uint32_t) - 1)))
+            {
+                crc = updateByte(crc, *data++);
+                size--;
+            }
+
+            for (; size >= sizeof(uint32_t); size -= sizeof(uint32_t))
+            {
+                uint32_t word;
+                memcpy(&word, data, sizeof(word));
+                data += sizeof(word);
+
+#if __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+                word = __builtin_bswap32(word);
+#endif
+
+                crc = TABLE[3][((crc >> 8) ^ word) & 0xFF] ^
+                      TABLE[2][((crc & 0xFF) ^ (word >> 8)) & 0xFF] ^
+                      TABLE[1][(word >> 16) & 0xFF] ^
+                      TABLE[0][word >> 24];
+            }
+
+            while (size--)
+            {
+                crc = updateByte(crc, *data++);
+            }
+
+            return crc;
+        }
+
+        private:
+        static constexpr auto& TABLE = detail::CRC16_XMODEM_TABLE;
+
+        static uint16_t updateByte(uint16_t crc, uint8_t data)
+        {
+            return static_cast<uint16_t>((crc << 8) ^ TABLE[0][(crc >> 8) ^ data]);
+        }
+    };
+}    // namespace fw_selector
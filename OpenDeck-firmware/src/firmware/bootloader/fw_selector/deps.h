@@ -25,11 +25,14 @@ namespace fw_selector
     class Hwa
     {
         public:
-        virtual uint32_t magicBootValue()                                 = 0;
-        virtual void     setMagicBootValue(uint32_t value)                = 0;
-        virtual void     load(fwType_t fwType)                            = 0;
-        virtual void     appAddrBoundary(uint32_t& first, uint32_t& last) = 0;
-        virtual bool     isHwTriggerActive()                              = 0;
-        virtual uint8_t  readFlash(uint32_t address)                      = 0;
+        virtual uint32_t       magicBootValue()                                 = 0;
+        virtual void           setMagicBootValue(uint32_t value)                = 0;
+        virtual void           load(fwType_t fwType)                            = 0;
+        virtual void           appAddrBoundary(uint32_t& first, uint32_t& last) = 0;
+        virtual bool           isHwTriggerActive()                              = 0;
+        virtual uint8_t        readFlash(uint32_t address)                      = 0;
+        virtual const uint8_t* flashData(uint32_t address)                      = 0;
+        virtual uint32_t       appVerificationMarker()                          = 0;
+        virtual void           setAppVerificationMarker(uint32_t value)         = 0;
     };
 }    // namespace fw_selector
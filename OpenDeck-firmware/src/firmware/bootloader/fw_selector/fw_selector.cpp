@@ -17,6 +17,7 @@ limitations under the License.
 */
 
 #include "fw_selector.h"
+#include "crc.h"
 
 #include "core/util/util.h"
 
@@ -84,14 +85,41 @@ bool FwSelector::isAppValid()
     crcActual <<= 8;
     crcActual |= _hwa.readFlash(lastFwAddr);
 
-    volatile uint16_t crcCalculated = 0x0000;
+    // application was already verified and hasn't been updated since
+    const uint32_t MARKER = APP_VERIFIED_MAGIC ^ lastFwAddr ^ (static_cast<uint32_t>(crcActual) << 16);
 
-    for (uint32_t i = firstFwAddr; i < lastFwAddr; i++)
+    if (_hwa.appVerificationMarker() == MARKER)
     {
-        uint8_t data  = _hwa.readFlash(i);
-        crcCalculated = core::util::XMODEM(crcCalculated, data);
+        return true;
+    }
+
+    if (appCrc(firstFwAddr, lastFwAddr) != crcActual)
+    {
+        _hwa.setAppVerificationMarker(0);
+        return false;
     }
 
-    return (crcCalculated == crcActual);
+    _hwa.setAppVerificationMarker(MARKER);
+    return true;
 #endif
-}
\ No newline at end of file
+}
+
+uint16_t FwSelector::appCrc(uint32_t firstFwAddr, uint32_t lastFwAddr)
+{
+    auto data = _hwa.flashData(firstFwAddr);
+
+    if (data != nullptr)
+    {
+        return Crc16Xmodem::update(0x0000, data, lastFwAddr - firstFwAddr);
+    }
+
+    uint16_t crc = 0x0000;
+
+    for (uint32_t i = firstFwAddr; i < lastFwAddr; i++)
+    {
+        uint8_t value = _hwa.readFlash(i);
+        crc           = core::util::XMODEM(crc, value);
+    }
+
+    return crc;
+}
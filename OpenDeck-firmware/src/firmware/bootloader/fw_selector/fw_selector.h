@@ -44,6 +44,9 @@ namespace fw_selector
         /// Verifies if the programmed flash is valid.
         bool isAppValid();
 
+        /// Calculates CRC of the application, reading the flash directly if possible.
+        uint16_t appCrc(uint32_t firstFwAddr, uint32_t lastFwAddr);
+
         /// Reads the state of the button responsible for hardware bootloader entry.
         /// Returns true if pressed, false otherwise. If bootloader button doesn't exist,
         /// function will return false.
@@ -69,5 +69,20 @@ namespace fw_selector
         {
             return board::bootloader::readFlash(address);
         }
+
+        const uint8_t* flashData(uint32_t address) override
+        {
+            return board::bootloader::flashData(address);
+        }
+
+        uint32_t appVerificationMarker() override
+        {
+            return board::bootloader::appVerificationMarker();
+        }
+
+        void setAppVerificationMarker(uint32_t value) override
+        {
+            board::bootloader::setAppVerificationMarker(value);
+        }
     };
 }    // namespace fw_selector
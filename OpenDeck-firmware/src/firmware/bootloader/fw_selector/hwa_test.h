@@ -0,0 +1,87 @@
+/*
+
+Copyright Igor Petrovic
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*/
+
+#pragma once
+
+#include "deps.h"
+
+#include <vector>
+
+namespace fw_selector
+{
+    /// Application image is stored in _flash: first address is 0, last one is stored
+    /// in _lastFwAddr and CRC is stored after it.
+    class HwaTest : public Hwa
+    {
+        public:
+        uint32_t magicBootValue() override
+        {
+            return _magicBootValue;
+        }
+
+        void setMagicBootValue(uint32_t value) override
+        {
+            _magicBootValue = value;
+        }
+
+        void load(fwType_t fwType) override
+        {
+            _loaded = fwType;
+        }
+
+        void appAddrBoundary(uint32_t& first, uint32_t& last) override
+        {
+            first = 0;
+            last  = _lastFwAddr;
+        }
+
+        bool isHwTriggerActive() override
+        {
+            return false;
+        }
+
+        uint8_t readFlash(uint32_t address) override
+        {
+            _flashReads++;
+            return address < _flash.size() ? _flash.at(address) : 0xFF;
+        }
+
+        const uint8_t* flashData(uint32_t address) override
+        {
+            return _mapped ? &_flash.at(address) : nullptr;
+        }
+
+        uint32_t appVerificationMarker() override
+        {
+            return _appVerificationMarker;
+        }
+
+        void setAppVerificationMarker(uint32_t value) override
+        {
+            _appVerificationMarker = value;
+        }
+
+        std::vector<uint8_t> _flash                 = {};
+        uint32_t             _lastFwAddr            = 0;
+        bool                 _mapped                = true;
+        uint32_t             _magicBootValue        = static_cast<uint32_t>(fwType_t::APPLICATION);
+        uint32_t             _appVerificationMarker = 0;
+        fwType_t             _loaded                = fwType_t::BOOTLOADER;
+        size_t               _flashReads            = 0;
+    };
+}    // namespace fw_selector
@@ -53,6 +53,8 @@ namespace updater
 
         void onFirmwareUpdateStart() override
         {
+            // application is about to change: verify it again on next boot
+            board::bootloader::setAppVerificationMarker(0);
             board::io::indicators::indicateFirmwareUpdateStart();
         }
     };
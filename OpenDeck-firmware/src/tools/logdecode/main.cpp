@@ -0,0 +1,404 @@
+/*
+
+Copyright Igor Petrovic
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*/
+
+#include "application/util/logger/binary_format.h"
+#include "application/system/custom_ids.h"
+
+#include <iostream>
+#include <fstream>
+#include <filesystem>
+#include <regex>
+#include <unordered_map>
+#include <vector>
+#include <string>
+#include <cstring>
+#include <cstdio>
+#include <iterator>
+
+namespace
+{
+    using namespace util::binary_log;
+
+    /// Offset of custom message ID in SysEx message: F0, 3 manufacturer ID bytes, status, part.
+    constexpr size_t SYSEX_CUSTOM_ID_OFFSET = 6;
+
+    struct Argument
+    {
+        argType_t   type   = argType_t::AMOUNT;
+        uint64_t    value  = 0;
+        std::string string = {};
+    };
+
+    std::string unescape(const std::string& literal)
+    {
+        std::string result = {};
+
+        for (size_t i = 0; i < literal.size(); i++)
+        {
+            if ((literal[i] != '\\') || ((i + 1) >= literal.size()))
+            {
+                result += literal[i];
+                continue;
+            }
+
+            switch (literal[++i])
+            {
+            case 'n':
+                result += '\n';
+                break;
+
+            case 't':
+                result += '\t';
+                break;
+
+            case 'r':
+                result += '\r';
+                break;
+
+            default:
+                result += literal[i];
+                break;
+            }
+        }
+
+        return result;
+    }
+
+    /// Collects all format strings used with LOG_INF, LOG_WRN and LOG_ERR macros.
+    std::unordered_map<uint32_t, std::string> collectFormats(const std::filesystem::path& root)
+    {
+        // format string can be split into several adjacent literals
+        static const std::regex LOG_REGEX(R"re(LOG_(?:INF|WRN|ERR)\s*\(\s*((?:"(?:[^"\\]|\\.)*"\s*)+))re");
+        static const std::regex LITERAL_REGEX(R"re("((?:[^"\\]|\\.)*)")re");
+
+        std::unordered_map<uint32_t, std::string> formats = {};
+
+        for (const auto& entry : std::filesystem::recursive_directory_iterator(root))
+        {
+            if (!entry.is_regular_file())
+            {
+                continue;
+            }
+
+            const auto EXTENSION = entry.path().extension().string();
+
+            if ((EXTENSION != ".cpp") && (EXTENSION != ".h") && (EXTENSION != ".include"))
+            {
+                continue;
+            }
+
+            std::ifstream stream(entry.path());
+            std::string   contents((std::istreambuf_iterator<char>(stream)), std::istreambuf_iterator<char>());
+
+            for (std::sregex_iterator it(contents.begin(), contents.end(), LOG_REGEX), end; it != end; ++it)
+            {
+                std::string literals = (*it)[1].str();
+                std::string format   = {};
+
+                for (std::sregex_iterator lit(literals.begin(), literals.end(), LITERAL_REGEX), litEnd; lit != litEnd; ++lit)
+                {
+                    format += unescape((*lit)[1].str());
+                }
+
+                formats[hash(format.c_str())] = format;
+            }
+        }
+
+        return formats;
+    }
+
+    std::string formatArgument(const std::string& spec, const Argument* argument)
+    {
+        if (argument == nullptr)
+        {
+            return "<?>";
+        }
+
+        // drop length modifiers from the spec and use the widest ones instead
+        std::string base = {};
+
+        for (char c : spec.substr(0, spec.size() - 1))
+        {
+            if (std::strchr("hlLqjzt", c) == nullptr)
+            {
+                base += c;
+            }
+        }
+
+        const char CONVERSION = spec.back();
+        char       buffer[128];
+
+        switch (CONVERSION)
+        {
+        case 's':
+        {
+            std::snprintf(buffer, sizeof(buffer), (base + "s").c_str(), argument->string.c_str());
+        }
+        break;
+
+        case 'f':
+        case 'F':
+        case 'e':
+        case 'E':
+        case 'g':
+        case 'G':
+        {
+            float value = 0;
+            auto  raw   = static_cast<uint32_t>(argument->value);
+
+            std::memcpy(&value, &raw, sizeof(value));
+            std::snprintf(buffer, sizeof(buffer), (base + CONVERSION).c_str(), static_cast<double>(value));
+        }
+        break;
+
+        case 'c':
+        {
+            std::snprintf(buffer, sizeof(buffer), (base + "c").c_str(), static_cast<int>(argument->value));
+        }
+        break;
+
+        case 'd':
+        case 'i':
+        {
+            int64_t value = static_cast<int64_t>(argument->value);
+
+            if (argument->type == argType_t::INT32)
+            {
+                value = static_cast<int32_t>(argument->value);
+            }
+
+            std::snprintf(buffer, sizeof(buffer), (base + "lld").c_str(), static_cast<long long>(value));
+        }
+        break;
+
+        default:
+        {
+            // u, x, X, o, p
+            const char TYPE = (CONVERSION == 'p') ? 'x' : CONVERSION;
+            std::snprintf(buffer, sizeof(buffer), (base + "ll" + TYPE).c_str(), static_cast<unsigned long long>(argument->value));
+        }
+        break;
+        }
+
+        return buffer;
+    }
+
+    std::string format(const std::string& pattern, const std::vector<Argument>& arguments)
+    {
+        static const std::regex SPEC_REGEX(R"(%[-+ #0]*[0-9*]*(?:\.[0-9*]+)?(?:hh|h|ll|l|L|q|j|z|t)?[diouxXeEfFgGcsp%])");
+
+        std::string result   = {};
+        size_t      argIndex = 0;
+        auto        last     = pattern.cbegin();
+
+        for (std::sregex_iterator it(pattern.begin(), pattern.end(), SPEC_REGEX), end; it != end; ++it)
+        {
+            result.append(last, pattern.cbegin() + it->position());
+            last = pattern.cbegin() + it->position() + it->length();
+
+            const auto SPEC = it->str();
+
+            if (SPEC == "%%")
+            {
+                result += '%';
+                continue;
+            }
+
+            result += formatArgument(SPEC, argIndex < arguments.size() ? &arguments.at(argIndex) : nullptr);
+            argIndex++;
+        }
+
+        result.append(last, pattern.cend());
+        return result;
+    }
+
+    /// Decodes records from the stream. Partial record at the end of the stream is ignored.
+    void decode(const std::vector<uint8_t>& stream, const std::unordered_map<uint32_t, std::string>& formats)
+    {
+        static const char* LEVEL[] = {
+            "INF",
+            "WRN",
+            "ERR",
+        };
+
+        size_t offset = 0;
+
+        while ((offset + HEADER_SIZE) <= stream.size())
+        {
+            const uint8_t* record = &stream.at(offset);
+            const size_t   SIZE   = record[0];
+
+            if ((SIZE < HEADER_SIZE) || (SIZE > MAX_RECORD_SIZE) || ((offset + SIZE) > stream.size()) || (record[1] >= static_cast<uint8_t>(level_t::AMOUNT)))
+            {
+                std::cerr << "Invalid record at offset " << offset << ", skipping byte" << std::endl;
+                offset++;
+                continue;
+            }
+
+            const uint32_t ID = record[2] | (record[3] << 8) | (record[4] << 16) | (static_cast<uint32_t>(record[5]) << 24);
+
+            std::vector<Argument> arguments = {};
+            size_t                index     = HEADER_SIZE;
+
+            while (index < SIZE)
+            {
+                Argument argument = {};
+                argument.type     = static_cast<argType_t>(record[index++]);
+
+                size_t valueSize = 0;
+
+                switch (argument.type)
+                {
+                case argType_t::INT32:
+                case argType_t::UINT32:
+                case argType_t::FLOAT:
+                {
+                    valueSize = sizeof(uint32_t);
+                }
+                break;
+
+                case argType_t::INT64:
+                case argType_t::UINT64:
+                {
+                    valueSize = sizeof(uint64_t);
+                }
+                break;
+
+                case argType_t::STRING:
+                {
+                    const size_t LENGTH = (index < SIZE) ? record[index++] : 0;
+
+                    for (size_t i = 0; (i < LENGTH) && (index < SIZE); i++)
+                    {
+                        argument.string += static_cast<char>(record[index++]);
+                    }
+                }
+                break;
+
+                default:
+                {
+                    // unknown type - remaining arguments can't be decoded
+                    index = SIZE;
+                }
+                break;
+                }
+
+                for (size_t i = 0; (i < valueSize) && (index < SIZE); i++)
+                {
+                    argument.value |= static_cast<uint64_t>(record[index++]) << (i * 8);
+                }
+
+                if (argument.type < argType_t::AMOUNT)
+                {
+                    arguments.push_back(argument);
+                }
+            }
+
+            std::cout << "[" << LEVEL[record[1]] << "] ";
+
+            if (ID == DROPPED_ID)
+            {
+                std::cout << format("%u log records dropped", arguments);
+            }
+            else if (auto it = formats.find(ID); it != formats.end())
+            {
+                std::cout << format(it->second, arguments);
+            }
+            else
+            {
+                std::cout << "Unknown format string ID 0x" << std::hex << ID << std::dec << " with " << arguments.size() << " arguments";
+            }
+
+            std::cout << std::endl;
+            offset += SIZE;
+        }
+    }
+
+    /// Extracts log records from captured SysEx messages.
+    std::vector<uint8_t> extractSysEx(const std::vector<uint8_t>& input)
+    {
+        std::vector<uint8_t> stream  = {};
+        std::vector<uint8_t> message = {};
+        bool                 inside  = false;
+
+        for (auto byte : input)
+        {
+            if (byte == 0xF0)
+            {
+                message.clear();
+                inside = true;
+            }
+
+            if (!inside)
+            {
+                continue;
+            }
+
+            message.push_back(byte);
+
+            if (byte != 0xF7)
+            {
+                continue;
+            }
+
+            inside = false;
+
+            if ((message.size() <= (SYSEX_CUSTOM_ID_OFFSET + 2)) || (message.at(SYSEX_CUSTOM_ID_OFFSET) != SYSEX_CM_LOG))
+            {
+                continue;
+            }
+
+            const size_t         PACKED_SIZE = message.size() - SYSEX_CUSTOM_ID_OFFSET - 2;
+            std::vector<uint8_t> unpacked(PACKED_SIZE);
+
+            unpacked.resize(unpack7Bit(&message.at(SYSEX_CUSTOM_ID_OFFSET + 1), PACKED_SIZE, unpacked.data()));
+            stream.insert(stream.end(), unpacked.begin(), unpacked.end());
+        }
+
+        return stream;
+    }
+}    // namespace
+
+int main(int argc, char* argv[])
+{
+    // first argument should be path to the firmware sources
+    // second argument should be path to the captured log
+    // optional third argument "--raw" indicates that log is not wrapped in SysEx (eg. UART capture)
+    if (argc <= 2)
+    {
+        std::cout << "Usage: " << argv[0] << " <firmware source dir> <captured log> [--raw]" << std::endl;
+        return -1;
+    }
+
+    const bool RAW = (argc > 3) && (std::string(argv[3]) == "--raw");
+
+    std::ifstream        stream(argv[2], std::ios::in | std::ios::binary);
+    std::vector<uint8_t> contents((std::istreambuf_iterator<char>(stream)), std::istreambuf_iterator<char>());
+
+    if (!stream.good() && !stream.eof())
+    {
+        std::cout << "ERROR: Unable to read " << argv[2] << std::endl;
+        return -1;
+    }
+
+    auto formats = collectFormats(argv[1]);
+
+    decode(RAW ? contents : extractSysEx(contents), formats);
+
+    return 0;
+}
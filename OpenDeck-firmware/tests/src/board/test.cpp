@@ -0,0 +1,529 @@
+/*
+
+Copyright Igor Petrovic
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*/
+
+#include "tests/common.h"
+#include "common/io/spsc.h"
+#include "common/io/input/quadrature.h"
+#include "common/io/output/bcm.h"
+#include "common/io/analog/schedule.h"
+
+#include <atomic>
+#include <thread>
+
+using namespace board::detail::io;
+
+namespace
+{
+    constexpr size_t   FRAME_SIZE      = 16;
+    constexpr uint32_t TOTAL_FRAMES    = 100000;
+    constexpr size_t   RING_CAPACITY   = 8;
+    constexpr size_t   SNAPSHOT_VALUES = 2;
+    constexpr uint32_t TOTAL_PULSES    = 10000;
+
+    struct Frame
+    {
+        uint32_t values[FRAME_SIZE];
+    };
+
+    // counter-clockwise sequence of A and B signals, A is in bit 1
+    constexpr uint8_t QUADRATURE_CCW[4] = {
+        0b00,
+        0b01,
+        0b11,
+        0b10,
+    };
+}    // namespace
+
+TEST(SpscTest, RingOrder)
+{
+    SpscRing<Frame, RING_CAPACITY> ring;
+
+    ASSERT_EQ(nullptr, ring.front());
+
+    // fill the entire ring
+    for (uint32_t i = 0; i < RING_CAPACITY; i++)
+    {
+        auto frame = ring.back();
+        ASSERT_NE(nullptr, frame);
+
+        frame->values[0] = i;
+        ring.push();
+    }
+
+    // no more space: producer must skip the frame and queued frames must remain intact
+    ASSERT_EQ(nullptr, ring.back());
+
+    for (uint32_t i = 0; i < RING_CAPACITY; i++)
+    {
+        auto frame = ring.front();
+        ASSERT_NE(nullptr, frame);
+        ASSERT_EQ(i, frame->values[0]);
+
+        ring.pop();
+    }
+
+    ASSERT_EQ(nullptr, ring.front());
+    ASSERT_NE(nullptr, ring.back());
+}
+
+TEST(SpscTest, RingTornRead)
+{
+    SpscRing<Frame, RING_CAPACITY> ring;
+
+    std::thread producer([&]()
+                         {
+                             uint32_t sequence = 0;
+
+                             while (sequence < TOTAL_FRAMES)
+                             {
+                                 auto frame = ring.back();
+
+                                 if (frame == nullptr)
+                                 {
+                                     std::this_thread::yield();
+                                     continue;
+                                 }
+
+                                 for (size_t i = 0; i < FRAME_SIZE; i++)
+                                 {
+                                     frame->values[i] = sequence;
+                                 }
+
+                                 ring.push();
+                                 sequence++;
+                             }
+                         });
+
+    uint32_t expected = 0;
+
+    while (expected < TOTAL_FRAMES)
+    {
+        auto frame = ring.front();
+
+        if (frame == nullptr)
+        {
+            std::this_thread::yield();
+            continue;
+        }
+
+        // all values within the frame must come from the same scan, and no scan can be lost
+        for (size_t i = 0; i < FRAME_SIZE; i++)
+        {
+            ASSERT_EQ(expected, frame->values[i]);
+        }
+
+        ring.pop();
+        expected++;
+    }
+
+    producer.join();
+}
+
+TEST(SpscTest, SnapshotSequence)
+{
+    Snapshot<uint16_t, SNAPSHOT_VALUES> snapshot;
+    uint16_t                            value = 0xFFFF;
+
+    // nothing published yet
+    ASSERT_EQ(0, snapshot.read(0, value));
+    ASSERT_EQ(0, value);
+
+    snapshot.back()[0] = 10;
+    snapshot.back()[1] = 20;
+
+    // values can't be seen before the frame is published
+    ASSERT_EQ(0, snapshot.read(0, value));
+    ASSERT_EQ(0, value);
+
+    snapshot.publish();
+
+    ASSERT_EQ(1, snapshot.read(0, value));
+    ASSERT_EQ(10, value);
+    ASSERT_EQ(1, snapshot.read(1, value));
+    ASSERT_EQ(20, value);
+
+    // partially written frame must not be visible
+    snapshot.back()[0] = 11;
+
+    ASSERT_EQ(1, snapshot.read(0, value));
+    ASSERT_EQ(10, value);
+
+    snapshot.back()[1] = 21;
+    snapshot.publish();
+
+    ASSERT_EQ(2, snapshot.read(0, value));
+    ASSERT_EQ(11, value);
+    ASSERT_EQ(2, snapshot.read(1, value));
+    ASSERT_EQ(21, value);
+
+    // sequence wraps around with the counter size
+    for (size_t i = 0; i < 256; i++)
+    {
+        snapshot.publish();
+    }
+
+    ASSERT_EQ(2, snapshot.read(0, value));
+}
+
+TEST(SpscTest, SnapshotTornRead)
+{
+    // wide sequence so that wraparound can't hide the torn read during the test
+    Snapshot<uint32_t, SNAPSHOT_VALUES, uint32_t> snapshot;
+    std::atomic<bool>                             done = { false };
+
+    std::thread producer([&]()
+                         {
+                             for (uint32_t sequence = 1; sequence <= TOTAL_FRAMES; sequence++)
+                             {
+                                 snapshot.back()[0] = sequence;
+                                 snapshot.back()[1] = ~sequence;
+                                 snapshot.publish();
+
+                                 // let the reader run in between on single core hosts
+                                 if (!(sequence % 1024))
+                                 {
+                                     std::this_thread::yield();
+                                 }
+                             }
+
+                             done = true;
+                         });
+
+    uint32_t lastSequence = 0;
+
+    while (!done)
+    {
+        uint32_t first  = 0;
+        uint32_t second = 0;
+
+        auto sequence1 = snapshot.read(0, first);
+        auto sequence2 = snapshot.read(1, second);
+
+        // each value must come from the frame reported by its sequence number
+        if (sequence1)
+        {
+            ASSERT_EQ(sequence1, first);
+        }
+
+        if (sequence2)
+        {
+            ASSERT_EQ(~sequence2, second);
+        }
+
+        ASSERT_GE(sequence1, lastSequence);
+        ASSERT_GE(sequence2, sequence1);
+
+        lastSequence = sequence2;
+    }
+
+    producer.join();
+}
+
+TEST(QuadratureTest, Decoding)
+{
+    digital_in::Quadrature<2>            quadrature;
+    board::io::digital_in::EncoderPulses pulses;
+    uint8_t                              state = 0;
+
+    // encoder 1 has A and B signals swapped
+    quadrature.init(0, 1, 0);
+    quadrature.init(1, 2, 3);
+
+    auto scan = [&](uint8_t encoder0, uint8_t encoder1, uint32_t time)
+    {
+        state = encoder0 | (encoder1 << 2);
+
+        quadrature.decode([&](size_t index)
+                          {
+                              return static_cast<bool>((state >> index) & 0x01);
+                          },
+                          time);
+    };
+
+    // initial state is only stored
+    scan(QUADRATURE_CCW[0], QUADRATURE_CCW[0], 1000);
+    ASSERT_FALSE(quadrature.read(0, pulses));
+    ASSERT_FALSE(quadrature.read(1, pulses));
+
+    // several scans without reading: all pulses are accumulated
+    for (size_t i = 1; i <= 10; i++)
+    {
+        scan(QUADRATURE_CCW[i % 4], QUADRATURE_CCW[(4 - (i % 4)) % 4], 1000 + (i * 1000));
+    }
+
+    ASSERT_TRUE(quadrature.read(0, pulses));
+    ASSERT_EQ(10, pulses.pulses);
+    ASSERT_EQ(11000, pulses.time);
+
+    // encoder 1 was rotated in opposite direction, but with swapped signals it moves in the same one
+    ASSERT_TRUE(quadrature.read(1, pulses));
+    ASSERT_EQ(10, pulses.pulses);
+    ASSERT_EQ(11000, pulses.time);
+
+    // pulses are read only once
+    ASSERT_FALSE(quadrature.read(0, pulses));
+    ASSERT_EQ(0, pulses.pulses);
+
+    // no change and invalid transition (both signals changed) don't produce pulses
+    scan(QUADRATURE_CCW[2], QUADRATURE_CCW[2], 12000);
+    scan(QUADRATURE_CCW[0], QUADRATURE_CCW[0], 13000);
+    ASSERT_FALSE(quadrature.read(0, pulses));
+
+    // opposite direction
+    scan(QUADRATURE_CCW[3], QUADRATURE_CCW[1], 14000);
+    scan(QUADRATURE_CCW[2], QUADRATURE_CCW[2], 15000);
+    ASSERT_TRUE(quadrature.read(0, pulses));
+    ASSERT_EQ(-2, pulses.pulses);
+    ASSERT_EQ(15000, pulses.time);
+
+    // movement back and forth between the reads cancels out
+    scan(QUADRATURE_CCW[3], QUADRATURE_CCW[3], 16000);
+    scan(QUADRATURE_CCW[2], QUADRATURE_CCW[2], 17000);
+    ASSERT_FALSE(quadrature.read(0, pulses));
+}
+
+TEST(QuadratureTest, Transitions)
+{
+    board::io::digital_in::EncoderPulses pulses;
+
+    // every transition between two successive readings of A and B signals
+    for (size_t previous = 0; previous < 4; previous++)
+    {
+        for (size_t next = 0; next < 4; next++)
+        {
+            digital_in::Quadrature<1> quadrature;
+            uint8_t                   state = 0;
+
+            quadrature.init(0, 1, 0);
+
+            auto scan = [&](uint8_t newState)
+            {
+                state = newState;
+
+                quadrature.decode([&](size_t index)
+                                  {
+                                      return static_cast<bool>((state >> index) & 0x01);
+                                  },
+                                  0);
+            };
+
+            scan(QUADRATURE_CCW[previous]);
+            scan(QUADRATURE_CCW[next]);
+            quadrature.read(0, pulses);
+
+            // single step in counter-clockwise sequence is a positive pulse, step back is a negative one,
+            // while no change and change of both signals are ignored
+            int8_t expected = 0;
+
+            if (next == ((previous + 1) % 4))
+            {
+                expected = 1;
+            }
+            else if (previous == ((next + 1) % 4))
+            {
+                expected = -1;
+            }
+
+            ASSERT_EQ(expected, pulses.pulses);
+        }
+    }
+}
+
+TEST(QuadratureTest, ConcurrentRead)
+{
+    digital_in::Quadrature<1> quadrature;
+    std::atomic<bool>         done  = { false };
+    std::atomic<uint32_t>     total = { 0 };
+    uint8_t                   state = 0;
+
+    quadrature.init(0, 1, 0);
+
+    std::thread producer([&]()
+                         {
+                             // pulse time is the amount of pulses so far
+                             for (uint32_t pulse = 0; pulse <= TOTAL_PULSES; pulse++)
+                             {
+                                 state = QUADRATURE_CCW[pulse % 4];
+
+                                 quadrature.decode([&](size_t index)
+                                                   {
+                                                       return static_cast<bool>((state >> index) & 0x01);
+                                                   },
+                                                   pulse);
+
+                                 // pulses decoded between two reads must fit in the counter
+                                 while ((pulse - total) > 64)
+                                 {
+                                     std::this_thread::yield();
+                                 }
+                             }
+
+                             done = true;
+                         });
+
+    board::io::digital_in::EncoderPulses pulses;
+
+    auto read = [&]()
+    {
+        if (quadrature.read(0, pulses))
+        {
+            total += pulses.pulses;
+
+            // time must belong to the last read pulse
+            ASSERT_EQ(total.load(), pulses.time);
+        }
+    };
+
+    while (!done)
+    {
+        read();
+    }
+
+    read();
+
+    ASSERT_EQ(TOTAL_PULSES, total.load());
+
+    producer.join();
+}
+
+TEST(BcmTest, Planes)
+{
+    using board::io::digital_out::ledBrightness_t;
+    using LedPlanes = digital_out::Bcm<uint8_t, 2>;
+
+    LedPlanes ledPlanes;
+
+    // returns the time for which the output is on during a single period
+    auto onTime = [&](size_t word, uint8_t bit)
+    {
+        uint32_t time = 0;
+
+        for (size_t plane = 0; plane < LedPlanes::BITS; plane++)
+        {
+            if ((ledPlanes.word(plane, word) >> bit) & 0x01)
+            {
+                time += LedPlanes::weight(plane);
+            }
+        }
+
+        return time;
+    };
+
+    // period is the sum of all weights
+    uint32_t period = 0;
+
+    for (size_t plane = 0; plane < LedPlanes::BITS; plane++)
+    {
+        period += LedPlanes::weight(plane);
+    }
+
+    ASSERT_EQ(LedPlanes::period(), period);
+
+    // brightness increases with each level, from fully off to fully on
+    ASSERT_EQ(0, LedPlanes::duty(ledBrightness_t::OFF));
+    ASSERT_EQ(period, LedPlanes::duty(ledBrightness_t::B100));
+
+    for (uint8_t level = 1; level <= static_cast<uint8_t>(ledBrightness_t::B100); level++)
+    {
+        ASSERT_LT(LedPlanes::duty(static_cast<ledBrightness_t>(level - 1)), LedPlanes::duty(static_cast<ledBrightness_t>(level)));
+    }
+
+    ledPlanes.write(0, 0, ledBrightness_t::B100);
+    ledPlanes.write(0, 7, ledBrightness_t::B25);
+    ledPlanes.write(1, 3, ledBrightness_t::B50);
+
+    ASSERT_EQ(period, onTime(0, 0));
+    ASSERT_EQ(LedPlanes::duty(ledBrightness_t::B25), onTime(0, 7));
+    ASSERT_EQ(LedPlanes::duty(ledBrightness_t::B50), onTime(1, 3));
+
+    // other outputs aren't changed
+    for (uint8_t bit = 1; bit < 7; bit++)
+    {
+        ASSERT_EQ(0, onTime(0, bit));
+    }
+
+    ledPlanes.write(0, 0, ledBrightness_t::OFF);
+    ASSERT_EQ(0, onTime(0, 0));
+    ASSERT_EQ(LedPlanes::duty(ledBrightness_t::B25), onTime(0, 7));
+
+    // inverted outputs are on while low
+    ledPlanes.write(1, 0, ledBrightness_t::B75, false);
+    ASSERT_EQ(period - LedPlanes::duty(ledBrightness_t::B75), onTime(1, 0));
+    ASSERT_EQ(LedPlanes::duty(ledBrightness_t::B50), onTime(1, 3));
+
+    // staged outputs are written only once all of them are staged
+    LedPlanes::Staging staging(ledPlanes);
+
+    staging.stage(0, 7, ledBrightness_t::OFF);
+    staging.stage(0, 2, ledBrightness_t::B100);
+    staging.stage(1, 3, ledBrightness_t::B25);
+    ASSERT_EQ(LedPlanes::duty(ledBrightness_t::B25), onTime(0, 7));
+    ASSERT_EQ(0, onTime(0, 2));
+
+    staging.write();
+    ASSERT_EQ(0, onTime(0, 7));
+    ASSERT_EQ(period, onTime(0, 2));
+    ASSERT_EQ(LedPlanes::duty(ledBrightness_t::B25), onTime(1, 3));
+
+    // outputs which weren't staged aren't changed
+    ASSERT_EQ(0, onTime(0, 0));
+    ASSERT_EQ(period - LedPlanes::duty(ledBrightness_t::B75), onTime(1, 0));
+}
+
+TEST(ScheduleTest, Frames)
+{
+    // input 1 sampled in every frame, input 2 in every other one and input 0 in every fourth one
+    constexpr size_t  SLOTS                        = 7;
+    constexpr size_t  FRAMES                       = 4;
+    constexpr uint8_t INPUTS[SLOTS]                = { 1, 1, 2, 1, 0, 1, 2 };
+    constexpr bool    FRAME_END[SLOTS]             = { true, false, true, true, false, false, true };
+    constexpr size_t  EXPECTED_SAMPLES[3]          = { 1, 4, 2 };
+    constexpr size_t  EXPECTED_FRAME_SIZES[FRAMES] = { 1, 2, 1, 3 };
+
+    analog::Schedule<SLOTS> schedule(INPUTS, FRAME_END);
+
+    // verify that the schedule wraps around
+    for (size_t cycle = 0; cycle < 3; cycle++)
+    {
+        size_t samples[3] = {};
+        size_t frames     = 0;
+        size_t frameSize  = 0;
+
+        for (size_t slot = 0; slot < SLOTS; slot++)
+        {
+            ASSERT_EQ(INPUTS[slot], schedule.input());
+            samples[schedule.input()]++;
+            frameSize++;
+
+            if (schedule.next())
+            {
+                ASSERT_LT(frames, FRAMES);
+                ASSERT_EQ(EXPECTED_FRAME_SIZES[frames], frameSize);
+                frames++;
+                frameSize = 0;
+            }
+        }
+
+        ASSERT_EQ(FRAMES, frames);
+
+        for (size_t i = 0; i < 3; i++)
+        {
+            ASSERT_EQ(EXPECTED_SAMPLES[i], samples[i]);
+        }
+    }
+}
@@ -23,6 +23,9 @@ limitations under the License.
 #include "tests/helpers/midi.h"
 #include "sysex_parser/sysex_parser.h"
 #include "bootloader/updater/builder.h"
+#include "bootloader/fw_selector/builder.h"
+#include "bootloader/fw_selector/crc.h"
+#include "core/util/util.h"
 
 #include <filesystem>
 #include <iostream>
@@ -32,6 +35,7 @@ limitations under the License.
 #include <iterator>
 #include <string>
 #include <cstddef>
+#include <random>
 
 using namespace protocol;
 
@@ -44,8 +48,147 @@ namespace
     sysex_parser::SysExParser sysExParser;
     updater::Builder          builderUpdater;
     test::MIDIHelper          helper;
+
+    /// Fills the flash with random application of specified size followed by its CRC.
+    void createApp(fw_selector::HwaTest& hwa, size_t size)
+    {
+        std::mt19937 generator(size);
+        uint16_t     crc = 0x0000;
+
+        hwa._flash.resize(size + 2);
+        hwa._lastFwAddr = size;
+
+        for (size_t i = 0; i < size; i++)
+        {
+            hwa._flash.at(i) = generator() & 0xFF;
+            crc              = core::util::XMODEM(crc, hwa._flash.at(i));
+        }
+
+        hwa._flash.at(size)     = crc & 0xFF;
+        hwa._flash.at(size + 1) = crc >> 8;
+    }
+
+    /// Bitwise CRC16 XMODEM used as a reference for table based implementation.
+    uint16_t crc16XmodemBitwise(uint16_t crc, const uint8_t* data, size_t size)
+    {
+        for (size_t i = 0; i < size; i++)
+        {
+            crc ^= static_cast<uint16_t>(data[i] << 8);
+
+            for (size_t bit = 0; bit < 8; bit++)
+            {
+                crc = (crc & 0x8000) ? static_cast<uint16_t>((crc << 1) ^ 0x1021) : static_cast<uint16_t>(crc << 1);
+            }
+        }
+
+        return crc;
+    }
+
+    uint16_t crc16Xmodem(const std::string& data)
+    {
+        return fw_selector::Crc16Xmodem::update(0x0000, reinterpret_cast<const uint8_t*>(data.data()), data.size());
+    }
 }    // namespace
 
+TEST(Bootloader, AppCrc)
+{
+    std::vector<uint8_t> data(1024);
+    std::mt19937         generator(0);
+
+    for (auto& value : data)
+    {
+        value = generator() & 0xFF;
+    }
+
+    // check all alignments and sizes not divisible by word size
+    for (size_t offset = 0; offset < 4; offset++)
+    {
+        for (size_t size = 0; size < 64; size++)
+        {
+            uint16_t crc = 0x0000;
+
+            for (size_t i = 0; i < size; i++)
+            {
+                crc = core::util::XMODEM(crc, data.at(offset + i));
+            }
+
+            ASSERT_EQ(crc, fw_selector::Crc16Xmodem::update(0x0000, &data.at(offset), size));
+            ASSERT_EQ(crc, crc16XmodemBitwise(0x0000, &data.at(offset), size));
+        }
+    }
+
+    // known vectors
+    ASSERT_EQ(0x0000, crc16Xmodem(""));
+    ASSERT_EQ(0x58E5, crc16Xmodem("A"));
+    ASSERT_EQ(0x31C3, crc16Xmodem("123456789"));
+    ASSERT_EQ(0x0000, crc16Xmodem(std::string(4, '\x00')));
+    ASSERT_EQ(0x99CF, crc16Xmodem(std::string(4, '\xFF')));
+    ASSERT_EQ(0xF0C8, crc16Xmodem("The quick brown fox jumps over the lazy dog"));
+
+    std::vector<uint8_t> sequence(256);
+
+    for (size_t i = 0; i < sequence.size(); i++)
+    {
+        sequence.at(i) = i;
+    }
+
+    ASSERT_EQ(0x7E55, fw_selector::Crc16Xmodem::update(0x0000, sequence.data(), sequence.size()));
+
+    // calculation split at any point yields the same result as in single pass, also with non-zero CRC carried over
+    const auto WHOLE = crc16XmodemBitwise(0x0000, data.data(), data.size());
+
+    for (size_t split = 0; split < 16; split++)
+    {
+        auto crc = fw_selector::Crc16Xmodem::update(0x0000, data.data(), split);
+        crc      = fw_selector::Crc16Xmodem::update(crc, &data.at(split), data.size() - split);
+
+        ASSERT_EQ(WHOLE, crc);
+    }
+}
+
+TEST(Bootloader, AppValidation)
+{
+    fw_selector::Builder builder;
+    createApp(builder._hwa, 4099);
+
+    builder.instance().select();
+    ASSERT_EQ(fw_selector::fwType_t::APPLICATION, builder._hwa._loaded);
+    ASSERT_NE(0, builder._hwa._appVerificationMarker);
+
+    // verified application is loaded without calculating the CRC again
+    builder._hwa._flash.at(100) ^= 0xFF;
+    builder.instance().select();
+    ASSERT_EQ(fw_selector::fwType_t::APPLICATION, builder._hwa._loaded);
+
+    // once the marker is cleared (firmware update), CRC is verified again
+    builder._hwa._appVerificationMarker = 0;
+    builder.instance().select();
+    ASSERT_EQ(fw_selector::fwType_t::BOOTLOADER, builder._hwa._loaded);
+    ASSERT_EQ(0, builder._hwa._appVerificationMarker);
+
+    // same result when flash can only be read byte by byte
+    builder._hwa._mapped = false;
+    builder.instance().select();
+    ASSERT_EQ(fw_selector::fwType_t::BOOTLOADER, builder._hwa._loaded);
+
+    builder._hwa._flash.at(100) ^= 0xFF;
+    builder.instance().select();
+    ASSERT_EQ(fw_selector::fwType_t::APPLICATION, builder._hwa._loaded);
+}
+
+TEST(Bootloader, AppValidationMappedFlash)
+{
+    fw_selector::Builder builder;
+    createApp(builder._hwa, 64 * 1024 + 3);
+
+    builder._hwa._flashReads = 0;
+    builder.instance().select();
+    ASSERT_EQ(fw_selector::fwType_t::APPLICATION, builder._hwa._loaded);
+
+    // only CRC itself should be read through readFlash, rest is read directly from mapped flash
+    ASSERT_EQ(2, builder._hwa._flashReads);
+}
+
 TEST(Bootloader, FwUpdate)
 {
     if (!std::filesystem::exists(FW_UPDATE_FILE_SYSEX))
@@ -29,6 +29,8 @@ limitations under the License.
 #include "application/protocol/midi/midi.h"
 #include "application/util/configurable/configurable.h"
 
+#include <algorithm>
+
 namespace
 {
     class DatabaseTest : public ::testing::Test
@@ -51,6 +53,45 @@ namespace
     };
 
     uint32_t _dbReadRetVal;
+
+    uint32_t testPattern(size_t section, size_t index, lib::lessdb::sectionParameterType_t type)
+    {
+        auto value = static_cast<uint32_t>((index * 7) + section + 1);
+
+        switch (type)
+        {
+        case lib::lessdb::sectionParameterType_t::BIT:
+            return value & 0x01;
+
+        case lib::lessdb::sectionParameterType_t::HALF_BYTE:
+            return value & 0x0F;
+
+        case lib::lessdb::sectionParameterType_t::BYTE:
+            return value & 0x7F;
+
+        default:
+            return value & 0x3FFF;
+        }
+    }
+
+    // Reads every parameter in the block through lessdb and through compile-time layout map
+    // and verifies both paths return the same value.
+    template<typename T>
+    void compareBlock(database::Builder& database, database::Config::block_t block)
+    {
+        const auto& map = database._layout.map();
+
+        for (size_t section = 0; section < static_cast<size_t>(T::AMOUNT); section++)
+        {
+            for (size_t index = 0; index < map.sections[static_cast<size_t>(block)][section].parameters; index++)
+            {
+                auto lessdbValue = database.instance().read(static_cast<uint8_t>(block), static_cast<uint8_t>(section), index);
+                auto mappedValue = database.instance().read(static_cast<T>(section), index);
+
+                ASSERT_EQ(lessdbValue, mappedValue);
+            }
+        }
+    }
 }    // namespace
 
 // more detailed check
@@ -484,6 +525,173 @@ TEST_F(DatabaseTest, FactoryReset)
     ASSERT_FALSE(_database.instance().getPresetPreserveState());
 }
 
+TEST_F(DatabaseTest, IncrementalFactoryReset)
+{
+    class TestHandlers : public database::Handlers
+    {
+        public:
+        void presetChange(uint8_t preset) override
+        {}
+
+        void factoryResetStart() override
+        {
+            _started = true;
+        }
+
+        void factoryResetProgress(uint8_t percentage) override
+        {
+            _progress.push_back(percentage);
+        }
+
+        void factoryResetDone() override
+        {
+            _done = true;
+        }
+
+        void initialized() override
+        {}
+
+        bool                 _started  = false;
+        bool                 _done     = false;
+        std::vector<uint8_t> _progress = {};
+    };
+
+    TestHandlers handlers;
+    _database.instance().registerHandlers(handlers);
+
+    // change a value in every preset so that reset has something to do
+    for (size_t preset = 0; preset < _database.instance().getSupportedPresets(); preset++)
+    {
+        ASSERT_TRUE(_database.instance().setPreset(preset));
+        ASSERT_TRUE(_database.instance().update(database::Config::Section::global_t::SAX_FINGERING_NOTE, 0, 60));
+    }
+
+    _database.instance().setPresetPreserveState(true);
+
+    ASSERT_TRUE(_database.instance().startFactoryReset());
+    ASSERT_TRUE(handlers._started);
+    ASSERT_TRUE(_database.instance().isFactoryResetInProgress());
+
+    // another reset can't be started while one is in progress
+    ASSERT_FALSE(_database.instance().startFactoryReset());
+
+    size_t steps = 0;
+
+    while (_database.instance().isFactoryResetInProgress())
+    {
+        ASSERT_FALSE(handlers._done);
+        ASSERT_TRUE(_database.instance().updateFactoryReset());
+        steps++;
+    }
+
+    // reset must have been split into multiple steps
+    ASSERT_GT(steps, 1);
+    ASSERT_TRUE(handlers._done);
+
+    // progress is reported in increasing order and ends at 100%
+    ASSERT_FALSE(handlers._progress.empty());
+    ASSERT_TRUE(std::is_sorted(handlers._progress.begin(), handlers._progress.end()));
+    ASSERT_EQ(100, handlers._progress.back());
+
+    ASSERT_EQ(0, _database.instance().getPreset());
+    ASSERT_FALSE(_database.instance().getPresetPreserveState());
+
+    for (size_t preset = 0; preset < _database.instance().getSupportedPresets(); preset++)
+    {
+        ASSERT_TRUE(_database.instance().setPreset(preset));
+        DB_READ_VERIFY(0, database::Config::Section::global_t::SAX_FINGERING_NOTE, 0);
+        DB_READ_VERIFY(1, database::Config::Section::global_t::MIDI_SETTINGS, protocol::midi::setting_t::GLOBAL_CHANNEL);
+    }
+
+    // database must be valid after reset without needing another one
+    ASSERT_TRUE(_database.instance().init());
+    ASSERT_EQ(0, _database.instance().getPreset());
+    DB_READ_VERIFY(0, database::Config::Section::global_t::SAX_FINGERING_NOTE, 0);
+}
+
+TEST_F(DatabaseTest, ReadCache)
+{
+    static constexpr size_t FINGERING_INDEX = 0;
+
+    // values written in each preset must be read back correctly after switching presets
+    // and after re-initializing database, regardless of whether reads are served from cache
+    for (size_t preset = 0; preset < _database.instance().getSupportedPresets(); preset++)
+    {
+        ASSERT_TRUE(_database.instance().setPreset(preset));
+        ASSERT_TRUE(_database.instance().update(database::Config::Section::global_t::SAX_FINGERING_NOTE, FINGERING_INDEX, preset + 1));
+        DB_READ_VERIFY(preset + 1, database::Config::Section::global_t::SAX_FINGERING_NOTE, FINGERING_INDEX);
+    }
+
+    for (size_t preset = 0; preset < _database.instance().getSupportedPresets(); preset++)
+    {
+        ASSERT_TRUE(_database.instance().setPreset(preset));
+        DB_READ_VERIFY(preset + 1, database::Config::Section::global_t::SAX_FINGERING_NOTE, FINGERING_INDEX);
+    }
+
+    _database.instance().setPresetPreserveState(true);
+    ASSERT_TRUE(_database.instance().init());
+    ASSERT_EQ(_database.instance().getSupportedPresets() - 1, _database.instance().getPreset());
+    DB_READ_VERIFY(_database.instance().getSupportedPresets(), database::Config::Section::global_t::SAX_FINGERING_NOTE, FINGERING_INDEX);
+
+    // factory reset must not leave stale values behind
+    ASSERT_TRUE(_database.instance().factoryReset());
+    ASSERT_EQ(0, _database.instance().getPreset());
+    ASSERT_EQ(0, _database.instance().read(database::Config::Section::global_t::SAX_FINGERING_NOTE, FINGERING_INDEX));
+
+    if (_database.instance().isReadCacheActive())
+    {
+        // switching preset must refill the cache from storage
+        ASSERT_TRUE(_database.instance().setPreset(_database.instance().getSupportedPresets() - 1));
+        ASSERT_TRUE(_database.instance().isReadCacheActive());
+        ASSERT_EQ(0, _database.instance().read(database::Config::Section::global_t::SAX_FINGERING_NOTE, FINGERING_INDEX));
+    }
+}
+
+TEST_F(DatabaseTest, LayoutMap)
+{
+    ASSERT_TRUE(_database.instance().isLayoutMapValid());
+
+    const auto& map = _database._layout.map();
+
+    for (size_t preset = 0; preset < _database.instance().getSupportedPresets(); preset++)
+    {
+        ASSERT_TRUE(_database.instance().setPreset(preset));
+
+        // fill every parameter with distinct pattern so that packing errors are detected
+        for (size_t block = 0; block < static_cast<size_t>(database::Config::block_t::AMOUNT); block++)
+        {
+            for (size_t section = 0; section < database::LayoutMap::MAX_SECTIONS; section++)
+            {
+                const auto& location = map.sections[block][section];
+
+                for (size_t index = 0; index < location.parameters; index++)
+                {
+                    ASSERT_TRUE(_database.instance().update(static_cast<uint8_t>(block),
+                                                            static_cast<uint8_t>(section),
+                                                            index,
+                                                            testPattern(section + preset, index, location.type)));
+                }
+            }
+        }
+    }
+
+    for (size_t preset = 0; preset < _database.instance().getSupportedPresets(); preset++)
+    {
+        ASSERT_TRUE(_database.instance().setPreset(preset));
+
+        compareBlock<database::Config::Section::global_t>(_database, database::Config::block_t::GLOBAL);
+        compareBlock<database::Config::Section::button_t>(_database, database::Config::block_t::BUTTONS);
+        compareBlock<database::Config::Section::encoder_t>(_database, database::Config::block_t::ENCODERS);
+        compareBlock<database::Config::Section::analog_t>(_database, database::Config::block_t::ANALOG);
+        compareBlock<database::Config::Section::leds_t>(_database, database::Config::block_t::LEDS);
+        compareBlock<database::Config::Section::i2c_t>(_database, database::Config::block_t::I2C);
+        compareBlock<database::Config::Section::touchscreen_t>(_database, database::Config::block_t::TOUCHSCREEN);
+    }
+
+    // section not present in layout can't be read
+    ASSERT_FALSE(_database.instance().read(database::Config::Section::button_t::SYSEX_MACRO_DATA, 0, _dbReadRetVal));
+}
+
 #ifdef PROJECT_TARGET_SUPPORT_LEDS
 TEST_F(DatabaseTest, LEDs)
 {
@@ -747,4 +747,49 @@ TEST_F(ButtonsTest, MMCStartStop)
     ASSERT_EQ(midi::messageType_t::MMC_STOP, _listener._event.at(0).message);
 }
 
+TEST_F(ButtonsTest, ChangedInputsOnly)
+{
+    if (!buttons::Collection::SIZE(buttons::GROUP_DIGITAL_INPUTS))
+    {
+        return;
+    }
+
+    static constexpr size_t BUTTON_INDEX = buttons::Collection::SIZE(buttons::GROUP_DIGITAL_INPUTS) - 1;
+
+    _listener._event.clear();
+
+    // only single input has changed: no other input should be read
+    EXPECT_CALL(_buttons._hwa, changes(_, _))
+        .WillOnce(Invoke([](uint32_t* changed, size_t words)
+                         {
+                             changed[BUTTON_INDEX / 32] |= 1UL << (BUTTON_INDEX % 32);
+                             return true;
+                         }));
+
+    EXPECT_CALL(_buttons._hwa, state(BUTTON_INDEX, _, _))
+        .WillOnce(DoAll(SetArgReferee<1>(1),
+                        SetArgReferee<2>(1),
+                        Return(true)));
+
+    EXPECT_CALL(_buttons._hwa, state(Ne(BUTTON_INDEX), _, _))
+        .Times(0);
+
+    ASSERT_TRUE(_buttons._instance.updateChanged());
+    ASSERT_EQ(1, _listener._event.size());
+    ASSERT_EQ(midi::messageType_t::NOTE_ON, _listener._event.at(0).message);
+    ASSERT_EQ(BUTTON_INDEX, _listener._event.at(0).index);
+    ASSERT_TRUE(_buttons._instance.isPressed(BUTTON_INDEX));
+
+    // input is debounced: with no new changes, nothing should be read anymore
+    EXPECT_CALL(_buttons._hwa, changes(_, _))
+        .WillOnce(Return(false));
+
+    EXPECT_CALL(_buttons._hwa, state(_, _, _))
+        .Times(0);
+
+    _listener._event.clear();
+    ASSERT_TRUE(_buttons._instance.updateChanged());
+    ASSERT_EQ(0, _listener._event.size());
+}
+
 #endif
\ No newline at end of file
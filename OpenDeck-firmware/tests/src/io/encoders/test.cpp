@@ -44,8 +44,20 @@ namespace
                 ASSERT_TRUE(_encoders._database.update(database::Config::Section::encoder_t::INVERT, i, 0));
                 ASSERT_TRUE(_encoders._database.update(database::Config::Section::encoder_t::MODE, i, encoders::type_t::CONTROL_CHANGE_7FH01H));
                 ASSERT_TRUE(_encoders._database.update(database::Config::Section::encoder_t::PULSES_PER_STEP, i, 1));
+                ASSERT_TRUE(_encoders._database.update(database::Config::Section::encoder_t::ACCELERATION, i, encoders::acceleration_t::DISABLED));
+                _encoders._instance.reset(i);
             }
 
+            EXPECT_CALL(_encoders._hwa, pulses(_, _, _))
+                .WillRepeatedly(Invoke([this](size_t index, int8_t& pulses, uint32_t& time)
+                                       {
+                                           pulses            = _pulses.at(index);
+                                           time              = _pulseTime.at(index);
+                                           _pulses.at(index) = 0;
+
+                                           return pulses != 0;
+                                       }));
+
             MidiDispatcher.listen(messaging::eventType_t::ENCODER,
                                   [this](const messaging::Event& dispatchMessage)
                                   {
@@ -60,33 +72,50 @@ namespace
             _listener._event.clear();
         }
 
-        void stateChangeRegister(uint8_t state)
+        /// Simulates single scan of digital inputs in which all encoders have moved by the provided
+        /// amount of pulses. A and B signals are decoded into pulses by the board.
+        void scan(int8_t pulses, uint32_t timeStep = SCAN_TIME)
         {
-            _listener._event.clear();
+            _time += timeStep;
 
-            EXPECT_CALL(_encoders._hwa, state(_, _, _))
-                .WillRepeatedly(DoAll(SetArgReferee<1>(1),
-                                      SetArgReferee<2>(state),
-                                      Return(true)));
+            if (!pulses)
+            {
+                return;
+            }
+
+            for (size_t i = 0; i < encoders::Collection::SIZE(); i++)
+            {
+                _pulses.at(i) += pulses;
+                _pulseTime.at(i) = _time;
+            }
+        }
 
+        void stateChangeRegister(int8_t pulses)
+        {
+            _listener._event.clear();
+            scan(pulses);
             _encoders._instance.updateAll();
         }
 
-        static constexpr std::array<uint8_t, 4> ENCODER_STATE = {
-            0b00,
-            0b10,
-            0b11,
-            0b01
-        };
+        /// Time between two scans of digital inputs in microseconds.
+        static constexpr uint32_t SCAN_TIME = 1000;
+
+        /// Pulses are signed, positive values are counter-clockwise.
+        static constexpr int8_t CW  = -1;
+        static constexpr int8_t CCW = 1;
 
         test::Listener    _listener;
         database::Builder _builderDatabase;
         database::Admin&  _databaseAdmin = _builderDatabase.instance();
         encoders::Builder _encoders      = encoders::Builder(_databaseAdmin);
+
+        std::array<int8_t, encoders::Collection::SIZE()>   _pulses    = {};
+        std::array<uint32_t, encoders::Collection::SIZE()> _pulseTime = {};
+        uint32_t                                           _time      = 0;
     };
 }    // namespace
 
-TEST_F(EncodersTest, StateDecoding)
+TEST_F(EncodersTest, PulsesPerStep)
 {
     if (!encoders::Collection::SIZE())
     {
@@ -102,131 +131,25 @@ TEST_F(EncodersTest, StateDecoding)
         }
     };
 
-    // test expected permutations for ccw and cw directions
-
-    // clockwise: 00, 10, 11, 01
-
-    stateChangeRegister(0b00);
-    ASSERT_EQ(0, _listener._event.size());
-
-    stateChangeRegister(0b10);
-    ASSERT_EQ(encoders::Collection::SIZE(), _listener._event.size());
-    verifyValue(midi::messageType_t::CONTROL_CHANGE, 1);
-
-    stateChangeRegister(0b11);
-    ASSERT_EQ(encoders::Collection::SIZE(), _listener._event.size());
-    verifyValue(midi::messageType_t::CONTROL_CHANGE, 1);
-
-    stateChangeRegister(0b01);
-    ASSERT_EQ(encoders::Collection::SIZE(), _listener._event.size());
-    verifyValue(midi::messageType_t::CONTROL_CHANGE, 1);
-
-    stateChangeRegister(0b10);
-    ASSERT_EQ(0, _listener._event.size());
-
-    stateChangeRegister(0b11);
-    ASSERT_EQ(encoders::Collection::SIZE(), _listener._event.size());
-    verifyValue(midi::messageType_t::CONTROL_CHANGE, 1);
-
-    stateChangeRegister(0b01);
-    ASSERT_EQ(encoders::Collection::SIZE(), _listener._event.size());
-    verifyValue(midi::messageType_t::CONTROL_CHANGE, 1);
-
-    stateChangeRegister(0b00);
-    ASSERT_EQ(encoders::Collection::SIZE(), _listener._event.size());
-    verifyValue(midi::messageType_t::CONTROL_CHANGE, 1);
-
-    stateChangeRegister(0b11);
-    ASSERT_EQ(0, _listener._event.size());
-
-    stateChangeRegister(0b01);
-    ASSERT_EQ(encoders::Collection::SIZE(), _listener._event.size());
-    verifyValue(midi::messageType_t::CONTROL_CHANGE, 1);
-
-    stateChangeRegister(0b00);
-    ASSERT_EQ(encoders::Collection::SIZE(), _listener._event.size());
-    verifyValue(midi::messageType_t::CONTROL_CHANGE, 1);
-
-    stateChangeRegister(0b10);
-    ASSERT_EQ(encoders::Collection::SIZE(), _listener._event.size());
-    verifyValue(midi::messageType_t::CONTROL_CHANGE, 1);
-
-    stateChangeRegister(0b01);
+    // scan without movement
+    stateChangeRegister(0);
     ASSERT_EQ(0, _listener._event.size());
 
-    stateChangeRegister(0b00);
-    ASSERT_EQ(encoders::Collection::SIZE(), _listener._event.size());
-    verifyValue(midi::messageType_t::CONTROL_CHANGE, 1);
-
-    stateChangeRegister(0b10);
-    ASSERT_EQ(encoders::Collection::SIZE(), _listener._event.size());
-    verifyValue(midi::messageType_t::CONTROL_CHANGE, 1);
-
-    stateChangeRegister(0b11);
-    ASSERT_EQ(encoders::Collection::SIZE(), _listener._event.size());
-    verifyValue(midi::messageType_t::CONTROL_CHANGE, 1);
-
-    // counter-clockwise: 00, 01, 11, 10
-
-    stateChangeRegister(0b00);
-    ASSERT_EQ(0, _listener._event.size());
-
-    stateChangeRegister(0b01);
-    ASSERT_EQ(encoders::Collection::SIZE(), _listener._event.size());
-    verifyValue(midi::messageType_t::CONTROL_CHANGE, 127);
-
-    stateChangeRegister(0b11);
-    ASSERT_EQ(encoders::Collection::SIZE(), _listener._event.size());
-    verifyValue(midi::messageType_t::CONTROL_CHANGE, 127);
-
-    stateChangeRegister(0b10);
-    ASSERT_EQ(encoders::Collection::SIZE(), _listener._event.size());
-    verifyValue(midi::messageType_t::CONTROL_CHANGE, 127);
-
-    stateChangeRegister(0b01);
-    ASSERT_EQ(0, _listener._event.size());
-
-    stateChangeRegister(0b11);
-    ASSERT_EQ(encoders::Collection::SIZE(), _listener._event.size());
-    verifyValue(midi::messageType_t::CONTROL_CHANGE, 127);
-
-    stateChangeRegister(0b10);
-    ASSERT_EQ(encoders::Collection::SIZE(), _listener._event.size());
-    verifyValue(midi::messageType_t::CONTROL_CHANGE, 127);
-
-    stateChangeRegister(0b00);
-    ASSERT_EQ(encoders::Collection::SIZE(), _listener._event.size());
-    verifyValue(midi::messageType_t::CONTROL_CHANGE, 127);
-
-    stateChangeRegister(0b11);
-    ASSERT_EQ(0, _listener._event.size());
-
-    stateChangeRegister(0b10);
-    ASSERT_EQ(encoders::Collection::SIZE(), _listener._event.size());
-    verifyValue(midi::messageType_t::CONTROL_CHANGE, 127);
-
-    stateChangeRegister(0b00);
-    ASSERT_EQ(encoders::Collection::SIZE(), _listener._event.size());
-    verifyValue(midi::messageType_t::CONTROL_CHANGE, 127);
-
-    stateChangeRegister(0b01);
-    ASSERT_EQ(encoders::Collection::SIZE(), _listener._event.size());
-    verifyValue(midi::messageType_t::CONTROL_CHANGE, 127);
-
-    stateChangeRegister(0b10);
-    ASSERT_EQ(0, _listener._event.size());
-
-    stateChangeRegister(0b00);
-    ASSERT_EQ(encoders::Collection::SIZE(), _listener._event.size());
-    verifyValue(midi::messageType_t::CONTROL_CHANGE, 127);
-
-    stateChangeRegister(0b01);
-    ASSERT_EQ(encoders::Collection::SIZE(), _listener._event.size());
-    verifyValue(midi::messageType_t::CONTROL_CHANGE, 127);
+    // each pulse is a step
+    for (size_t pulse = 0; pulse < 4; pulse++)
+    {
+        stateChangeRegister(CW);
+        ASSERT_EQ(encoders::Collection::SIZE(), _listener._event.size());
+        verifyValue(midi::messageType_t::CONTROL_CHANGE, 1);
+    }
 
-    stateChangeRegister(0b11);
-    ASSERT_EQ(encoders::Collection::SIZE(), _listener._event.size());
-    verifyValue(midi::messageType_t::CONTROL_CHANGE, 127);
+    // direction change is reported immediately
+    for (size_t pulse = 0; pulse < 4; pulse++)
+    {
+        stateChangeRegister(CCW);
+        ASSERT_EQ(encoders::Collection::SIZE(), _listener._event.size());
+        verifyValue(midi::messageType_t::CONTROL_CHANGE, 127);
+    }
 
     // this time configure 4 pulses per step
     for (size_t i = 0; i < encoders::Collection::SIZE(); i++)
@@ -235,61 +158,30 @@ TEST_F(EncodersTest, StateDecoding)
         _encoders._instance.reset(i);
     }
 
-    // clockwise: 00, 10, 11, 01
-
-    // initial state doesn't count as pulse, 4 more needed
-    stateChangeRegister(0b00);
-    ASSERT_EQ(0, _listener._event.size());
-
-    // 1
-    stateChangeRegister(0b10);
-    ASSERT_EQ(0, _listener._event.size());
-
-    // 2
-    stateChangeRegister(0b11);
-    ASSERT_EQ(0, _listener._event.size());
-
-    // 3
-    stateChangeRegister(0b01);
-    ASSERT_EQ(0, _listener._event.size());
-
-    // 4
-    // pulse should be registered
-    stateChangeRegister(0b00);
-    ASSERT_EQ(encoders::Collection::SIZE(), _listener._event.size());
-    verifyValue(midi::messageType_t::CONTROL_CHANGE, 1);
-
-    // 1
-    stateChangeRegister(0b10);
-    ASSERT_EQ(0, _listener._event.size());
-
-    // 2
-    stateChangeRegister(0b11);
-    ASSERT_EQ(0, _listener._event.size());
-
-    // 3
-    stateChangeRegister(0b01);
-    ASSERT_EQ(0, _listener._event.size());
+    for (size_t step = 0; step < 2; step++)
+    {
+        // 1, 2, 3
+        for (size_t pulse = 0; pulse < 3; pulse++)
+        {
+            stateChangeRegister(CW);
+            ASSERT_EQ(0, _listener._event.size());
+        }
 
-    // 4
-    stateChangeRegister(0b00);
-    ASSERT_EQ(encoders::Collection::SIZE(), _listener._event.size());
-    verifyValue(midi::messageType_t::CONTROL_CHANGE, 1);
+        // 4
+        // pulse should be registered
+        stateChangeRegister(CW);
+        ASSERT_EQ(encoders::Collection::SIZE(), _listener._event.size());
+        verifyValue(midi::messageType_t::CONTROL_CHANGE, 1);
+    }
 
     // now move to opposite direction
-    // don't start from 0b00 state again
-    // counter-clockwise: 01, 11, 10, 00
-
-    stateChangeRegister(0b01);
-    ASSERT_EQ(0, _listener._event.size());
-
-    stateChangeRegister(0b11);
-    ASSERT_EQ(0, _listener._event.size());
-
-    stateChangeRegister(0b10);
-    ASSERT_EQ(0, _listener._event.size());
+    for (size_t pulse = 0; pulse < 3; pulse++)
+    {
+        stateChangeRegister(CCW);
+        ASSERT_EQ(0, _listener._event.size());
+    }
 
-    stateChangeRegister(0b00);
+    stateChangeRegister(CCW);
     ASSERT_EQ(encoders::Collection::SIZE(), _listener._event.size());
     verifyValue(midi::messageType_t::CONTROL_CHANGE, 127);
 }
@@ -310,9 +202,6 @@ TEST_F(EncodersTest, Messages)
             ASSERT_TRUE(_encoders._database.update(database::Config::Section::encoder_t::PULSES_PER_STEP, i, PULSES_PER_STEP));
             ASSERT_TRUE(_encoders._database.update(database::Config::Section::encoder_t::MODE, i, type));
             _encoders._instance.reset(i);
-
-            // simulate initial reading
-            stateChangeRegister(0b00);
         }
     };
 
@@ -327,27 +216,9 @@ TEST_F(EncodersTest, Messages)
 
     auto rotate = [this](bool clockwise)
     {
-        // skip the initial state
-        size_t stateIndex = 0;
-
-        auto nextValue = [&]()
-        {
-            if (clockwise)
-            {
-                stateIndex++;
-            }
-            else
-            {
-                stateIndex--;
-            }
-
-            stateIndex %= ENCODER_STATE.size();
-            return ENCODER_STATE.at(stateIndex);
-        };
-
         for (size_t pulse = 0; pulse < PULSES_PER_STEP; pulse++)
         {
-            stateChangeRegister(nextValue());
+            stateChangeRegister(clockwise ? CW : CCW);
         }
     };
 
@@ -384,4 +255,141 @@ TEST_F(EncodersTest, Messages)
     verifyValue(midi::messageType_t::NOTE_ON, 0);
 }
 
+TEST_F(EncodersTest, Batching)
+{
+    if (!encoders::Collection::SIZE())
+    {
+        return;
+    }
+
+    constexpr size_t PULSES = 10;
+
+    auto setup = [&](encoders::type_t type, uint8_t pulsesPerStep)
+    {
+        for (size_t i = 0; i < encoders::Collection::SIZE(); i++)
+        {
+            ASSERT_TRUE(_encoders._database.update(database::Config::Section::encoder_t::PULSES_PER_STEP, i, pulsesPerStep));
+            ASSERT_TRUE(_encoders._database.update(database::Config::Section::encoder_t::MODE, i, type));
+            _encoders._instance.reset(i);
+        }
+
+        _listener._event.clear();
+    };
+
+    // rotate clockwise for several scans before the encoders are read
+    auto rotate = [&](size_t pulses)
+    {
+        for (size_t pulse = 0; pulse < pulses; pulse++)
+        {
+            scan(CW);
+        }
+
+        _encoders._instance.updateAll();
+    };
+
+    // no pulse is lost and only the last value is sent
+    setup(encoders::type_t::CONTROL_CHANGE, 1);
+    rotate(PULSES);
+    ASSERT_EQ(encoders::Collection::SIZE(), _listener._event.size());
+
+    for (size_t i = 0; i < encoders::Collection::SIZE(); i++)
+    {
+        ASSERT_EQ(midi::messageType_t::CONTROL_CHANGE, _listener._event.at(i).message);
+        ASSERT_EQ(PULSES, _listener._event.at(i).value);
+    }
+
+    // relative messages are sent for each step
+    setup(encoders::type_t::CONTROL_CHANGE_7FH01H, 1);
+    rotate(PULSES);
+    ASSERT_EQ(encoders::Collection::SIZE() * PULSES, _listener._event.size());
+
+    for (size_t i = 0; i < _listener._event.size(); i++)
+    {
+        ASSERT_EQ(1, _listener._event.at(i).value);
+    }
+
+    // pulses which don't form a whole step are kept for the next read
+    setup(encoders::type_t::CONTROL_CHANGE_7FH01H, 4);
+    rotate(PULSES);
+    ASSERT_EQ(encoders::Collection::SIZE() * (PULSES / 4), _listener._event.size());
+
+    _listener._event.clear();
+
+    // 2 pulses remain, continue rotating in the same direction
+    scan(CW);
+    scan(CW);
+    _encoders._instance.updateAll();
+    ASSERT_EQ(encoders::Collection::SIZE(), _listener._event.size());
+}
+
+TEST_F(EncodersTest, Acceleration)
+{
+    if (!encoders::Collection::SIZE())
+    {
+        return;
+    }
+
+    constexpr size_t STEPS = 5;
+
+    // speed increases by 3 on each fast step: 1 + 3 + 6 + 9 + 12
+    constexpr uint16_t ACCELERATED_VALUE = 31;
+
+    auto setup = [&]()
+    {
+        for (size_t i = 0; i < encoders::Collection::SIZE(); i++)
+        {
+            ASSERT_TRUE(_encoders._database.update(database::Config::Section::encoder_t::MODE, i, encoders::type_t::CONTROL_CHANGE));
+            ASSERT_TRUE(_encoders._database.update(database::Config::Section::encoder_t::ACCELERATION, i, encoders::acceleration_t::FAST));
+            _encoders._instance.reset(i);
+        }
+    };
+
+    auto verifyValue = [&](uint16_t value)
+    {
+        ASSERT_EQ(encoders::Collection::SIZE(), _listener._event.size());
+
+        for (size_t i = 0; i < encoders::Collection::SIZE(); i++)
+        {
+            ASSERT_EQ(value, _listener._event.at(i).value);
+        }
+    };
+
+    // slow movement: no acceleration
+    setup();
+
+    for (size_t step = 1; step <= STEPS; step++)
+    {
+        stateChangeRegister(CW);
+        scan(0, 200000);
+    }
+
+    verifyValue(STEPS);
+
+    // fast movement with the encoders read after each scan
+    setup();
+
+    for (size_t step = 1; step <= STEPS; step++)
+    {
+        stateChangeRegister(CW);
+    }
+
+    verifyValue(ACCELERATED_VALUE);
+
+    // fast movement with the encoders read long after the last step:
+    // acceleration depends only on the time of the steps
+    setup();
+    stateChangeRegister(CW);
+    _listener._event.clear();
+
+    for (size_t step = 2; step <= STEPS; step++)
+    {
+        scan(CW);
+    }
+
+    scan(0, 500000);
+    _encoders._instance.updateAll();
+
+    verifyValue(ACCELERATED_VALUE);
+}
+
 #endif
\ No newline at end of file
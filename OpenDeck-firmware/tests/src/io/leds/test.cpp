@@ -22,6 +22,8 @@ limitations under the License.
 #include "application/util/configurable/configurable.h"
 #include "application/global/midi_program.h"
 
+#include <tuple>
+
 #ifdef PROJECT_TARGET_SUPPORT_LEDS
 
 using namespace io;
@@ -1028,4 +1030,159 @@ TEST_F(LEDsTest, GlobalChannel)
     }
 }
 
+TEST_F(LEDsTest, MidiClockBlink)
+{
+    if (leds::Collection::SIZE(leds::GROUP_DIGITAL_OUTPUTS) < 3)
+    {
+        return;
+    }
+
+    struct Blink
+    {
+        size_t               clock   = 0;
+        std::vector<size_t>  changed = {};
+        std::vector<uint8_t> values  = {};
+    };
+
+    // LED index, MIDI value, brightness and blink speed set with the value
+    const std::vector<std::tuple<size_t, uint8_t, leds::brightness_t, leds::blinkSpeed_t>> BLINKING_LEDS = {
+        { 0, 17, leds::brightness_t::B50, leds::blinkSpeed_t::S1000MS },
+        { 1, 22, leds::brightness_t::B75, leds::blinkSpeed_t::S500MS },
+        { 2, 27, leds::brightness_t::B100, leds::blinkSpeed_t::S250MS },
+    };
+
+    std::vector<Blink> blinks = {};
+    size_t             clock  = 0;
+
+    ASSERT_EQ(sys::Config::Status::ACK,
+              ConfigHandler.set(sys::Config::block_t::LEDS,
+                                static_cast<uint8_t>(sys::Config::Section::leds_t::GLOBAL),
+                                static_cast<size_t>(leds::setting_t::BLINK_WITH_MIDI_CLOCK),
+                                static_cast<uint16_t>(leds::blinkType_t::MIDI_CLOCK)));
+
+    EXPECT_CALL(_leds._hwa, setState(_, _))
+        .Times(AnyNumber());
+
+    // store the state of all written LEDs in each call
+    EXPECT_CALL(_leds._hwa, setStates(_, _, _))
+        .WillRepeatedly(Invoke([&](const uint32_t* changed, const uint32_t* planes, size_t words)
+                               {
+                                   Blink blink = {};
+                                   blink.clock = clock;
+
+                                   for (size_t i = 0; i < words * 32; i++)
+                                   {
+                                       if (!((changed[i / 32] >> (i % 32)) & 0x01))
+                                       {
+                                           continue;
+                                       }
+
+                                       uint8_t value = 0;
+
+                                       for (size_t plane = 0; plane < board::io::digital_out::LED_BRIGHTNESS_PLANES; plane++)
+                                       {
+                                           value |= ((planes[(plane * words) + (i / 32)] >> (i % 32)) & 0x01) << plane;
+                                       }
+
+                                       blink.changed.push_back(i);
+                                       blink.values.push_back(value);
+                                   }
+
+                                   blinks.push_back(blink);
+                               }));
+
+    for (const auto& [led, value, brightness, speed] : BLINKING_LEDS)
+    {
+        ASSERT_TRUE(_leds._database.update(database::Config::Section::leds_t::CONTROL_TYPE, led, leds::controlType_t::MIDI_IN_NOTE_MULTI_VAL));
+
+        MidiDispatcher.notify(messaging::eventType_t::MIDI_IN,
+                              {
+                                  {},                                // componentIndex
+                                  MIDI_CHANNEL,                      // channel
+                                  static_cast<uint16_t>(led),        // index
+                                  value,                             // value
+                                  {},                                // sysEx
+                                  {},                                // sysExLength
+                                  {},                                // forcedRefresh
+                                  midi::messageType_t::NOTE_ON,      // message
+                                  {},                                // systemMessage
+                              });
+
+        ASSERT_EQ(speed, _leds._instance.blinkSpeed(led));
+    }
+
+    auto send = [](midi::messageType_t message)
+    {
+        MidiDispatcher.notify(messaging::eventType_t::MIDI_IN,
+                              {
+                                  {},         // componentIndex
+                                  {},         // channel
+                                  {},         // index
+                                  {},         // value
+                                  {},         // sysEx
+                                  {},         // sysExLength
+                                  {},         // forcedRefresh
+                                  message,    // message
+                                  {},         // systemMessage
+                              });
+    };
+
+    // start counts as the first clock pulse
+    send(midi::messageType_t::SYS_REAL_TIME_START);
+
+    for (clock = 1; clock <= 48; clock++)
+    {
+        send(midi::messageType_t::SYS_REAL_TIME_CLOCK);
+    }
+
+    // each blink speed is written with a single call, containing only the LEDs blinking with it:
+    // LEDs are turned off on first toggle and turned on with their brightness on the next one
+    const std::vector<Blink> EXPECTED = {
+        { 11, { 2 }, { 0 } },
+        { 23, { 1 }, { 0 } },
+        { 23, { 2 }, { static_cast<uint8_t>(leds::brightness_t::B100) } },
+        { 35, { 2 }, { 0 } },
+        { 47, { 0 }, { 0 } },
+        { 47, { 1 }, { static_cast<uint8_t>(leds::brightness_t::B75) } },
+        { 47, { 2 }, { static_cast<uint8_t>(leds::brightness_t::B100) } },
+    };
+
+    ASSERT_EQ(EXPECTED.size(), blinks.size());
+
+    for (size_t i = 0; i < EXPECTED.size(); i++)
+    {
+        ASSERT_EQ(EXPECTED.at(i).clock, blinks.at(i).clock);
+        ASSERT_EQ(EXPECTED.at(i).changed, blinks.at(i).changed);
+        ASSERT_EQ(EXPECTED.at(i).values, blinks.at(i).values);
+    }
+
+    // LEDs which stop blinking aren't written anymore
+    for (const auto& [led, value, brightness, speed] : BLINKING_LEDS)
+    {
+        MidiDispatcher.notify(messaging::eventType_t::MIDI_IN,
+                              {
+                                  {},                                // componentIndex
+                                  MIDI_CHANNEL,                      // channel
+                                  static_cast<uint16_t>(led),        // index
+                                  0,                                 // value
+                                  {},                                // sysEx
+                                  {},                                // sysExLength
+                                  {},                                // forcedRefresh
+                                  midi::messageType_t::NOTE_ON,      // message
+                                  {},                                // systemMessage
+                              });
+
+        ASSERT_EQ(leds::blinkSpeed_t::NO_BLINK, _leds._instance.blinkSpeed(led));
+    }
+
+    blinks.clear();
+
+    for (clock = 1; clock <= 48; clock++)
+    {
+        send(midi::messageType_t::SYS_REAL_TIME_CLOCK);
+    }
+
+    ASSERT_TRUE(blinks.empty());
+}
+
 #endif
\ No newline at end of file
@@ -0,0 +1,253 @@
+/*
+
+Copyright Igor Petrovic
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*/
+
+#include "tests/common.h"
+#include "application/io/touchscreen/models/nextion/command.h"
+#include "application/io/touchscreen/models/nextion/parser.h"
+#include "application/io/touchscreen/models/viewtech/parser.h"
+
+#include <random>
+
+using namespace io::touchscreen;
+
+namespace
+{
+    constexpr size_t   FUZZ_ITERATIONS = 1000;
+    constexpr size_t   MAX_NOISE_SIZE  = 300;
+    constexpr uint32_t FUZZ_SEED       = 0x5EED;
+
+    class TouchscreenParserTest : public ::testing::Test
+    {
+        protected:
+        template<typename Parser>
+        std::vector<Data> parse(Parser& parser, const std::vector<uint8_t>& stream)
+        {
+            std::vector<Data> events;
+
+            for (auto value : stream)
+            {
+                Data data = {};
+
+                if (parser.parse(value, data) != tsEvent_t::NONE)
+                {
+                    events.push_back(data);
+                }
+            }
+
+            return events;
+        }
+
+        std::vector<uint8_t> noise(size_t size)
+        {
+            std::vector<uint8_t> stream(size);
+
+            for (auto& value : stream)
+            {
+                value = _random() & 0xFF;
+            }
+
+            return stream;
+        }
+
+        static std::vector<uint8_t> nextionButton(uint8_t index, bool state)
+        {
+            return { 0x65, state, index, 0xFF, 0xFF, 0xFF };
+        }
+
+        static std::vector<uint8_t> viewtechButton(uint8_t index, bool state)
+        {
+            return { 0xA5, 0x5A, 0x05, 0x82, 0x00, 0x02, state, index };
+        }
+
+        static void append(std::vector<uint8_t>& stream, const std::vector<uint8_t>& data)
+        {
+            stream.insert(stream.end(), data.begin(), data.end());
+        }
+
+        std::mt19937 _random = std::mt19937(FUZZ_SEED);
+    };
+}    // namespace
+
+TEST_F(TouchscreenParserTest, Nextion)
+{
+    NextionParser        parser;
+    std::vector<uint8_t> stream;
+
+    append(stream, nextionButton(5, true));
+    append(stream, nextionButton(6, false));
+
+    // data can arrive in chunks of any size
+    auto events = parse(parser, std::vector<uint8_t>(stream.begin(), stream.begin() + 4));
+    ASSERT_EQ(0, events.size());
+
+    events = parse(parser, std::vector<uint8_t>(stream.begin() + 4, stream.end()));
+    ASSERT_EQ(2, events.size());
+    ASSERT_EQ(5, events.at(0).buttonIndex);
+    ASSERT_TRUE(events.at(0).buttonState);
+    ASSERT_EQ(6, events.at(1).buttonIndex);
+    ASSERT_FALSE(events.at(1).buttonState);
+
+    // unknown response
+    events = parse(parser, { 0x66, 0x01, 0xFF, 0xFF, 0xFF });
+    ASSERT_EQ(0, events.size());
+
+    // frame larger than the buffer is discarded, and the next one is decoded
+    stream = std::vector<uint8_t>(NextionParser::BUFFER_SIZE * 2, 0x65);
+    append(stream, { 0xFF, 0xFF, 0xFF });
+    append(stream, nextionButton(7, true));
+
+    events = parse(parser, stream);
+    ASSERT_EQ(1, events.size());
+    ASSERT_EQ(7, events.at(0).buttonIndex);
+}
+
+TEST_F(TouchscreenParserTest, Viewtech)
+{
+    ViewtechParser       parser;
+    std::vector<uint8_t> stream;
+
+    // garbage before the header is skipped
+    append(stream, { 0x00, 0xA5, 0x12 });
+    append(stream, viewtechButton(5, true));
+    append(stream, viewtechButton(6, false));
+
+    auto events = parse(parser, std::vector<uint8_t>(stream.begin(), stream.begin() + 7));
+    ASSERT_EQ(0, events.size());
+
+    events = parse(parser, std::vector<uint8_t>(stream.begin() + 7, stream.end()));
+    ASSERT_EQ(2, events.size());
+    ASSERT_EQ(5, events.at(0).buttonIndex);
+    ASSERT_TRUE(events.at(0).buttonState);
+    ASSERT_EQ(6, events.at(1).buttonIndex);
+    ASSERT_FALSE(events.at(1).buttonState);
+
+    // repeated first header byte
+    events = parse(parser, { 0xA5, 0xA5, 0x5A, 0x05, 0x82, 0x00, 0x02, 0x01, 0x08 });
+    ASSERT_EQ(1, events.size());
+    ASSERT_EQ(8, events.at(0).buttonIndex);
+
+    // payload larger than the buffer is skipped, and the next frame is decoded
+    stream = { 0xA5, 0x5A, 0xFF };
+    append(stream, std::vector<uint8_t>(0xFF, 0x82));
+    append(stream, viewtechButton(9, true));
+
+    events = parse(parser, stream);
+    ASSERT_EQ(1, events.size());
+    ASSERT_EQ(9, events.at(0).buttonIndex);
+}
+
+TEST_F(TouchscreenParserTest, NextionFuzz)
+{
+    NextionParser parser;
+
+    for (size_t i = 0; i < FUZZ_ITERATIONS; i++)
+    {
+        auto stream = noise(_random() % MAX_NOISE_SIZE);
+
+        // terminator ends whatever the noise has started
+        append(stream, { 0x00, 0xFF, 0xFF, 0xFF });
+        append(stream, nextionButton(i & 0x7F, i & 0x01));
+
+        // pass the stream in random chunks
+        std::vector<Data> events;
+        size_t            start = 0;
+
+        while (start < stream.size())
+        {
+            size_t end   = std::min(stream.size(), start + 1 + (_random() % 64));
+            auto   chunk = parse(parser, std::vector<uint8_t>(stream.begin() + start, stream.begin() + end));
+
+            events.insert(events.end(), chunk.begin(), chunk.end());
+            start = end;
+        }
+
+        ASSERT_FALSE(events.empty());
+        ASSERT_EQ(i & 0x7F, events.back().buttonIndex);
+        ASSERT_EQ(i & 0x01, events.back().buttonState);
+    }
+}
+
+TEST_F(TouchscreenParserTest, ViewtechFuzz)
+{
+    ViewtechParser parser;
+
+    for (size_t i = 0; i < FUZZ_ITERATIONS; i++)
+    {
+        auto stream = noise(_random() % MAX_NOISE_SIZE);
+
+        // longest possible payload started by the noise ends within the padding,
+        // and padding itself doesn't start a new frame
+        append(stream, std::vector<uint8_t>(0xFF, 0x00));
+        append(stream, viewtechButton(i & 0x7F, i & 0x01));
+
+        std::vector<Data> events;
+        size_t            start = 0;
+
+        while (start < stream.size())
+        {
+            size_t end   = std::min(stream.size(), start + 1 + (_random() % 64));
+            auto   chunk = parse(parser, std::vector<uint8_t>(stream.begin() + start, stream.begin() + end));
+
+            events.insert(events.end(), chunk.begin(), chunk.end());
+            start = end;
+        }
+
+        ASSERT_FALSE(events.empty());
+        ASSERT_EQ(i & 0x7F, events.back().buttonIndex);
+        ASSERT_EQ(i & 0x01, events.back().buttonState);
+    }
+}
+
+TEST(TouchscreenCommandTest, Nextion)
+{
+    NextionCommand command;
+
+    auto verify = [&](const std::string& expected)
+    {
+        std::vector<uint8_t> bytes(expected.begin(), expected.end());
+        bytes.insert(bytes.end(), { 0xFF, 0xFF, 0xFF });
+
+        ASSERT_TRUE(command.end());
+        ASSERT_EQ(bytes, std::vector<uint8_t>(command.data(), command.data() + command.size()));
+    };
+
+    command.start("picq ")
+        .number(0)
+        .text(",")
+        .number(9)
+        .text(",")
+        .number(10)
+        .text(",")
+        .number(65535)
+        .text(",")
+        .number(4294967295);
+
+    verify("picq 0,9,10,65535,4294967295");
+
+    // buffer is reused for the next command
+    command.start("page ").number(12);
+    verify("page 12");
+
+    // terminator only
+    command.start("");
+    verify("");
+
+    // command which doesn't fit in the buffer shouldn't be sent
+    command.start(std::string(NextionCommand::BUFFER_SIZE - 2, 'a').c_str());
+    ASSERT_FALSE(command.end());
+}
@@ -0,0 +1,142 @@
+/*
+
+Copyright Igor Petrovic
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*/
+
+#include "tests/common.h"
+#include "application/util/logger/binary_logger.h"
+
+using namespace util::binary_log;
+
+namespace
+{
+    constexpr size_t LOGGER_SIZE = 128;
+
+    class BinaryLoggerTest : public ::testing::Test
+    {
+        protected:
+        util::BinaryLogger<LOGGER_SIZE> _logger;
+    };
+}    // namespace
+
+TEST_F(BinaryLoggerTest, Record)
+{
+    UTIL_BINARY_LOG(_logger, ERR, "Value %d, name %s", -2, "abc");
+
+    std::array<uint8_t, MAX_RECORD_SIZE> buffer = {};
+    const size_t                          SIZE   = _logger.read(buffer.data(), buffer.size());
+    const uint32_t                        ID     = hash("Value %d, name %s");
+
+    std::vector<uint8_t> expected = {
+        0,
+        static_cast<uint8_t>(level_t::ERR),
+        static_cast<uint8_t>(ID & 0xFF),
+        static_cast<uint8_t>((ID >> 8) & 0xFF),
+        static_cast<uint8_t>((ID >> 16) & 0xFF),
+        static_cast<uint8_t>((ID >> 24) & 0xFF),
+        static_cast<uint8_t>(argType_t::INT32),
+        0xFE,
+        0xFF,
+        0xFF,
+        0xFF,
+        static_cast<uint8_t>(argType_t::STRING),
+        3,
+        'a',
+        'b',
+        'c',
+    };
+
+    expected[0] = expected.size();
+
+    ASSERT_EQ(expected.size(), SIZE);
+    ASSERT_EQ(expected, std::vector<uint8_t>(buffer.begin(), buffer.begin() + SIZE));
+
+    // everything has been read
+    ASSERT_EQ(0, _logger.read(buffer.data(), buffer.size()));
+}
+
+TEST_F(BinaryLoggerTest, Dropped)
+{
+    // each record is header + one 32-bit argument
+    constexpr size_t RECORD_SIZE = HEADER_SIZE + 1 + sizeof(uint32_t);
+    constexpr size_t FITTING     = LOGGER_SIZE / RECORD_SIZE;
+    constexpr size_t TOTAL       = FITTING + 3;
+
+    for (size_t i = 0; i < TOTAL; i++)
+    {
+        UTIL_BINARY_LOG(_logger, INF, "Index %u", static_cast<uint32_t>(i));
+    }
+
+    std::array<uint8_t, LOGGER_SIZE * 2> buffer = {};
+    const size_t                          SIZE   = _logger.read(buffer.data(), buffer.size());
+
+    ASSERT_EQ(RECORD_SIZE * (FITTING + 1), SIZE);
+
+    // first record reports the amount of dropped records
+    ASSERT_EQ(static_cast<uint8_t>(level_t::WRN), buffer[1]);
+    ASSERT_EQ(DROPPED_ID, buffer[2] | (buffer[3] << 8) | (buffer[4] << 16) | (buffer[5] << 24));
+    ASSERT_EQ(TOTAL - FITTING, buffer[HEADER_SIZE + 1]);
+
+    // records are returned in order, starting with the oldest one
+    for (size_t i = 0; i < FITTING; i++)
+    {
+        ASSERT_EQ(i, buffer[(RECORD_SIZE * (i + 1)) + HEADER_SIZE + 1]);
+    }
+}
+
+TEST_F(BinaryLoggerTest, CompleteRecords)
+{
+    for (size_t i = 0; i < 3; i++)
+    {
+        UTIL_BINARY_LOG(_logger, INF, "Index %u", static_cast<uint32_t>(i));
+    }
+
+    constexpr size_t RECORD_SIZE = HEADER_SIZE + 1 + sizeof(uint32_t);
+
+    // buffer which can't hold two records shouldn't receive partial ones
+    std::array<uint8_t, (RECORD_SIZE * 2) - 1> buffer = {};
+
+    for (size_t i = 0; i < 3; i++)
+    {
+        ASSERT_EQ(RECORD_SIZE, _logger.read(buffer.data(), buffer.size()));
+        ASSERT_EQ(i, buffer[HEADER_SIZE + 1]);
+    }
+
+    ASSERT_EQ(0, _logger.read(buffer.data(), buffer.size()));
+}
+
+TEST_F(BinaryLoggerTest, Pack7Bit)
+{
+    std::array<uint8_t, 20> input = {};
+
+    for (size_t i = 0; i < input.size(); i++)
+    {
+        input[i] = 0xF0 + i;
+    }
+
+    std::array<uint8_t, packedSize(input.size())> packed   = {};
+    std::array<uint8_t, input.size()>             unpacked = {};
+
+    ASSERT_EQ(packed.size(), pack7Bit(input.data(), input.size(), packed.data()));
+
+    for (auto byte : packed)
+    {
+        ASSERT_EQ(0, byte & 0x80);
+    }
+
+    ASSERT_EQ(input.size(), unpack7Bit(packed.data(), packed.size(), unpacked.data()));
+    ASSERT_EQ(input, unpacked);
+}
@@ -21,6 +21,9 @@ limitations under the License.
 #include "tests/common.h"
 #include "application/protocol/midi/builder.h"
 
+#include <cmath>
+#include <cstdlib>
+
 using namespace io;
 using namespace protocol;
 
@@ -82,4 +85,242 @@ TEST_F(MIDITest, OmniChannel)
     }
 }
 
+TEST_F(MIDITest, DifferentialRefresh)
+{
+    messaging::Event event = {};
+    event.componentIndex   = 0;
+    event.channel          = 1;
+    event.index            = 0;
+    event.value            = 127;
+    event.message          = midi::messageType_t::NOTE_ON;
+
+    MidiDispatcher.notify(messaging::eventType_t::BUTTON, event);
+    ASSERT_EQ(1, _midi._hwaUsb._writeParser.totalWrittenChannelMessages());
+
+    // forced refresh of the same value shouldn't be sent again
+    _midi._hwaUsb.clear();
+    event.forcedRefresh = true;
+
+    MidiDispatcher.notify(messaging::eventType_t::BUTTON, event);
+    ASSERT_EQ(0, _midi._hwaUsb._writeParser.totalWrittenChannelMessages());
+
+    // changed value should
+    event.message = midi::messageType_t::NOTE_OFF;
+    event.value   = 0;
+
+    MidiDispatcher.notify(messaging::eventType_t::BUTTON, event);
+    ASSERT_EQ(1, _midi._hwaUsb._writeParser.totalWrittenChannelMessages());
+
+    // note off is the same as note on with zero velocity
+    _midi._hwaUsb.clear();
+    event.message = midi::messageType_t::NOTE_ON;
+
+    MidiDispatcher.notify(messaging::eventType_t::BUTTON, event);
+    ASSERT_EQ(0, _midi._hwaUsb._writeParser.totalWrittenChannelMessages());
+
+    // same index on different channel isn't known yet
+    event.channel = 2;
+
+    MidiDispatcher.notify(messaging::eventType_t::BUTTON, event);
+    ASSERT_EQ(1, _midi._hwaUsb._writeParser.totalWrittenChannelMessages());
+
+    // regular events are always sent
+    _midi._hwaUsb.clear();
+    event.forcedRefresh = false;
+
+    MidiDispatcher.notify(messaging::eventType_t::BUTTON, event);
+    ASSERT_EQ(1, _midi._hwaUsb._writeParser.totalWrittenChannelMessages());
+
+    // full refresh resends everything
+    _midi._hwaUsb.clear();
+
+    messaging::Event refresh = {};
+    refresh.systemMessage    = messaging::systemMessage_t::FORCE_IO_REFRESH;
+    refresh.value            = 0;
+
+    MidiDispatcher.notify(messaging::eventType_t::SYSTEM, refresh);
+
+    event.forcedRefresh = true;
+
+    MidiDispatcher.notify(messaging::eventType_t::BUTTON, event);
+    ASSERT_EQ(1, _midi._hwaUsb._writeParser.totalWrittenChannelMessages());
+}
+
+TEST_F(MIDITest, ClockDrift)
+{
+    // simulate 10 minutes of fractional tempo using the clock engine only
+    static constexpr uint32_t FIXED_BPM = 13333;
+    static constexpr uint64_t DURATION  = 10ULL * 60ULL * 1000000ULL;
+    static constexpr uint64_t TICKS     = DURATION / midi::Clock::TICK_USEC;
+
+    const double PERIOD = (60.0 * 1000000.0 * 100.0) / (FIXED_BPM * 24.0);
+
+    midi::Clock clock;
+    clock.setTempo(FIXED_BPM);
+    clock.run(true);
+
+    uint64_t pulses       = 0;
+    double   maxDeviation = 0;
+
+    for (uint64_t tick = 1; tick <= TICKS; tick++)
+    {
+        clock.tick();
+
+        while (clock.pulse())
+        {
+            pulses++;
+
+            // deviation is measured against ideal pulse position - it should never accumulate
+            const double deviation = std::fabs((tick * midi::Clock::TICK_USEC) - (pulses * PERIOD));
+            maxDeviation           = std::max(maxDeviation, deviation);
+        }
+    }
+
+    ASSERT_EQ(static_cast<uint64_t>(DURATION / PERIOD), pulses);
+    ASSERT_LE(maxDeviation, midi::Clock::TICK_USEC);
+}
+
+TEST_F(MIDITest, ClockFollow)
+{
+    // simulate 10 minutes of incoming clock at 125 BPM with +-2ms of jitter on each pulse
+    static constexpr uint64_t DURATION = 10ULL * 60ULL * 1000000ULL;
+    static constexpr uint64_t TICKS    = DURATION / midi::Clock::TICK_USEC;
+    static constexpr double   JITTER   = 2000;
+    static constexpr size_t   SETTLE   = 200;
+
+    const double PERIOD = (60.0 * 1000000.0) / (125 * 24.0);
+
+    midi::Clock clock;
+    clock.setMode(midi::Clock::mode_t::EXTERNAL);
+
+    uint32_t            seed     = 1;
+    uint64_t            received = 0;
+    double              next     = PERIOD;
+    std::vector<double> in       = {};
+    std::vector<double> out      = {};
+
+    auto random = [&]()
+    {
+        // simple LCG for deterministic jitter in range [-1, 1]
+        seed = (seed * 1664525) + 1013904223;
+        return ((((seed >> 8) & 0xFFFF) / 65535.0) * 2) - 1;
+    };
+
+    for (uint64_t tick = 1; tick <= TICKS; tick++)
+    {
+        const double time = tick * midi::Clock::TICK_USEC;
+
+        clock.tick();
+
+        if (time >= next)
+        {
+            in.push_back(time);
+            clock.sync();
+            received++;
+            next = ((received + 1) * PERIOD) + (random() * JITTER);
+        }
+
+        clock.update();
+
+        while (clock.pulse())
+        {
+            out.push_back(time);
+        }
+    }
+
+    auto stdDev = [&](const std::vector<double>& pulses)
+    {
+        double sum = 0;
+
+        for (size_t i = SETTLE; i < pulses.size() - 1; i++)
+        {
+            const double error = pulses.at(i + 1) - pulses.at(i) - PERIOD;
+            sum += error * error;
+        }
+
+        return std::sqrt(sum / (pulses.size() - 1 - SETTLE));
+    };
+
+    const double IN_JITTER  = stdDev(in);
+    const double OUT_JITTER = stdDev(out);
+
+    ASSERT_TRUE(clock.locked());
+    ASSERT_NEAR(12500, clock.tempo(), 50);
+    ASSERT_NEAR(in.size(), out.size(), 1);
+    ASSERT_LT(OUT_JITTER * 4, IN_JITTER);
+
+    // once incoming clock stops, at most one more pulse should be sent
+    const size_t SENT = out.size();
+
+    for (uint64_t tick = 0; tick < (DURATION / 600 / midi::Clock::TICK_USEC); tick++)
+    {
+        clock.tick();
+        clock.update();
+
+        while (clock.pulse())
+        {
+            out.push_back(0);
+        }
+    }
+
+    ASSERT_FALSE(clock.locked());
+    ASSERT_LE(out.size() - SENT, 1);
+}
+
+TEST_F(MIDITest, ClockFollowTempoChange)
+{
+    // incoming clock jumps from 100 to 250 BPM and back with +-3ms of jitter on each pulse:
+    // amount of sent pulses should never differ from amount of received ones by more than one
+    static constexpr uint64_t PHASE_TICKS = (60ULL * 1000000ULL) / midi::Clock::TICK_USEC;
+    static constexpr double   JITTER      = 3000;
+
+    midi::Clock clock;
+    clock.setMode(midi::Clock::mode_t::EXTERNAL);
+
+    uint32_t seed     = 1;
+    uint64_t received = 0;
+    uint64_t sent     = 0;
+    double   last     = 0;
+    double   next     = 0;
+
+    auto random = [&]()
+    {
+        seed = (seed * 1664525) + 1013904223;
+        return ((((seed >> 8) & 0xFFFF) / 65535.0) * 2) - 1;
+    };
+
+    auto period = [](uint32_t bpm)
+    {
+        return (60.0 * 1000000.0) / (bpm * 24.0);
+    };
+
+    for (uint64_t tick = 1; tick <= (PHASE_TICKS * 3); tick++)
+    {
+        const double   time = tick * midi::Clock::TICK_USEC;
+        const uint32_t BPM  = ((tick > PHASE_TICKS) && (tick <= (PHASE_TICKS * 2))) ? 250 : 100;
+
+        clock.tick();
+
+        if (time >= next)
+        {
+            clock.sync();
+            received++;
+            last = time;
+            next = last + period(BPM) + (random() * JITTER);
+        }
+
+        clock.update();
+
+        while (clock.pulse())
+        {
+            sent++;
+        }
+
+        ASSERT_LE(std::llabs(static_cast<int64_t>(sent) - static_cast<int64_t>(received)), 1);
+    }
+
+    ASSERT_TRUE(clock.locked());
+    ASSERT_NEAR(10000, clock.tempo(), 200);
+}
+
 #endif
\ No newline at end of file
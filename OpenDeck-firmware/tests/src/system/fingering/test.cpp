@@ -0,0 +1,133 @@
+/*
+
+Copyright Igor Petrovic
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*/
+
+#ifndef PROJECT_TARGET_USB_OVER_SERIAL_HOST
+
+#include "tests/common.h"
+#include "application/system/fingering.h"
+
+#include <random>
+
+TEST(SystemFingering, MatchesBruteForce)
+{
+    static constexpr uint32_t ALL_KEYS = 0x3FFFFFF;
+
+    std::mt19937                       random(42);
+    sys::Fingering                     fingering;
+    std::vector<sys::Fingering::Entry> table;
+
+    // reference: first entry whose checked keys are in the required state wins
+    auto bruteForce = [&](uint32_t mask)
+    {
+        for (const auto& entry : table)
+        {
+            if ((mask & entry.care) == (entry.keys & entry.care))
+            {
+                return static_cast<int16_t>(entry.note);
+            }
+        }
+
+        return sys::Fingering::NO_NOTE;
+    };
+
+    // priority of overlapping entries
+    table = {
+        { 0x0000003, ALL_KEYS, 60 },           // exact
+        { 0x0000001, ALL_KEYS & ~0x02, 61 },    // shadowed by the first one when key 1 is pressed
+        { 0x0000000, 0x0000001, 62 },           // only key 0 released matters
+    };
+
+    for (const auto& entry : table)
+    {
+        ASSERT_TRUE(fingering.add(entry));
+    }
+
+    ASSERT_TRUE(fingering.build());
+
+    ASSERT_EQ(60, fingering.resolve(0x0000003));
+    ASSERT_EQ(61, fingering.resolve(0x0000001));
+    ASSERT_EQ(-1, fingering.resolve(0x0000005));
+    ASSERT_EQ(62, fingering.resolve(0x0000000));
+    ASSERT_EQ(62, fingering.resolve(0x3FFFFFE));
+
+    // random tables
+    for (size_t round = 0; round < 500; round++)
+    {
+        // some tables won't fit into the tree - resolving must still be correct
+        const size_t  ENTRIES   = random() % (sys::SAX_FINGERING_ENTRIES + 1);
+        const uint8_t WILDCARDS = random() % 4;
+
+        fingering.clear();
+        table.clear();
+
+        for (size_t i = 0; i < ENTRIES; i++)
+        {
+            uint32_t ignored = 0;
+
+            switch (WILDCARDS)
+            {
+            case 1:
+                // few keys which are often irrelevant: palm keys, side keys, pinky table
+                ignored = random() & 0x3FC0000;
+                break;
+
+            case 2:
+                ignored = random() & random() & random() & ALL_KEYS;
+                break;
+
+            case 3:
+                ignored = random() & ALL_KEYS;
+                break;
+
+            default:
+                break;
+            }
+
+            sys::Fingering::Entry entry;
+            entry.keys = random() & ALL_KEYS;
+            entry.care = ALL_KEYS & ~ignored;
+            entry.note = random() & 0x7F;
+
+            table.push_back(entry);
+            ASSERT_TRUE(fingering.add(entry));
+        }
+
+        const bool COMPILED = fingering.build();
+
+        if (WILDCARDS < 2)
+        {
+            ASSERT_TRUE(COMPILED);
+        }
+
+        for (size_t i = 0; i < 1000; i++)
+        {
+            uint32_t mask = random() & ALL_KEYS;
+
+            // every other mask is made to match some entry
+            if (!table.empty() && (i % 2))
+            {
+                const auto& entry = table.at(random() % table.size());
+                mask              = (entry.keys & entry.care) | (mask & ~entry.care);
+            }
+
+            ASSERT_EQ(bruteForce(mask), fingering.resolve(mask));
+        }
+    }
+}
+
+#endif
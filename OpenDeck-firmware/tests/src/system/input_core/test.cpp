@@ -0,0 +1,143 @@
+/*
+
+Copyright Igor Petrovic
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*/
+
+#ifndef PROJECT_TARGET_USB_OVER_SERIAL_HOST
+
+#include "tests/common.h"
+#include "application/system/input_core.h"
+
+#include <atomic>
+#include <thread>
+
+TEST(SystemInputCore, TwoCores)
+{
+    static constexpr size_t EVENTS       = 5000;
+    static constexpr size_t MAX_PENDING  = 16;
+    static constexpr size_t SYSEX_LENGTH = 4;
+
+    // each thread plays a role of a single core
+    static thread_local bool inputCore = false;
+
+    MidiDispatcher.clear();
+
+    sys::InputCore core([]()
+                        {
+                            return inputCore;
+                        });
+
+    std::atomic<bool>     ticking      = false;
+    std::atomic<size_t>   received     = 0;
+    std::atomic<size_t>   systemEvents = 0;
+    std::vector<uint16_t> indexes      = {};
+    bool                  misrouted    = false;
+
+    MidiDispatcher.listen(messaging::eventType_t::BUTTON,
+                          [&](const messaging::Event& event)
+                          {
+                              misrouted |= inputCore;
+                              indexes.push_back(event.index);
+
+                              if (event.sysEx != nullptr)
+                              {
+                                  for (size_t i = 0; i < SYSEX_LENGTH; i++)
+                                  {
+                                      misrouted |= event.sysEx[i] != static_cast<uint8_t>(event.index + i);
+                                  }
+                              }
+
+                              received++;
+                          });
+
+    MidiDispatcher.listen(
+        messaging::eventType_t::SYSTEM,
+        [&](const messaging::Event&)
+        {
+            // events from main core must reach input listeners only between ticks
+            misrouted |= ticking;
+            systemEvents++;
+        },
+        messaging::context_t::INPUT);
+
+    core.attach();
+
+    std::thread input([&]()
+                      {
+                          inputCore = true;
+
+                          uint8_t sysEx[SYSEX_LENGTH] = {};
+
+                          for (size_t i = 0; i < EVENTS; i++)
+                          {
+                              while ((i - received) >= MAX_PENDING)
+                              {
+                                  std::this_thread::yield();
+                              }
+
+                              core.beginTick();
+                              ticking = true;
+
+                              messaging::Event event = {};
+                              event.index            = i;
+
+                              if (i % 4 == 0)
+                              {
+                                  // buffer is reused for the next event as soon as notify returns
+                                  for (size_t j = 0; j < SYSEX_LENGTH; j++)
+                                  {
+                                      sysEx[j] = static_cast<uint8_t>(i + j);
+                                  }
+
+                                  event.sysEx       = sysEx;
+                                  event.sysExLength = SYSEX_LENGTH;
+                              }
+
+                              MidiDispatcher.notify(messaging::eventType_t::BUTTON, event);
+
+                              ticking = false;
+                              core.endTick();
+                          }
+                      });
+
+    size_t sent = 0;
+
+    while (received < EVENTS)
+    {
+        core.drain();
+
+        if (sent < (EVENTS / 10))
+        {
+            MidiDispatcher.notify(messaging::eventType_t::SYSTEM, {});
+            sent++;
+        }
+    }
+
+    input.join();
+    MidiDispatcher.clear();
+
+    ASSERT_FALSE(misrouted);
+    ASSERT_EQ(0, core.dropped());
+    ASSERT_EQ(sent, systemEvents);
+    ASSERT_EQ(EVENTS, indexes.size());
+
+    for (size_t i = 0; i < EVENTS; i++)
+    {
+        ASSERT_EQ(static_cast<uint16_t>(i), indexes.at(i));
+    }
+}
+
+#endif
@@ -23,8 +23,14 @@ limitations under the License.
 #include "tests/helpers/midi.h"
 #include "application/system/builder.h"
 #include "application/util/configurable/configurable.h"
+#include "application/util/scheduler/scheduler.h"
 #include "core/mcu.h"
 
+#include <algorithm>
+#include <atomic>
+#include <random>
+#include <thread>
+
 using namespace io;
 using namespace protocol;
 
@@ -41,6 +47,7 @@ namespace
         {
             ConfigHandler.clear();
             MidiDispatcher.clear();
+            TaskScheduler.clear();
             _listener._event.clear();
         }
 
@@ -97,6 +104,17 @@ namespace
             _system._components._builderMidi._hwaSerial.clear();
             _listener._event.clear();
             _system._instance.run();
+
+            // forced refresh is spread over multiple runs: at default rate, one component is refreshed each ms
+            static constexpr size_t FORCED_REFRESH_DURATION = buttons::Collection::SIZE(buttons::GROUP_DIGITAL_INPUTS) +
+                                                              io::analog::Collection::SIZE(io::analog::GROUP_ANALOG_INPUTS) +
+                                                              1;
+
+            for (size_t i = 0; i < FORCED_REFRESH_DURATION; i++)
+            {
+                core::mcu::timing::setMs(core::mcu::timing::ms() + 1);
+                _system._instance.run();
+            }
         }
 
         test::Listener   _listener;
@@ -214,8 +232,9 @@ TEST_F(SystemTest, ForcedResendOnPresetChange)
               _system._components._builderMidi._hwaSerial._writeParser.totalWrittenChannelMessages());
 #endif
 
-    // Now switch preset again - on USB same amount of messages should be received.
-    // Nothing should be received on DIN.
+    // Now switch preset again - component configuration and values are identical in both presets
+    // and only the values which differ from the ones already sent are resent: nothing should be received on USB.
+    // Nothing should be received on DIN either since it's disabled in this preset.
 
     newPreset = 0;
 
@@ -250,8 +269,7 @@ TEST_F(SystemTest, ForcedResendOnPresetChange)
         // rest of the values are irrelevant
     }
 
-    ASSERT_EQ((buttons::Collection::SIZE(buttons::GROUP_DIGITAL_INPUTS)) + ENABLED_ANALOG_COMPONENTS,
-              _system._components._builderMidi._hwaUsb._writeParser.totalWrittenChannelMessages());
+    ASSERT_EQ(0, _system._components._builderMidi._hwaUsb._writeParser.totalWrittenChannelMessages());
 
 #ifdef PROJECT_TARGET_SUPPORT_DIN_MIDI
     ASSERT_EQ(0, _system._components._builderMidi._hwaSerial._writeParser.totalWrittenChannelMessages());
@@ -259,6 +277,7 @@ TEST_F(SystemTest, ForcedResendOnPresetChange)
 
     // and finally, back to the preset in which din midi is enabled
     // this will verify that din is properly enabled again
+    // since din was disabled in the meantime, everything should be resent there, but not on USB
 
     newPreset = 1;
 
@@ -293,8 +312,7 @@ TEST_F(SystemTest, ForcedResendOnPresetChange)
         // rest of the values are irrelevant
     }
 
-    ASSERT_EQ((buttons::Collection::SIZE(buttons::GROUP_DIGITAL_INPUTS)) + ENABLED_ANALOG_COMPONENTS,
-              _system._components._builderMidi._hwaUsb._writeParser.totalWrittenChannelMessages());
+    ASSERT_EQ(0, _system._components._builderMidi._hwaUsb._writeParser.totalWrittenChannelMessages());
 
 #ifdef PROJECT_TARGET_SUPPORT_DIN_MIDI
     ASSERT_EQ((buttons::Collection::SIZE(buttons::GROUP_DIGITAL_INPUTS)) + ENABLED_ANALOG_COMPONENTS,
@@ -708,4 +726,804 @@ TEST_F(SystemTest, UsbThruDin)
 }
 #endif
 
-#endif
\ No newline at end of file
+TEST_F(SystemTest, BulkRequests)
+{
+    // on init, all LEDs are turned off by calling hwa interface - irrelevant here
+    EXPECT_CALL(_system._components._builderLeds._hwa, setState(_, leds::brightness_t::OFF))
+        .Times(leds::Collection::SIZE(leds::GROUP_DIGITAL_OUTPUTS));
+
+    EXPECT_CALL(_system._components._builderMidi._hwaSerial, setLoopback(false))
+        .WillOnce(Return(true));
+
+    ASSERT_TRUE(_system._instance.init());
+
+    handshake();
+
+    static constexpr auto    SECTION       = sys::Config::Section::global_t::SAX_FINGERING_NOTE;
+    static constexpr size_t  VALUES_OFFSET = 13;
+    static constexpr uint8_t ACK           = static_cast<uint8_t>(lib::sysexconf::status_t::ACK);
+
+    auto request = [&](uint8_t requestId, uint16_t start, uint16_t count, const std::vector<uint16_t>& values = {}, uint8_t section = static_cast<uint8_t>(SECTION))
+    {
+        auto splitStart = util::Conversion::Split14Bit(start);
+        auto splitCount = util::Conversion::Split14Bit(count);
+
+        std::vector<uint8_t> message = {
+            0xF0,
+            0x00,
+            0x53,
+            0x43,
+            0x00,
+            0x00,
+            requestId,
+            static_cast<uint8_t>(sys::Config::block_t::GLOBAL),
+            section,
+        };
+
+        if (requestId != SYSEX_CR_SECTION_CRC)
+        {
+            message.push_back(splitStart.high());
+            message.push_back(splitStart.low());
+            message.push_back(splitCount.high());
+            message.push_back(splitCount.low());
+        }
+
+        for (auto value : values)
+        {
+            auto split = util::Conversion::Split14Bit(value);
+            message.push_back(split.high());
+            message.push_back(split.low());
+        }
+
+        message.push_back(0xF7);
+
+        return _helper.sendRawSysExToStub(message);
+    };
+
+    auto readValues = [&](uint16_t start, uint16_t count)
+    {
+        auto                  response = request(SYSEX_CR_BULK_GET, start, count);
+        std::vector<uint16_t> values   = {};
+
+        EXPECT_EQ(ACK, response.at(4));
+        EXPECT_EQ(VALUES_OFFSET + (count * 2) + 1, response.size());
+
+        for (size_t i = VALUES_OFFSET; (i + 1) < response.size(); i += 2)
+        {
+            values.push_back(util::Conversion::Merge14Bit(response.at(i), response.at(i + 1)).value());
+        }
+
+        return values;
+    };
+
+    auto crc = [&]()
+    {
+        auto response = request(SYSEX_CR_SECTION_CRC, 0, 0);
+
+        EXPECT_EQ(ACK, response.at(4));
+
+        // whole section should be covered
+        EXPECT_EQ(128, util::Conversion::Merge14Bit(response.at(9), response.at(10)).value());
+
+        return std::vector<uint8_t>(response.begin() + 11, response.end() - 1);
+    };
+
+    const std::vector<uint16_t> NOTES = { 60, 61, 62, 63 };
+
+    auto initialCrc = crc();
+
+    // verify that the values are written and that the CRC reflects the change
+    ASSERT_EQ(ACK, request(SYSEX_CR_BULK_SET, 2, NOTES.size(), NOTES).at(4));
+    ASSERT_EQ(NOTES, readValues(2, NOTES.size()));
+
+    auto updatedCrc = crc();
+    ASSERT_NE(initialCrc, updatedCrc);
+
+    // single value out of range: nothing should be written
+    ASSERT_EQ(static_cast<uint8_t>(lib::sysexconf::status_t::ERROR_NEW_VALUE),
+              request(SYSEX_CR_BULK_SET, 2, 4, { 70, 71, 200, 73 }).at(4));
+
+    ASSERT_EQ(NOTES, readValues(2, NOTES.size()));
+    ASSERT_EQ(updatedCrc, crc());
+
+    // invalid ranges
+    ASSERT_EQ(static_cast<uint8_t>(lib::sysexconf::status_t::ERROR_AMOUNT), request(SYSEX_CR_BULK_GET, 0, 0).at(4));
+    ASSERT_EQ(static_cast<uint8_t>(lib::sysexconf::status_t::ERROR_AMOUNT), request(SYSEX_CR_BULK_GET, 0, sys::BULK_MAX_VALUES + 1).at(4));
+    ASSERT_EQ(static_cast<uint8_t>(lib::sysexconf::status_t::ERROR_INDEX), request(SYSEX_CR_BULK_GET, 127, 2).at(4));
+
+    // value count not matching the amount of values
+    ASSERT_EQ(static_cast<uint8_t>(lib::sysexconf::status_t::ERROR_MESSAGE_LENGTH),
+              request(SYSEX_CR_BULK_SET, 2, 3, NOTES).at(4));
+
+    // sections which trigger actions can't be written in bulk
+    ASSERT_EQ(sys::Config::Status::ERROR_NOT_SUPPORTED,
+              request(SYSEX_CR_BULK_SET, 0, 1, { 1 }, static_cast<uint8_t>(sys::Config::Section::global_t::SAX_FINGERING_CLEAR)).at(4));
+
+    ASSERT_EQ(sys::Config::Status::ERROR_NOT_SUPPORTED,
+              request(SYSEX_CR_BULK_SET, 0, 1, { 60 }, static_cast<uint8_t>(sys::Config::Section::global_t::SAX_FINGERING_CAPTURE)).at(4));
+
+    ASSERT_EQ(NOTES, readValues(2, NOTES.size()));
+    ASSERT_EQ(updatedCrc, crc());
+}
+
+#ifdef PROJECT_TARGET_SAX_TABLE_UPLOAD
+TEST_F(SystemTest, SaxTableUpload)
+{
+    // on init, all LEDs are turned off by calling hwa interface - irrelevant here
+    EXPECT_CALL(_system._components._builderLeds._hwa, setState(_, leds::brightness_t::OFF))
+        .Times(leds::Collection::SIZE(leds::GROUP_DIGITAL_OUTPUTS));
+
+    EXPECT_CALL(_system._components._builderMidi._hwaSerial, setLoopback(false))
+        .WillOnce(Return(true));
+
+    ASSERT_TRUE(_system._instance.init());
+
+    handshake();
+
+    static constexpr uint8_t ACK = static_cast<uint8_t>(lib::sysexconf::status_t::ACK);
+
+    auto mask = [](size_t entry)
+    {
+        return static_cast<uint32_t>((entry * 0x10101) & 0x3FFFFFF);
+    };
+
+    auto note = [](size_t entry)
+    {
+        return static_cast<uint8_t>((entry + 40) & 0x7F);
+    };
+
+    auto upload = [&](size_t start, size_t count, bool last, uint8_t lastMaskByte = 0xFF, uint8_t format = 0x00)
+    {
+        std::vector<uint8_t> message = {
+            0xF0,
+            0x00,
+            0x53,
+            0x43,
+            0x00,
+            0x00,
+            SYSEX_CR_SAX_TABLE_UPLOAD,
+            static_cast<uint8_t>(start),
+            static_cast<uint8_t>(count),
+            static_cast<uint8_t>(last),
+            format,
+        };
+
+        for (size_t entry = start; entry < (start + count); entry++)
+        {
+            message.push_back(mask(entry) & 0x7F);
+            message.push_back((mask(entry) >> 7) & 0x7F);
+            message.push_back((mask(entry) >> 14) & 0x7F);
+            message.push_back(lastMaskByte == 0xFF ? ((mask(entry) >> 21) & 0x1F) : lastMaskByte);
+            message.push_back(note(entry));
+            message.push_back(0x01);
+        }
+
+        message.push_back(0xF7);
+
+        return _helper.sendRawSysExToStub(message).at(4);
+    };
+
+    auto readNote = [&](size_t entry)
+    {
+        return _helper.databaseReadFromSystemViaSysEx(sys::Config::Section::global_t::SAX_FINGERING_NOTE, entry);
+    };
+
+    static constexpr size_t ENTRIES = 14;
+    const auto              INITIAL = readNote(ENTRIES - 1);
+
+    ASSERT_NE(note(ENTRIES - 1), INITIAL);
+
+    // interrupted upload: chunks are received but the last one never arrives
+    ASSERT_EQ(ACK, upload(0, sys::SAX_TABLE_UPLOAD_MAX_ENTRIES, false));
+    ASSERT_EQ(INITIAL, readNote(ENTRIES - 1));
+
+    // chunk out of sequence aborts the upload
+    ASSERT_EQ(static_cast<uint8_t>(lib::sysexconf::status_t::ERROR_INDEX), upload(sys::SAX_TABLE_UPLOAD_MAX_ENTRIES + 1, 1, true));
+    ASSERT_EQ(static_cast<uint8_t>(lib::sysexconf::status_t::ERROR_INDEX), upload(sys::SAX_TABLE_UPLOAD_MAX_ENTRIES, ENTRIES - sys::SAX_TABLE_UPLOAD_MAX_ENTRIES, true));
+    ASSERT_EQ(INITIAL, readNote(ENTRIES - 1));
+
+    // unknown entry format, or entries not matching the format: nothing should be written
+    ASSERT_EQ(static_cast<uint8_t>(lib::sysexconf::status_t::ERROR_NEW_VALUE), upload(0, 1, true, 0xFF, 0x02));
+    ASSERT_EQ(static_cast<uint8_t>(lib::sysexconf::status_t::ERROR_MESSAGE_LENGTH), upload(0, 1, true, 0xFF, 0x01));
+    ASSERT_EQ(INITIAL, readNote(ENTRIES - 1));
+
+    // invalid entry in the last chunk: nothing should be written
+    ASSERT_EQ(ACK, upload(0, sys::SAX_TABLE_UPLOAD_MAX_ENTRIES, false));
+    ASSERT_EQ(static_cast<uint8_t>(lib::sysexconf::status_t::ERROR_NEW_VALUE), upload(sys::SAX_TABLE_UPLOAD_MAX_ENTRIES, ENTRIES - sys::SAX_TABLE_UPLOAD_MAX_ENTRIES, true, 0x20));
+    ASSERT_EQ(INITIAL, readNote(ENTRIES - 1));
+
+    // complete upload
+    ASSERT_EQ(ACK, upload(0, sys::SAX_TABLE_UPLOAD_MAX_ENTRIES, false));
+    ASSERT_EQ(ACK, upload(sys::SAX_TABLE_UPLOAD_MAX_ENTRIES, ENTRIES - sys::SAX_TABLE_UPLOAD_MAX_ENTRIES, true));
+
+    for (size_t entry = 0; entry < ENTRIES; entry++)
+    {
+        ASSERT_EQ(note(entry), readNote(entry));
+        ASSERT_EQ(mask(entry) & 0x3FFF, _helper.databaseReadFromSystemViaSysEx(sys::Config::Section::global_t::SAX_FINGERING_MASK_LO14, entry));
+        ASSERT_EQ((mask(entry) >> 14) | 0x1000, _helper.databaseReadFromSystemViaSysEx(sys::Config::Section::global_t::SAX_FINGERING_MASK_HI12_ENABLE, entry));
+    }
+
+    // entries which weren't uploaded are disabled
+    ASSERT_EQ(0, _helper.databaseReadFromSystemViaSysEx(sys::Config::Section::global_t::SAX_FINGERING_MASK_HI12_ENABLE, ENTRIES) & 0x1000);
+
+    // entries uploaded without care mask check all keys
+    for (size_t entry = 0; entry < ENTRIES; entry++)
+    {
+        ASSERT_EQ(0x3FFF, _helper.databaseReadFromSystemViaSysEx(sys::Config::Section::global_t::SAX_FINGERING_CARE_LO14, entry));
+        ASSERT_EQ(0x0FFF, _helper.databaseReadFromSystemViaSysEx(sys::Config::Section::global_t::SAX_FINGERING_CARE_HI12, entry));
+    }
+
+    LOG(INFO) << "Uploading entries with care mask";
+
+    static constexpr uint32_t CARE = 0x3FFFFFF & ~0x2A00001;
+
+    std::vector<uint8_t> message = {
+        0xF0,
+        0x00,
+        0x53,
+        0x43,
+        0x00,
+        0x00,
+        SYSEX_CR_SAX_TABLE_UPLOAD,
+        0x00,
+        sys::SAX_TABLE_UPLOAD_MAX_CARE_ENTRIES,
+        0x01,
+        0x01,
+    };
+
+    for (size_t entry = 0; entry < sys::SAX_TABLE_UPLOAD_MAX_CARE_ENTRIES; entry++)
+    {
+        for (auto value : { mask(entry), CARE })
+        {
+            message.push_back(value & 0x7F);
+            message.push_back((value >> 7) & 0x7F);
+            message.push_back((value >> 14) & 0x7F);
+            message.push_back((value >> 21) & 0x1F);
+
+            if (value != CARE)
+            {
+                message.push_back(note(entry));
+                message.push_back(0x01);
+            }
+        }
+    }
+
+    message.push_back(0xF7);
+
+    ASSERT_EQ(ACK, _helper.sendRawSysExToStub(message).at(4));
+
+    for (size_t entry = 0; entry < sys::SAX_TABLE_UPLOAD_MAX_CARE_ENTRIES; entry++)
+    {
+        ASSERT_EQ(note(entry), readNote(entry));
+        ASSERT_EQ(CARE & 0x3FFF, _helper.databaseReadFromSystemViaSysEx(sys::Config::Section::global_t::SAX_FINGERING_CARE_LO14, entry));
+        ASSERT_EQ(CARE >> 14, _helper.databaseReadFromSystemViaSysEx(sys::Config::Section::global_t::SAX_FINGERING_CARE_HI12, entry));
+    }
+}
+
+TEST_F(SystemTest, SaxTableCommitRecovery)
+{
+    // on init, all LEDs are turned off by calling hwa interface - irrelevant here
+    EXPECT_CALL(_system._components._builderLeds._hwa, setState(_, leds::brightness_t::OFF))
+        .Times(leds::Collection::SIZE(leds::GROUP_DIGITAL_OUTPUTS) * 2);
+
+    EXPECT_CALL(_system._components._builderMidi._hwaSerial, setLoopback(false))
+        .WillRepeatedly(Return(true));
+
+    ASSERT_TRUE(_system._instance.init());
+
+    handshake();
+
+    static constexpr size_t   ENTRIES    = 4;
+    static constexpr uint16_t ENABLE_BIT = 0x1000;
+
+    auto& database = _system._components.database();
+
+    auto stage = [&](size_t entry, uint16_t hiEnable)
+    {
+        return database.update(database::Config::Section::system_t::SAX_TABLE_STAGE,
+                               (entry * sys::SAX_TABLE_STAGE_VALUES) + 1,
+                               hiEnable);
+    };
+
+    for (size_t entry = 0; entry < ENTRIES; entry++)
+    {
+        ASSERT_TRUE(database.update(database::Config::Section::global_t::SAX_FINGERING_MASK_HI12_ENABLE, entry, ENABLE_BIT | entry));
+    }
+
+    // journal can't be written by host
+    ASSERT_FALSE(_helper.databaseWriteToSystemViaSysEx(sys::Config::Section::global_t::SYSTEM_SETTINGS,
+                                                       sys::Config::systemSetting_t::SAX_TABLE_COMMIT,
+                                                       1));
+
+    // simulate power loss while the uploaded table is staged: existing table should be kept
+    for (size_t entry = 0; entry < ENTRIES; entry++)
+    {
+        ASSERT_TRUE(stage(entry, entry + 1));
+    }
+
+    ASSERT_TRUE(_system._instance.init());
+
+    for (size_t entry = 0; entry < ENTRIES; entry++)
+    {
+        ASSERT_EQ(ENABLE_BIT | entry, database.read(database::Config::Section::global_t::SAX_FINGERING_MASK_HI12_ENABLE, entry));
+    }
+
+    // simulate power loss in the middle of the commit to active preset: uploaded table should be used
+    ASSERT_TRUE(database.update(database::Config::Section::system_t::SYSTEM_SETTINGS,
+                                sys::Config::systemSetting_t::SAX_TABLE_COMMIT,
+                                database.getPreset() + 1));
+
+    ASSERT_TRUE(database.update(database::Config::Section::global_t::SAX_FINGERING_MASK_HI12_ENABLE, 0, 1));
+
+    ASSERT_TRUE(_system._instance.init());
+
+    for (size_t entry = 0; entry < ENTRIES; entry++)
+    {
+        ASSERT_EQ(entry + 1, database.read(database::Config::Section::global_t::SAX_FINGERING_MASK_HI12_ENABLE, entry));
+    }
+
+    ASSERT_EQ(0, database.read(database::Config::Section::system_t::SYSTEM_SETTINGS, sys::Config::systemSetting_t::SAX_TABLE_COMMIT));
+}
+#endif
+
+TEST_F(SystemTest, ConfigDispatch)
+{
+    // on init, all LEDs are turned off by calling hwa interface - irrelevant here
+    EXPECT_CALL(_system._components._builderLeds._hwa, setState(_, leds::brightness_t::OFF))
+        .Times(leds::Collection::SIZE(leds::GROUP_DIGITAL_OUTPUTS));
+
+    EXPECT_CALL(_system._components._builderMidi._hwaSerial, setLoopback(false))
+        .WillOnce(Return(true));
+
+    ASSERT_TRUE(_system._instance.init());
+
+    uint16_t value = 0;
+
+    // sections of global block are handled by different components
+    ASSERT_EQ(sys::Config::Status::ACK,
+              ConfigHandler.get(sys::Config::block_t::GLOBAL,
+                                static_cast<uint8_t>(sys::Config::Section::global_t::MIDI_SETTINGS),
+                                static_cast<size_t>(protocol::midi::setting_t::DIN_ENABLED),
+                                value));
+
+    ASSERT_EQ(sys::Config::Status::ACK,
+              ConfigHandler.get(sys::Config::block_t::GLOBAL,
+                                static_cast<uint8_t>(sys::Config::Section::global_t::SYSTEM_SETTINGS),
+                                static_cast<size_t>(sys::Config::systemSetting_t::FORCED_REFRESH_RATE),
+                                value));
+
+    ASSERT_EQ(sys::Config::Status::ACK,
+              ConfigHandler.get(sys::Config::block_t::BUTTONS,
+                                static_cast<uint8_t>(sys::Config::Section::button_t::TYPE),
+                                0,
+                                value));
+
+    // nobody handles reserved section
+    ASSERT_EQ(sys::Config::Status::ERROR_NOT_SUPPORTED,
+              ConfigHandler.get(sys::Config::block_t::GLOBAL,
+                                static_cast<uint8_t>(sys::Config::Section::global_t::RESERVED),
+                                0,
+                                value));
+
+    // out of range requests aren't dispatched
+    ASSERT_EQ(sys::Config::Status::ERROR_NOT_SUPPORTED,
+              ConfigHandler.get(sys::Config::block_t::AMOUNT, 0, 0, value));
+
+    ASSERT_EQ(sys::Config::Status::ERROR_NOT_SUPPORTED,
+              ConfigHandler.set(sys::Config::block_t::GLOBAL, 0xFF, 0, 0));
+
+    // section is owned by the handler registered last
+    // handler which doesn't return status falls back to ERROR_NOT_SUPPORTED
+    static size_t calls = 0;
+
+    ASSERT_TRUE(ConfigHandler.registerConfig(
+        sys::Config::block_t::GLOBAL,
+        { sys::Config::Section::global_t::RESERVED },
+        [](uint8_t section, size_t index, uint16_t& readValue) -> std::optional<uint8_t>
+        {
+            calls++;
+            readValue = 42;
+            return sys::Config::Status::ACK;
+        },
+        [](uint8_t section, size_t index, uint16_t newValue) -> std::optional<uint8_t>
+        {
+            calls++;
+            return {};
+        }));
+
+    ASSERT_EQ(sys::Config::Status::ACK,
+              ConfigHandler.get(sys::Config::block_t::GLOBAL,
+                                static_cast<uint8_t>(sys::Config::Section::global_t::RESERVED),
+                                0,
+                                value));
+
+    ASSERT_EQ(42, value);
+
+    ASSERT_EQ(sys::Config::Status::ERROR_NOT_SUPPORTED,
+              ConfigHandler.set(sys::Config::block_t::GLOBAL,
+                                static_cast<uint8_t>(sys::Config::Section::global_t::RESERVED),
+                                0,
+                                0));
+
+    ASSERT_EQ(2, calls);
+
+    // other sections of the block stay with their original handler
+    ASSERT_EQ(sys::Config::Status::ACK,
+              ConfigHandler.get(sys::Config::block_t::GLOBAL,
+                                static_cast<uint8_t>(sys::Config::Section::global_t::MIDI_SETTINGS),
+                                static_cast<size_t>(protocol::midi::setting_t::DIN_ENABLED),
+                                value));
+
+    ASSERT_EQ(2, calls);
+
+    // registration fails once the handler table is full instead of being silently ignored
+    bool registered = true;
+
+    for (size_t i = 0; (i < 0xFF) && registered; i++)
+    {
+        registered = ConfigHandler.registerConfig(
+            sys::Config::block_t::GLOBAL,
+            { sys::Config::Section::global_t::RESERVED },
+            [](uint8_t section, size_t index, uint16_t& readValue) -> std::optional<uint8_t>
+            {
+                return {};
+            },
+            [](uint8_t section, size_t index, uint16_t newValue) -> std::optional<uint8_t>
+            {
+                return {};
+            });
+    }
+
+    ASSERT_FALSE(registered);
+}
+
+TEST_F(SystemTest, BootTimes)
+{
+    // on init, all LEDs are turned off by calling hwa interface - irrelevant here
+    EXPECT_CALL(_system._components._builderLeds._hwa, setState(_, leds::brightness_t::OFF))
+        .Times(leds::Collection::SIZE(leds::GROUP_DIGITAL_OUTPUTS));
+
+    EXPECT_CALL(_system._components._builderMidi._hwaSerial, setLoopback(false))
+        .WillOnce(Return(true));
+
+    ASSERT_TRUE(_system._instance.init());
+
+    // first run happens later than the end of init
+    core::mcu::timing::setMs(core::mcu::timing::ms() + 5);
+    _system._instance.run();
+
+    handshake();
+
+    static constexpr size_t STAGES        = 5;
+    static constexpr size_t VALUES_OFFSET = 7;
+
+    auto response = _helper.sendRawSysExToStub(std::vector<uint8_t>({ 0xF0,
+                                                                      0x00,
+                                                                      0x53,
+                                                                      0x43,
+                                                                      0x00,
+                                                                      0x00,
+                                                                      SYSEX_CR_BOOT_TIMES,
+                                                                      0xF7 }));
+
+    ASSERT_EQ(VALUES_OFFSET + (STAGES * 2) + 1, response.size());
+    ASSERT_EQ(static_cast<uint8_t>(lib::sysexconf::status_t::ACK), response.at(4));
+
+    std::vector<uint16_t> times = {};
+
+    for (size_t i = 0; i < STAGES; i++)
+    {
+        auto merged = util::Conversion::Merge14Bit(response.at(VALUES_OFFSET + (i * 2)), response.at(VALUES_OFFSET + (i * 2) + 1));
+        times.push_back(merged.value());
+    }
+
+    // stages are completed in order
+    for (size_t i = 1; i < STAGES; i++)
+    {
+        ASSERT_LE(times.at(i - 1), times.at(i));
+    }
+
+    if (times.back() < midi::MAX_VALUE_14BIT)
+    {
+        ASSERT_LT(times.at(STAGES - 2), times.at(STAGES - 1));
+    }
+}
+
+TEST_F(SystemTest, FactoryResetKeepsServicingRequests)
+{
+    // on init, all LEDs are turned off by calling hwa interface - irrelevant here
+    EXPECT_CALL(_system._components._builderLeds._hwa, setState(_, leds::brightness_t::OFF))
+        .Times(leds::Collection::SIZE(leds::GROUP_DIGITAL_OUTPUTS));
+
+    EXPECT_CALL(_system._components._builderMidi._hwaSerial, setLoopback(false))
+        .WillOnce(Return(true));
+
+    ASSERT_TRUE(_system._instance.init());
+
+    handshake();
+
+    static constexpr uint8_t ACK  = static_cast<uint8_t>(lib::sysexconf::status_t::ACK);
+    static constexpr uint8_t BUSY = sys::Config::Status::ERROR_BUSY;
+
+    auto customRequest = [&](uint8_t request)
+    {
+        return _helper.sendRawSysExToStub(std::vector<uint8_t>({ 0xF0,
+                                                                 0x00,
+                                                                 0x53,
+                                                                 0x43,
+                                                                 0x00,
+                                                                 0x00,
+                                                                 request,
+                                                                 0xF7 }))
+            .at(4);
+    };
+
+    auto getRequest = [&]()
+    {
+        return _helper.sendRawSysExToStub(std::vector<uint8_t>({ 0xF0,
+                                                                 0x00,
+                                                                 0x53,
+                                                                 0x43,
+                                                                 0x00,
+                                                                 0x00,
+                                                                 static_cast<uint8_t>(lib::sysexconf::wish_t::GET),
+                                                                 static_cast<uint8_t>(lib::sysexconf::amount_t::SINGLE),
+                                                                 static_cast<uint8_t>(sys::Config::block_t::GLOBAL),
+                                                                 static_cast<uint8_t>(sys::Config::Section::global_t::SAX_FINGERING_NOTE),
+                                                                 0x00,
+                                                                 0x00,
+                                                                 0x00,
+                                                                 0x00,
+                                                                 0xF7 }))
+            .at(4);
+    };
+
+    ASSERT_EQ(ACK, customRequest(SYSEX_CR_FACTORY_RESET));
+    ASSERT_TRUE(_system._components.database().isFactoryResetInProgress());
+
+    // requests which don't depend on configuration are still served, the rest are rejected
+    ASSERT_EQ(ACK, customRequest(SYSEX_CR_FIRMWARE_VERSION));
+    ASSERT_EQ(BUSY, customRequest(SYSEX_CR_FACTORY_RESET));
+    ASSERT_EQ(BUSY, customRequest(SYSEX_CR_FULL_BACKUP));
+    ASSERT_EQ(BUSY, getRequest());
+    ASSERT_TRUE(_system._components.database().isFactoryResetInProgress());
+
+    // single batch of defaults is written on each run
+    size_t runs = 0;
+
+    while (_system._components.database().isFactoryResetInProgress())
+    {
+        _system._instance.run();
+        runs++;
+    }
+
+    ASSERT_GT(runs, 1);
+    ASSERT_EQ(ACK, getRequest());
+}
+
+TEST(SystemArticulation, BreathTrace)
+{
+    struct Note
+    {
+        uint8_t note;
+        uint8_t velocity;
+
+        bool operator==(const Note& other) const
+        {
+            return (note == other.note) && (velocity == other.velocity);
+        }
+    };
+
+    struct Sample
+    {
+        uint16_t breath;
+        int16_t  note;
+    };
+
+    std::vector<Note> notes = {};
+    sys::Articulation articulation([notes = &notes](uint8_t note, uint8_t velocity)
+                                   {
+                                       notes->push_back({ note, velocity });
+                                   });
+
+    sys::Articulation::Config config;
+    config.onThreshold     = 1100;
+    config.offThreshold    = 1000;
+    config.fullScaleRise   = 400;
+    config.velocitySamples = 2;
+    articulation.configure(config);
+
+    auto play = [&](const std::vector<Sample>& trace)
+    {
+        for (const auto& sample : trace)
+        {
+            articulation.note(sample.note);
+            articulation.breath(sample.breath);
+        }
+    };
+
+    // fingering alone doesn't start the note
+    play({
+        { 500, 60 },
+        { 900, 60 },
+        { 1050, 60 },
+    });
+
+    ASSERT_TRUE(notes.empty());
+    ASSERT_EQ(-1, articulation.playing());
+
+    // blip above the threshold shorter than velocity window produces no note
+    play({
+        { 1150, 60 },
+        { 900, 60 },
+        { 950, 60 },
+    });
+
+    ASSERT_TRUE(notes.empty());
+    ASSERT_EQ(-1, articulation.playing());
+
+    // soft attack
+    play({
+        { 1000, 60 },
+        { 1110, 60 },
+        { 1120, 60 },
+    });
+
+    ASSERT_TRUE(notes.empty());
+    ASSERT_EQ(-1, articulation.playing());
+
+    play({
+        { 1130, 60 },
+    });
+
+    ASSERT_EQ(1, notes.size());
+    ASSERT_EQ(60, notes.at(0).note);
+    const uint8_t softVelocity = notes.at(0).velocity;
+    ASSERT_EQ(1 + ((130 * 126) / 400), softVelocity);
+    ASSERT_EQ(60, articulation.playing());
+
+    // breath between thresholds keeps the note playing
+    play({
+        { 1050, 60 },
+        { 1010, 60 },
+    });
+
+    ASSERT_EQ(1, notes.size());
+    ASSERT_EQ(60, articulation.playing());
+
+    // legato change: new note starts before the old one stops
+    play({
+        { 1200, 62 },
+    });
+
+    ASSERT_EQ(3, notes.size());
+    ASSERT_EQ((Note{ 62, softVelocity }), notes.at(1));
+    ASSERT_EQ((Note{ 60, 0 }), notes.at(2));
+    ASSERT_EQ(62, articulation.playing());
+
+    // unknown fingering keeps the last note
+    play({
+        { 1200, -1 },
+        { 1200, 62 },
+    });
+
+    ASSERT_EQ(3, notes.size());
+    ASSERT_EQ(62, articulation.playing());
+
+    // release stops the note
+    play({
+        { 999, 62 },
+    });
+
+    ASSERT_EQ(4, notes.size());
+    ASSERT_EQ((Note{ 62, 0 }), notes.at(3));
+    ASSERT_EQ(-1, articulation.playing());
+
+    // hard attack results in higher velocity
+    play({
+        { 900, 64 },
+        { 1300, 64 },
+        { 1500, 64 },
+        { 1600, 64 },
+    });
+
+    ASSERT_EQ(5, notes.size());
+    ASSERT_EQ(64, notes.at(4).note);
+    ASSERT_EQ(127, notes.at(4).velocity);
+    ASSERT_GT(notes.at(4).velocity, softVelocity);
+    ASSERT_EQ(64, articulation.playing());
+
+    // reset stops the playing note
+    articulation.reset();
+
+    ASSERT_EQ(6, notes.size());
+    ASSERT_EQ((Note{ 64, 0 }), notes.at(5));
+    ASSERT_EQ(-1, articulation.playing());
+}
+
+#ifdef PROJECT_TARGET_LOW_POWER
+TEST_F(SystemTest, IdleHooks)
+{
+    using idleHook_t = sys::HwaTest::idleHook_t;
+
+    static constexpr size_t RUNS_PER_ROUND = static_cast<size_t>(io::ioComponent_t::AMOUNT);
+
+    auto& hwa = _system._hwa;
+
+    // on init, all LEDs are turned off by calling hwa interface - irrelevant here
+    EXPECT_CALL(_system._components._builderLeds._hwa, setState(_, leds::brightness_t::OFF))
+        .Times(leds::Collection::SIZE(leds::GROUP_DIGITAL_OUTPUTS));
+
+    EXPECT_CALL(_system._components._builderMidi._hwaSerial, setLoopback(false))
+        .WillOnce(Return(true));
+
+    ASSERT_TRUE(_system._instance.init());
+
+    // let the preset change notification and forced refresh pass
+    fakeTimeAndRunSystem();
+
+    // returns the amount of runs after which the loop went to sleep, 0 if it didn't
+    auto runUntilSleep = [&]()
+    {
+        hwa._idleHooks.clear();
+
+        for (size_t runs = 1; runs <= (RUNS_PER_ROUND * 2); runs++)
+        {
+            _system._instance.run();
+
+            if (!hwa._idleHooks.empty() && (hwa._idleHooks.back() == idleHook_t::SLEEP))
+            {
+                return runs;
+            }
+        }
+
+        return static_cast<size_t>(0);
+    };
+
+    ASSERT_NE(0, runUntilSleep());
+
+    // once awake, loop sleeps again only after all components were updated without any event
+    ASSERT_EQ(RUNS_PER_ROUND, runUntilSleep());
+    ASSERT_EQ(std::vector<idleHook_t>({ idleHook_t::SLEEP }), hwa._idleHooks);
+
+    // event in the middle of the round restarts it
+    hwa._idleHooks.clear();
+
+    for (size_t i = 0; i < (RUNS_PER_ROUND - 1); i++)
+    {
+        _system._instance.run();
+    }
+
+    ASSERT_TRUE(hwa._idleHooks.empty());
+
+    MidiDispatcher.notify(messaging::eventType_t::BUTTON, messaging::Event{});
+
+    ASSERT_EQ(RUNS_PER_ROUND + 1, runUntilSleep());
+    ASSERT_EQ(std::vector<idleHook_t>({ idleHook_t::SLEEP }), hwa._idleHooks);
+    ASSERT_FALSE(hwa._idleScan);
+
+    // without events, scan rate is lowered before the loop goes to sleep
+    core::mcu::timing::setMs(core::mcu::timing::ms() + sys::IDLE_SCAN_TIMEOUT);
+
+    ASSERT_EQ(RUNS_PER_ROUND, runUntilSleep());
+    ASSERT_EQ(std::vector<idleHook_t>({ idleHook_t::IDLE_SCAN_ON, idleHook_t::SLEEP }), hwa._idleHooks);
+
+    // scan rate is set only once
+    ASSERT_EQ(RUNS_PER_ROUND, runUntilSleep());
+    ASSERT_EQ(std::vector<idleHook_t>({ idleHook_t::SLEEP }), hwa._idleHooks);
+
+    // board switches back to full rate on input change: loop must not sleep in that run
+    // and idle timeout starts over
+    hwa._idleScan = false;
+    hwa._idleHooks.clear();
+    _system._instance.run();
+
+    ASSERT_TRUE(hwa._idleHooks.empty());
+
+    ASSERT_EQ(RUNS_PER_ROUND, runUntilSleep());
+    ASSERT_EQ(std::vector<idleHook_t>({ idleHook_t::SLEEP }), hwa._idleHooks);
+    ASSERT_FALSE(hwa._idleScan);
+}
+#endif
+
+#endif
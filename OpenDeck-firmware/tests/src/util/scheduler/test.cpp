@@ -0,0 +1,134 @@
+/*
+
+Copyright Igor Petrovic
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*/
+
+#include "tests/common.h"
+#include "application/util/scheduler/scheduler.h"
+#include "core/mcu.h"
+
+#include <vector>
+
+TEST(Scheduler, TimingWheel)
+{
+    static constexpr uint32_t ONE_SHOT_TIMEOUT = 5;
+    static constexpr uint32_t PERIOD           = 50;
+    static constexpr uint32_t LONG_TIMEOUT     = 30 * 60 * 1000;    // beyond the range of the wheel
+    static constexpr uint32_t DURATION         = 2000;
+    static constexpr uint32_t JUMP             = 997;
+
+    static std::vector<uint32_t> oneShotRuns;
+    static std::vector<uint32_t> periodicRuns;
+    static std::vector<uint32_t> longRuns;
+
+    oneShotRuns.clear();
+    periodicRuns.clear();
+    longRuns.clear();
+
+    // start just before ms counter overflows
+    const uint32_t START = 0xFFFFFFFF - (DURATION / 2);
+
+    core::mcu::timing::setMs(START);
+    TaskScheduler.clear();
+
+    util::Scheduler::handle_t oneShot  = util::Scheduler::INVALID_HANDLE;
+    util::Scheduler::handle_t periodic = util::Scheduler::INVALID_HANDLE;
+    util::Scheduler::handle_t longTask = util::Scheduler::INVALID_HANDLE;
+
+    ASSERT_TRUE(TaskScheduler.registerTask(oneShot,
+                                           ONE_SHOT_TIMEOUT * 2,
+                                           []()
+                                           {
+                                               oneShotRuns.push_back(core::mcu::timing::ms());
+                                           }));
+
+    auto replaced = oneShot;
+
+    // registering with the same handle replaces the task
+    ASSERT_TRUE(TaskScheduler.registerTask(oneShot,
+                                           ONE_SHOT_TIMEOUT,
+                                           []()
+                                           {
+                                               oneShotRuns.push_back(core::mcu::timing::ms());
+                                           }));
+
+    ASSERT_TRUE(TaskScheduler.registerPeriodicTask(periodic,
+                                                   PERIOD,
+                                                   []()
+                                                   {
+                                                       periodicRuns.push_back(core::mcu::timing::ms());
+                                                   }));
+
+    ASSERT_TRUE(TaskScheduler.registerTask(longTask,
+                                           LONG_TIMEOUT,
+                                           []()
+                                           {
+                                               longRuns.push_back(core::mcu::timing::ms());
+                                           }));
+
+    for (uint32_t i = 1; i <= DURATION; i++)
+    {
+        core::mcu::timing::setMs(START + i);
+        TaskScheduler.update();
+    }
+
+    ASSERT_EQ(1, oneShotRuns.size());
+    ASSERT_EQ(START + ONE_SHOT_TIMEOUT, oneShotRuns.at(0));
+    ASSERT_FALSE(TaskScheduler.isRegistered(oneShot));
+
+    ASSERT_EQ(DURATION / PERIOD, periodicRuns.size());
+
+    for (size_t i = 0; i < periodicRuns.size(); i++)
+    {
+        ASSERT_EQ(static_cast<uint32_t>(START + (PERIOD * (i + 1))), periodicRuns.at(i));
+    }
+
+    TaskScheduler.cancel(periodic);
+    ASSERT_EQ(util::Scheduler::INVALID_HANDLE, periodic);
+
+    // old handles must not affect the tasks which reuse their slots
+    util::Scheduler::handle_t extra[2] = { util::Scheduler::INVALID_HANDLE, util::Scheduler::INVALID_HANDLE };
+
+    for (auto& handle : extra)
+    {
+        ASSERT_TRUE(TaskScheduler.registerTask(handle, PERIOD, []() {}));
+    }
+
+    ASSERT_FALSE(TaskScheduler.isRegistered(replaced));
+    TaskScheduler.cancel(replaced);
+
+    for (auto& handle : extra)
+    {
+        ASSERT_TRUE(TaskScheduler.isRegistered(handle));
+        TaskScheduler.cancel(handle);
+    }
+
+    ASSERT_TRUE(TaskScheduler.isRegistered(longTask));
+
+    // large jumps in time run the task once, at the first update after it has expired
+    for (uint32_t time = DURATION; time < (LONG_TIMEOUT + JUMP); time += JUMP)
+    {
+        core::mcu::timing::setMs(START + time);
+        TaskScheduler.update();
+    }
+
+    ASSERT_EQ(DURATION / PERIOD, periodicRuns.size());
+    ASSERT_EQ(1, longRuns.size());
+    ASSERT_GE(longRuns.at(0) - START, LONG_TIMEOUT);
+    ASSERT_LT(longRuns.at(0) - START, LONG_TIMEOUT + JUMP);
+
+    TaskScheduler.clear();
+}
@@ -36,6 +36,23 @@ const sections: Dictionary<ISectionDefinition> = {
     label: "Disable forced value refresh after preset change",
     helpText: `If this option isn't enabled, all components will resend their current values once the preset changes.`,
   },
+  ForcedValueRefreshRate: {
+    showIf: (formState: FormState): boolean =>
+      !formState.disableForcedValueRefreshAfterPresetChange,
+    block: Block.Global,
+    key: "forcedValueRefreshRate",
+    type: SectionType.Setting,
+    section: 2,
+    settingIndex: 14,
+    min: 0,
+    max: 100,
+    component: FormInputComponent.Input,
+    label: "Forced value refresh rate",
+    helpText: `Amount of components which resend their values per millisecond during forced value refresh.
+      Lower values spread the refresh over longer period of time to avoid overloading the receiving device.
+      Only the values which differ from the ones already sent are resent after preset change.
+      Value 0 uses the default rate of 1 component per millisecond.`,
+  },
   EnablePresetChangeWithProgramChangeIn: {
     block: Block.Global,
     key: "enablePresetChangeWithProgramChangeIn",
@@ -317,6 +334,38 @@ RP2040 Pico + native ADC 3채널 추천 구성:
     helpText: `This setting applies only to DIN MIDI out.
     When enabled, MIDI clock will be sent out at default BPM of 120. The tempo can be changed with buttons or encoders.`,
   },
+  MIDIClockUsb: {
+    block: Block.Global,
+    key: "midiClockUsb",
+    type: SectionType.Setting,
+    section: 0,
+    settingIndex: 16,
+    component: FormInputComponent.Toggle,
+    label: "Send MIDI clock (USB)",
+    helpText: `When enabled, MIDI clock will be sent out via USB MIDI.`,
+  },
+  MIDIClockBle: {
+    showIf: (formState: FormState): boolean => !!formState.bleMidiState,
+    block: Block.Global,
+    key: "midiClockBle",
+    type: SectionType.Setting,
+    section: 0,
+    settingIndex: 17,
+    component: FormInputComponent.Toggle,
+    label: "Send MIDI clock (BLE)",
+    helpText: `When enabled, MIDI clock will be sent out via BLE MIDI.`,
+  },
+  FollowMIDIClock: {
+    block: Block.Global,
+    key: "followMidiClock",
+    type: SectionType.Setting,
+    section: 0,
+    settingIndex: 18,
+    component: FormInputComponent.Toggle,
+    label: "Follow incoming MIDI clock",
+    helpText: `When enabled, tempo and phase of sent MIDI clock and LED blinking will follow incoming MIDI clock.
+    Jitter of incoming clock is smoothed out. Clock is stopped once incoming clock stops.`,
+  },
   DinMidiState: {
     block: Block.Global,
     key: "dinMidiState",